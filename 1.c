@@ -20,10 +20,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <time.h>
 
 /* ========== 타입 정의 ========== */
 
+#include <stdbool.h>
+
 // FSM 상태 (SA PDF p.11-12 FSM Version 1 상태 정의)
 typedef enum {
     STATE_MOVING,        // SA PDF p.11 "Moving: 정상 전진 및 청소 중"
@@ -56,205 +59,631 @@ typedef enum {
     TURN_NONE
 } TurnDirection;
 
-// 센서 데이터 구조 (SA PDF p.5 Event List)
+// 카운터 기반 난수 상태 (로봇마다 하나)
+typedef struct {
+    unsigned long long key;      // 시드 + 로봇 번호에서 유도
+    unsigned long long counter;  // 뽑은 횟수
+} RngState;
+
+// 센서 시뮬레이션 확률: 난수 한 번(64비트)을 16비트씩 잘라 센서 4개에 사용
+#define SENSOR_OBSTACLE_THRESHOLD 13107  // 65536 × 20% 장애물 확률
+#define SENSOR_DUST_THRESHOLD 6554       // 65536 × 10% 먼지 확률
+
+// 센서 데이터 (SA PDF p.5 Event List): 4비트 센서 워드
+// 센서 인터페이스가 만든 워드를 그대로 FSM 전이 테이블 인덱스로 사용
+#define SENSOR_FRONT 0x01   // SRS PDF p.2 "Front_Obs"
+#define SENSOR_LEFT  0x02   // SRS PDF p.2 "Left_Obs"
+#define SENSOR_RIGHT 0x04   // SRS PDF p.2 "Right_Obs"
+#define SENSOR_DUST  0x08   // SRS PDF p.2 "Dust_Level", p.4 "Dust_Exist"
+typedef unsigned char SensorData;
+
+// 테이블 기반 FSM 전이 항목 (fsm/fsm_spec.h에서 생성한 fsm_table.c)
+// (상태, 센서 입력 워드, 타이머 만료) 조합마다 하나씩 미리 계산되어 있음
+#define FSM_KEEP 0xFF           // 명령을 이전 값으로 유지
+typedef struct {
+    unsigned char next;         // 다음 상태
+    unsigned char motor;        // 모터 명령 (FSM_KEEP: 유지)
+    unsigned char cleaner;      // 청소기 명령 (FSM_KEEP: 유지)
+    unsigned char reload;       // 다음 상태 진입 시 카운트다운 타이머 값 (0: 없음)
+    unsigned char msg[2];       // trace 메시지 번호 (0: 없음)
+} FsmEntry;
+
+// fleet용 전이 함수(fsm_lane.h)의 결과: FsmEntry와 같은 내용을 로봇 1대분 값으로
+// (명령은 KEEP을 이미 이전 값으로 풀어 둠, 메시지는 fleet에서 쓰지 않음)
 typedef struct {
-    bool front;         // SRS PDF p.2 "Front_Obs"
-    bool left;          // SRS PDF p.2 "Left_Obs"
-    bool right;         // SRS PDF p.2 "Right_Obs"
-    bool dust;          // SRS PDF p.2 "Dust_Level", p.4 "Dust_Exist"
-} SensorData;
+    int next;
+    int motor;
+    int cleaner;
+    int reload;
+} FsmLane;
+
+// 액추에이터 출력 단계 (actuators.c)
+// 마지막으로 내보낸 명령을 기억하고, 바뀐 명령만 모아 tick당 한 번의 일괄 쓰기로 내보냄
+#define ACTUATOR_MOTOR 0
+#define ACTUATOR_CLEANER 1
+#define ACTUATOR_COUNT 2
+typedef struct {
+    bool committed;                         // false: 아직 내보낸 명령 없음 (첫 tick은 모두 내보냄)
+    int last[ACTUATOR_COUNT];               // 마지막으로 내보낸 명령
+    long long emitted[ACTUATOR_COUNT];      // 바뀌어서 내보낸 명령 수
+    long long suppressed[ACTUATOR_COUNT];   // 같아서 생략한 명령 수
+    long long writes;                       // 일괄 쓰기 횟수 (바뀐 명령이 있던 tick 수)
+} ActuatorOutput;
 
 // 시스템 컨텍스트
 typedef struct {
     SystemState state;
     SensorData sensors;
+    RngState rng;           // 센서 시뮬레이션 난수
     MotorCommand motor_cmd;
     CleanerCommand cleaner_cmd;
+    ActuatorOutput output;  // 액추에이터 출력 단계 (마지막 명령, 쓰기 카운터)
     int tick_count;         // SRS PDF p.2 "Tick: 제어 주기"
+    long long tick_time_us; // 현재 tick의 (가상) 시각
     int state_duration;
     int dust_clean_timer;
     int backward_timer;
 } RVCContext;
 
+// 로봇 자세: 중심 좌표 (Q8 고정소수점, 1/256칸)와 45° 단위 방향 (0: +x, 1씩 시계 방향, y는 아래로 증가)
+// 칸 번호는 x >> KIN_FRAC_BITS
+#define ENV_HEADINGS 8
+#define KIN_FRAC_BITS 8
+typedef struct {
+    int x;
+    int y;
+    int heading;
+} RobotPose;
+
+#define ENV_STEP_MM 30          // tick당 전진/후진 거리 (300 mm/s × 100 ms)
+#define ENV_ROBOT_RADIUS_MM 170 // 로봇 반지름 (지름 34 cm)
+#define ENV_SENSOR_RANGE_MM 40  // 범퍼 앞 장애물 감지 거리
+
+// 운동학 모델 (kinematics.c): 방향별 1 tick 전진량 (Q8), Q15 sin/cos 표로 한 번만 계산
+// 자세 갱신은 정수 덧셈뿐이라 플랫폼과 무관하게 비트 단위로 같은 결과
+typedef struct {
+    int step[ENV_HEADINGS][2];
+    int unit_mm;            // 자세 1 단위 (Q8 이전) 길이
+} KinModel;
+
+// 다수 로봇 일괄 실행용 SoA(Structure of Arrays) 배치
+// 필드별로 연속 배치하여 만료 비교와 전이 검사를 컴파일러가 벡터화할 수 있게 함
+// 전이 규칙은 fsm_executor와 동일 (SA PDF p.13 상태 전이 테이블)
+typedef struct {
+    int count;
+    unsigned char *state;        // SystemState
+    unsigned char *motor_cmd;    // MotorCommand
+    unsigned char *cleaner_cmd;  // CleanerCommand
+    int *state_since;            // 현재 상태에 들어간 tick (state_duration / 타이머는 여기서 계산)
+    int ticks;                   // 실행한 tick 수 (tick 안에서는 현재 tick 번호, 읽기 전용)
+    unsigned char *sensors;      // 센서 워드 (SENSOR_FRONT | ...), 로봇당 1바이트
+    RngState *rng;                 // 로봇별 난수 상태 (공유 rand() 잠금 회피)
+    unsigned int *pose_x;          // 자세 (Q8, 기본 단위 mm, 시작점 기준, 2^32 모듈러로 감김)
+    unsigned int *pose_y;
+    unsigned char *heading;
+    KinModel kin;
+} RVCFleet;
+
+// 가상 시계 모드 (SRS PDF p.2 "Tick: 제어 주기")
+typedef enum {
+    CLOCK_MODE_REALTIME,    // 실제 제어 주기에 맞춰 대기
+    CLOCK_MODE_FAST         // 대기 없이 최대 속도로 진행 (tick 시각 합성)
+} ClockMode;
+
+// 가상 시계 + 절대 데드라인 스케줄러
+// SRS PDF p.3-4 "P-1 제어주기: 50–100 ms", "P-2 반응시간 ≤ 150 ms"
+typedef struct {
+    ClockMode mode;
+    long long period_us;    // 제어 주기 (us)
+    long long start_us;     // 데드라인 격자 기준 (첫 tick 시작 전에는 clock_init 시점, 단조 시계)
+    bool anchored;          // 첫 tick이 start_us를 다시 잡았는지
+    long long now_us;       // 현재 tick의 시각 (시작 기준, us)
+    long long deadline_us;  // 현재 tick의 절대 데드라인 (단조 시계)
+    long long tick_start_us;    // 현재 tick의 실제 시작 시각 (단조 시계)
+    long long jitter_us;        // 현재 tick의 시작 지연 (실제 시작 - 데드라인)
+    long long jitter_sum_us;
+    long long jitter_max_us;
+    long long work_us;          // 현재 tick의 센서→액추에이터 처리 시간
+    long long work_max_us;      // 센서→액추에이터 최악 처리 시간
+    int missed_deadlines;       // 데드라인을 넘겨 시작한 tick 수
+    int ticks_done;
+} VirtualClock;
+
+// 반응 지연 히스토그램 (HDR 방식, 단위 ns)
+// 2의 거듭제곱 구간마다 2^LATENCY_SUB_BITS개의 하위 구간 → 상대 오차 1/32 이하, 크기 고정
+// SRS PDF p.3-4 "P-2 반응시간 ≤ 150 ms" 측정용
+#define LATENCY_SUB_BITS 5
+#define LATENCY_MAX_BITS 40     // 2^40 ns (약 18분) 이상은 마지막 구간에 포함
+#define LATENCY_BUCKETS ((LATENCY_MAX_BITS - LATENCY_SUB_BITS + 1) << LATENCY_SUB_BITS)
+typedef struct {
+    unsigned int counts[LATENCY_BUCKETS];
+    unsigned long long samples;
+    long long max_ns;
+} LatencyHistogram;
+
+// tick 단계: 센서 → 제어 → 액추에이터, 그리고 전체(반응 지연)
+typedef enum {
+    LATENCY_SENSE,      // tick 시작 → sensor_interface 완료
+    LATENCY_CONTROL,    // sensor_interface 완료 → fsm_executor 완료
+    LATENCY_ACTUATE,    // fsm_executor 완료 → actuator_interface 완료
+    LATENCY_REACTION,   // tick 시작 → actuator_interface 완료
+    LATENCY_STAGES
+} LatencyStage;
+
+// 단계별 + 상태별 반응 지연 (상태: tick 시작 시 FSM 상태)
+typedef struct {
+    LatencyHistogram stage[LATENCY_STAGES];
+    LatencyHistogram jitter;            // tick 시작 지연 (실시간 모드, 실제 시작 - 데드라인)
+    LatencyHistogram by_state[5];       // SystemState
+} LatencyStats;
+
+// 컴파일 시 로그 수준 (gcc -DRVC_LOG_LEVEL=N)
+// 꺼진 수준의 기록 코드는 전처리 단계에서 제거되어 분기도 포맷 문자열도 남지 않음
+#define RVC_LOG_NONE 0          // 로그 없음 (제품 펌웨어 / 벤치마크 빌드)
+#define RVC_LOG_TRANSITION 1    // FSM 전이와 회전 결정
+#define RVC_LOG_ACTUATOR 2      // + [MOTOR] / [CLEANER] 명령
+#define RVC_LOG_STATUS 3        // + tick별 상태 표시와 --sched-trace의 [SCHED] (디버그 빌드, 전체 trace)
+#ifndef RVC_LOG_LEVEL
+#define RVC_LOG_LEVEL RVC_LOG_STATUS
+#endif
+
+// 이벤트 로그 기록 종류
+typedef enum {
+    LOG_NODE_FSM,       // [FSM] 상태 전이 / 회전 결정
+    LOG_NODE_MOTOR,     // [MOTOR] 모터 명령 (이전 로그 파일 변환용)
+    LOG_NODE_CLEANER,   // [CLEANER] 청소기 명령 (이전 로그 파일 변환용)
+    LOG_NODE_STATUS,    // tick별 상태 표시 (print_status)
+    LOG_NODE_SCHED,     // [SCHED] tick별 jitter / 처리 시간 (--sched-trace)
+    LOG_NODE_OUTPUT,    // [MOTOR] / [CLEANER] 일괄 쓰기 (바뀐 명령만)
+    LOG_NODE_SKIP       // tickless로 건너뛴 구간 요약 (--tickless-summary, tick별 상태 표시 대신 1개)
+} LogNode;
+
+// 이벤트 로그 레코드 (고정 크기 바이너리, printf 대신 링 버퍼에 기록)
+// 문자열 포맷은 drain 스레드 또는 오프라인 디코더(--decode)가 수행
+typedef struct {
+    unsigned long long seq; // 전역 순번 (스레드별 링을 합칠 때 순서 복원, 64비트라 감기지 않음)
+    int tick;
+    int value;              // STATUS: 상태 지속 tick 수, SCHED: jitter (us), SKIP: 건너뛴 tick 수
+    int value2;             // SCHED: 처리 시간 (us)
+    unsigned char node;     // LogNode
+    unsigned char from;     // 이전 상태 (STATUS: 현재 상태, OUTPUT: 바뀐 액추에이터 비트)
+    unsigned char to;       // 다음 상태 (MOTOR/CLEANER: 명령, OUTPUT: 모터 명령)
+    unsigned char reason;   // 전이 메시지 번호 (STATUS: 센서 워드, OUTPUT: 청소기 명령)
+} LogRecord;
+
+// Tickless 실행: FSM별 다음 이벤트 (이벤트 큐 항목)
+// 이벤트 = 센서 입력이나 타이머 만료로 상태가 바뀔 수 있는 가장 이른 tick
+typedef struct {
+    long long tick;
+    int node;               // 이벤트를 낸 FSM (V1: FSM 하나)
+} TicklessEvent;
+
+#define TICKLESS_MAX_EVENTS 8
+typedef struct {
+    TicklessEvent heap[TICKLESS_MAX_EVENTS];    // 절대 tick 기준 최소 힙 (실행 내내 유지)
+    int count;
+    int pos[TICKLESS_MAX_EVENTS];   // 노드별 힙 위치 (-1: 예약 없음)
+    int key[TICKLESS_MAX_EVENTS];   // 노드별 예약 당시 상태 키 (바뀌면 다시 예약)
+    bool quiet[5];          // 타이머 만료 전에는 센서 입력과 무관하게 상태/명령이 그대로인 상태
+    long long stepped;      // FSM을 실제로 실행한 tick 수
+    long long skipped;      // 이벤트가 없어 건너뛴 tick 수
+    bool summary;           // 건너뛴 구간의 tick별 상태 표시 대신 요약 1개 (--tickless-summary)
+} TicklessEngine;
+
+// I/O 백엔드 (io.c): 센서 입력과 액추에이터 출력의 하드웨어 경계
+// local: 프로세스 안의 센서 모델 (기본), shm: 공유 메모리 링으로 하드웨어 시뮬레이터 프로세스와 연결
+typedef struct {
+    const char *name;
+    bool (*open)(unsigned long long seed);     // 시드: 센서 스트림 (local과 같은 프레임)
+    bool (*read_sensors)(SensorData *sensors, RngState *rng);  // false: 하드웨어 연결 끊김 (제어 루프 중단)
+    void (*write_actuators)(unsigned int changed, const int cmd[ACTUATOR_COUNT]);
+    void (*close)(void);
+} IoBackend;
+
+// 격자 환경 (env.c): 바닥 평면의 장애물 점유 격자
+// 8×8칸 타일 하나가 64비트 워드 1개 (비트 = 타일 안 행 × 8 + 열, 1 = 장애물)
+// 타일은 32×32 타일(256×256칸, 8 KB) 블록 안에서 Z-order(Morton) 순서, 블록은 행 우선
+// → 로봇 주변 수십 칸과 회전 후 탐지 지점이 지도 크기와 무관하게 캐시 라인 몇 개 안에 모임
+// 블록은 블록 오프셋 표로 찾음: 메모리에서 만든 지도는 연속 배열, 지도 파일(mapfile.c)은 mmap한 파일 안
+#define GRID_TILE_BITS 3        // 타일 한 변 8칸
+#define GRID_BLOCK_BITS 5       // 블록 한 변 32 타일
+#define GRID_BLOCK_WORDS (1 << (2 * GRID_BLOCK_BITS))
+typedef struct {
+    int width;              // 칸 수 (x)
+    int height;             // 칸 수 (y)
+    int cell_mm;            // 칸 한 변 (mm)
+    int blocks_x;           // 가로 블록 수
+    int blocks_y;
+    long long words;        // 64비트 워드 수 (블록 단위로 올림, 지도 밖 비트는 항상 0)
+    unsigned long long *occupied;   // 메모리에서 만든 지도의 블록 배열 (지도 파일이면 NULL, 읽기 전용)
+    const unsigned char *tile_base;             // 블록 오프셋의 기준 주소
+    const unsigned long long *block_offset;     // 블록 번호 → tile_base에서의 바이트 오프셋
+    void *mapping;          // 지도 파일 매핑 (munmap용, 메모리 지도면 NULL)
+    long long mapping_size;
+    long long free_cells;   // 장애물이 아닌 칸 수 (popcount로 계산)
+} GridMap;
+
+#define ENV_NOZZLE_MM 200       // 흡입구 폭 (로봇 중심의 정사각형 footprint 한 변, 청소 범위/먼지 제거)
+#define ENV_DUST_SENSE 48           // 먼지 센서: 로봇 중심 칸 밀도가 이 값 이상이면 감지
+#define ENV_DUST_PICKUP_NORMAL 6    // tick당 칸마다 제거하는 먼지 (일반 청소)
+#define ENV_DUST_PICKUP_TURBO 24    // (Power-Up 청소, SA PDF p.16)
+
+// 청소 범위 비트맵 (coverage.c): 지도와 같은 격자, 1 = 한 번 이상 청소한 칸
+// 매 tick 흡입구 footprint가 걸친 8×8칸 타일마다 워드 마스크로 갱신하고 새로 켜진 비트만 popcount로 누적
+typedef struct {
+    unsigned long long *cleaned;
+    long long cleaned_cells;    // 청소한 칸 수 (지도 전체를 다시 세지 않음)
+    long long swept_cells;      // 새로 지나간 칸 수 (직전 tick footprint와 겹치는 부분 제외)
+    long long recleaned_cells;  // 그중 이미 청소되어 있던 칸 수
+    long long ticks;
+    long long tick_90;          // 빈 칸의 90%를 처음 넘은 tick (-1: 아직)
+    long long time_90_us;       // 그때의 시각
+    long long time_us;          // 마지막 갱신 시각
+    int prev_x;                 // 직전 tick footprint 중심 (청소하지 않았으면 prev_valid = false)
+    int prev_y;
+    bool prev_valid;
+} CoverageMap;
+
+// 바닥 먼지 밀도 (dust.c): 칸마다 0~255, 64×64칸 타일 단위로 먼지가 있는 곳만 할당
+// 타일 하나 4 KB, 100 m² (1 cm)를 모두 채워도 1 MB, 다 치운 타일은 해제
+#define DUST_TILE_BITS 6
+#define DUST_TILE (1 << DUST_TILE_BITS)
+typedef struct {
+    int tiles_x;
+    int tiles_y;
+    unsigned char **tiles;      // 타일 디렉터리 (행 우선), NULL = 먼지 없음
+    unsigned int *tile_dust;    // 타일별 먼지 합 (0이 되면 타일 해제)
+    int live_tiles;             // 현재 할당된 타일 수
+    int peak_tiles;
+    long long deposited;        // 뿌린 먼지 총량
+    long long removed;          // 청소로 제거한 양
+    long long detections;       // 먼지 센서가 켜진 tick 수
+} DustField;
+
+// 격자 세계 지도 선택 (main에서 설정, io_grid_open에서 사용)
+typedef struct {
+    const char *map_path;   // 불러올 지도 파일 (NULL: 시드로 방 생성)
+    const char *save_path;  // 생성한 방을 저장할 지도 파일 (NULL: 저장 안 함)
+    int room_mm;            // 생성할 방 한 변
+} EnvOptions;
+
+// 격자 세계 (grid I/O 백엔드): 지도 + 로봇 1대
+// 모터 명령은 레지스터에 래치되어 다음 명령이 올 때까지 매 tick 적용 (실제 모터 드라이버와 같음)
+typedef struct {
+    GridMap map;
+    RobotPose pose;
+    int motor;              // 래치된 명령 (액추에이터 출력 단계가 바뀔 때만 씀)
+    int cleaner;
+    int probe[ENV_HEADINGS][2];     // 방향별 센서 탐지 지점 (로봇 중심 기준 칸 오프셋)
+    KinModel kin;                   // 1 tick 이동량 (Q8)
+    int body[ENV_HEADINGS][2];      // 방향별 몸체 앞 끝 (이동 충돌 검사)
+    long long moves;        // 이동한 tick 수
+    long long bumps;        // 장애물에 막혀 이동하지 못한 tick 수
+    CoverageMap coverage;
+    DustField dust;
+} GridWorld;
+
+// 공간 해시 (swarm.c): 지도를 버킷(정사각형)으로 나누고 버킷 좌표를 해시하여 2^bits칸 표에 담음
+// 표 칸마다 로봇 이중 연결 리스트 (노드 0..robots-1은 로봇, 그 뒤는 칸별 머리 노드)
+// 링크와 좌표를 노드 하나(16 B)에 두어 이웃을 따라갈 때 로봇마다 캐시 라인 하나만 읽음
+// 표 크기는 지도 넓이가 아니라 로봇 수에 비례하고, 버킷을 옮긴 로봇만 O(1)로 다시 연결
+typedef struct {
+    int next;
+    int prev;
+    int x;                  // tick 시작 시점 로봇 중심 칸 (감지/충돌 판정은 이 값만 읽음)
+    int y;
+} SwarmNode;
+
+typedef struct {
+    int robots;
+    int bits;
+    int bucket_cells;       // 버킷 한 변 (칸)
+    SwarmNode *nodes;
+    int *slot;              // 로봇이 든 표 칸
+    long long relinks;      // 버킷을 옮겨 다시 연결한 횟수
+} SpatialHash;
+
+// 공유 격자 세계 (swarm.c): fleet 로봇 전체가 한 지도에서 움직이고 서로를 장애물로 감지
+typedef struct {
+    bool enabled;           // false: fleet은 무작위 센서 모델 (지도 없음)
+    GridMap map;
+    SpatialHash hash;
+    int probe[ENV_HEADINGS][2];
+    int body[ENV_HEADINGS][2];
+    int radius_sq;          // 다른 로봇 몸체 판정 (중심 거리², 칸)
+    unsigned int *home_x;   // 시작 위치 (Q8 칸), fleet 자세는 여기서의 이동량
+    unsigned int *home_y;
+    unsigned int *bumps;    // 로봇별: 벽/가구에 막힌 tick 수
+    unsigned int *contacts; // 로봇별: 다른 로봇에 막힌 tick 수
+    unsigned char *ahead;   // 로봇별: 이번 tick 전진하면 다른 로봇과 겹침 (swarm_sense → swarm_move)
+    CoverageMap coverage;   // 로봇 전체가 함께 채우는 청소 범위
+    DustField dust;         // 로봇 전체가 함께 감지하고 치우는 먼지 (tick 안에서는 읽기만)
+    int *prev_x;            // 로봇별: 직전 tick footprint 중심 (coverage_sweep 재청소 제외)
+    int *prev_y;
+    unsigned char *prev_valid;
+} SwarmWorld;
+
+// 실행 설정 (명령행 옵션)
+typedef struct {
+    ClockMode clock_mode;
+    int ticks;
+    unsigned long long seed;    // 센서 난수 시드 (재현용)
+    int robots;             // 0: 단일 로봇, N: N대 일괄 실행 (fleet 모드)
+    int threads;            // fleet 모드 워커 스레드 수 (0: 모든 코어)
+    long long period_us;
+    const char *log_path;   // 이벤트 로그를 바이너리로 저장할 파일 (NULL: 텍스트로 stdout)
+    const char *decode_path;    // 저장된 이벤트 로그를 텍스트로 변환 (오프라인 디코더)
+    const char *io;         // I/O 백엔드 이름 (local / shm / grid)
+    const char *map_path;   // grid: 불러올 지도 파일
+    const char *map_save_path;  // grid: 생성한 방을 저장할 지도 파일
+    int room_m;             // grid: 생성할 방 한 변 (m)
+    bool tickless;          // 이벤트 사이의 변화 없는 tick을 건너뜀 (--fast 전용)
+    bool tickless_summary;  // tickless: 건너뛴 구간을 tick별 상태 표시 대신 요약 1개로 출력
+    bool explore;           // 도달 가능한 상태 공간을 탐색하여 deadlock/livelock 검사 후 종료
+    bool sched_trace;       // 실시간 모드: tick별 [SCHED] jitter / 처리 시간 출력
+} RunConfig;
+
+// FSM 전이 테이블 (fsm_table.c, 자동 생성)
+// 입력 워드 비트: 0=Front, 1=Left, 2=Right, 3=Dust
+extern const unsigned char fsm_v1_timer_limit[5];
+extern const char *const fsm_v1_messages[];
+extern const FsmEntry fsm_v1_table[5][16][2];
+
 // 전역 변수
 RVCContext rvc;
+extern const IoBackend *io_backend;  // io.c: 현재 I/O 백엔드 (--io)
+extern const IoBackend io_grid;      // env.c: 격자 세계 백엔드
+extern EnvOptions env_options;      // env.c: 격자 세계 지도 (--map / --save-map / --room-m)
+extern SwarmWorld swarm_world;      // swarm.c: fleet 공유 격자 세계 (--robots N --io grid)
+
+
+/* ========== 카운터 기반 난수 생성기 ========== */
+
+
+// 64비트 혼합 함수 (SplitMix64 finalizer, 전단사)
+unsigned long long rng_mix64(unsigned long long z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// 시드와 스트림 번호(로봇 번호)로 초기화
+// 같은 (seed, stream)이면 항상 같은 난수열 → 스레드 배치와 무관하게 재현 가능
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream) {
+    rng->key = rng_mix64(seed ^ (stream * 0xD1B54A32D192ED03ULL));
+    rng->counter = 0;
+}
+
+// 다음 64비트 난수: 출력 = mix(key + counter × γ)
+// 이전 출력에 의존하지 않는 카운터 기반 생성기라 잠금도 공유 상태도 없음
+unsigned long long rng_next(RngState *rng) {
+    rng->counter++;
+    return rng_mix64(rng->key + rng->counter * 0x9E3779B97F4A7C15ULL);
+}
 
+// n개를 뽑은 것과 같은 상태로 건너뜀 (카운터 기반이라 O(1))
+void rng_skip(RngState *rng, unsigned long long n) {
+    rng->counter += n;
+}
 
 /* ========== 센서 인터페이스 함수 ========== */
 
 
 
 
-// 실제 하드웨어 센서가 없어 제어 로직 테스트를 위해 랜덤 값 사용
+// 실제 하드웨어 센서가 없어 제어 로직 테스트를 위해 난수 사용
 // 20% 확률로 장애물 감지
 // 실제 구현 시에는 하드웨어 센서 핀에서 값을 읽어야 함
-void read_front_sensor(bool *value) {
+// 센서 프레임(64비트 난수 1개)을 16비트씩 잘라 각 센서가 자기 구간을 사용
+// 감지 시 해당 센서 비트(SENSOR_FRONT 등), 아니면 0을 반환
+SensorData read_front_sensor(unsigned long long frame) {
     // 시뮬레이션: 랜덤 장애물 감지
-    *value = (rand() % 10) < 2; 
+    return ((frame & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_FRONT;
 }
 
-void read_left_sensor(bool *value) {
-    *value = (rand() % 10) < 2;
+SensorData read_left_sensor(unsigned long long frame) {
+    return (((frame >> 16) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_LEFT;
 }
 
-void read_right_sensor(bool *value) {
-    *value = (rand() % 10) < 2;
+SensorData read_right_sensor(unsigned long long frame) {
+    return (((frame >> 32) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_RIGHT;
 }
 
-void read_dust_sensor(bool *value) {
-    *value = (rand() % 10) < 1;  // 10% 확률
+SensorData read_dust_sensor(unsigned long long frame) {
+    return (((frame >> 48) & 0xFFFF) < SENSOR_DUST_THRESHOLD) * SENSOR_DUST;  // 10% 확률
 }
 
 // 센서 인터페이스 (SA PDF p.7 DFD Level 1 "1.0 Sensor Interface & Preprocessing")
 // SA PDF p.18-19 Process Spec 1.0
 // SRS PDF p.2 FR-1.1 "Raw 센서값을 필터링"
-void sensor_interface(SensorData *sensors) {
-    read_front_sensor(&sensors->front);
-    read_left_sensor(&sensors->left);
-    read_right_sensor(&sensors->right);
-    read_dust_sensor(&sensors->dust);
+void sensor_interface(SensorData *sensors, RngState *rng) {
+    unsigned long long frame = rng_next(rng);  // tick당 난수 1회
+    // 센서별 비트를 OR 하여 4비트 워드로 묶음
+    *sensors = read_front_sensor(frame) | read_left_sensor(frame)
+             | read_right_sensor(frame) | read_dust_sensor(frame);
 }
 
+/* ========== FSM 전이 테이블 ========== */
 
-/* ========== 제어 로직 함수 ========== */
+// 주의: 이 파일은 fsm/fsm_spec.h에서 fsm_gen으로 자동 생성한 것입니다.
+//       전이 규칙은 fsm/fsm_spec.h에서 수정하세요.
+// 입력 워드 비트: 0=Front, 1=Left, 2=Right, 3=Dust
 
 
-// 모든 방향 막힘 확인 (SA PDF p.10 DFD Level 4 "2.1.2.3 All Blocked Handler")
-// SRS PDF p.3 FR-3.3 "좌/우 모두 불가 시"
-bool all_blocked(SensorData *sensors) {
-    return sensors->front && sensors->left && sensors->right;
-}
+// fsm_v1: 상태별 타이머 한계 (해당 상태 N tick째에 만료, 0: 없음)
+const unsigned char fsm_v1_timer_limit[5] = {
+    0,  // STATE_MOVING
+    2,  // STATE_TURNING
+    3,  // STATE_BACKWARDING
+    5,  // STATE_DUST_CLEANING
+    3,  // STATE_PAUSE
+};
 
-// 회전 우선순위 결정 (SA PDF p.31 Process Spec 2.1.2.2 "Turning Priority Decision")
-// SRS PDF p.3 FR-3.2 "Left 우선 규칙을 적용"
-// SRS PDF p.3 "좌/우 모두 가용 시 Left 우선"
-TurnDirection decide_turn_priority(SensorData *sensors) {
-    // 왼쪽 우선 정책
-    if (!sensors->left) {//좌측에 장애물이 없으면
-        return TURN_LEFT;//좌측으로 회전
-    } else if (!sensors->right) {//우측에 장애물이 없으면
-        return TURN_RIGHT;//우측으로 회전
-    } else {//좌측과 우측에 장애물이 모두 있으면
-        return TURN_NONE;//회전하지 않음
-    }
-}
+#if RVC_LOG_LEVEL >= RVC_LOG_TRANSITION
+const char *const fsm_v1_messages[11] = {
+    NULL,
+    "[FSM] MOVING -> DUST_CLEANING (dust detected)",
+    "[FSM] MOVING -> TURNING (front obstacle)",
+    "[FSM] TURNING -> BACKWARDING (all blocked)",
+    "[FSM] Turning LEFT (priority)",
+    "[FSM] TURNING -> MOVING (turn complete)",
+    "[FSM] Turning RIGHT",
+    "[FSM] TURNING -> PAUSE (no turn available)",
+    "[FSM] BACKWARDING -> TURNING (escape)",
+    "[FSM] DUST_CLEANING -> MOVING (clean complete)",
+    "[FSM] PAUSE -> BACKWARDING (deadlock escape)",
+};
+#endif
+
+// [상태][입력 워드][타이머 만료] → {다음 상태, 모터, 청소기, 타이머, 메시지}
+const FsmEntry fsm_v1_table[5][16][2] = {
+    {   // STATE_MOVING
+        {{STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}, {STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}},  // 0x00
+        {{STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}, {STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}},  // 0x01
+        {{STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}, {STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}},  // 0x02
+        {{STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}, {STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}},  // 0x03
+        {{STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}, {STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}},  // 0x04
+        {{STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}, {STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}},  // 0x05
+        {{STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}, {STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}},  // 0x06
+        {{STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}, {STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}},  // 0x07
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x08
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x09
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0a
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0b
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0c
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0d
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0e
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0f
+    },
+    {   // STATE_TURNING
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x00
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x01
+        {{STATE_TURNING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 0}}, {STATE_MOVING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 5}}},  // 0x02
+        {{STATE_TURNING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 0}}, {STATE_MOVING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 5}}},  // 0x03
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x04
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x05
+        {{STATE_PAUSE, FSM_KEEP, CLEANER_ON, 0, {7, 0}}, {STATE_PAUSE, FSM_KEEP, CLEANER_ON, 0, {7, 0}}},  // 0x06
+        {{STATE_BACKWARDING, FSM_KEEP, CLEANER_ON, 3, {3, 0}}, {STATE_BACKWARDING, FSM_KEEP, CLEANER_ON, 3, {3, 0}}},  // 0x07
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x08
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x09
+        {{STATE_TURNING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 0}}, {STATE_MOVING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 5}}},  // 0x0a
+        {{STATE_TURNING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 0}}, {STATE_MOVING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 5}}},  // 0x0b
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x0c
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x0d
+        {{STATE_PAUSE, FSM_KEEP, CLEANER_ON, 0, {7, 0}}, {STATE_PAUSE, FSM_KEEP, CLEANER_ON, 0, {7, 0}}},  // 0x0e
+        {{STATE_BACKWARDING, FSM_KEEP, CLEANER_ON, 3, {3, 0}}, {STATE_BACKWARDING, FSM_KEEP, CLEANER_ON, 3, {3, 0}}},  // 0x0f
+    },
+    {   // STATE_BACKWARDING
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x00
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x01
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x02
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x03
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x04
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x05
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x06
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x07
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x08
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x09
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0a
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0b
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0c
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0d
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0e
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0f
+    },
+    {   // STATE_DUST_CLEANING
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x00
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x01
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x02
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x03
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x04
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x05
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x06
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x07
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x08
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x09
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0a
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0b
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0c
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0d
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0e
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0f
+    },
+    {   // STATE_PAUSE
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x00
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x01
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x02
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x03
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x04
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x05
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x06
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x07
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x08
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x09
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0a
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0b
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0c
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0d
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0e
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0f
+    },
+};
+
+
+/* ========== 제어 로직 함수 ========== */
+
+
+// 함수 선언
+void evlog_emit(int node, int from, int to, int reason, int value, int value2);
 
 // FSM 실행기 (SA PDF p.7 "2.0 Control Logic & Command Generation")
 // SA PDF p.12 "FSM Version 1: 상태 전이도"
 // SRS PDF p.3 "3.3 상태기계 요구사항"
+// 전이 규칙은 fsm/fsm_spec.h에 선언하고 fsm_table.c로 생성함
+// → (상태, 센서 4비트, 타이머 만료) 테이블 한 칸을 읽어 다음 상태와 명령을 결정
 void fsm_executor(RVCContext *ctx) {
     ctx->state_duration++;//현재 상태의 tick 수
-    
-    switch (ctx->state) {
-        case STATE_MOVING:  // SA PDF p.11 "Moving: 정상 전진 및 청소 중"
-            // SA PDF p.13 상태 전이 테이블 "Moving" 행
-            ctx->motor_cmd = MOTOR_FORWARD;
-            ctx->cleaner_cmd = CLEANER_ON;
-            
-            // 상태 전이 조건
-            if (ctx->sensors.dust) {
-                // SRS PDF p.3 FR-5.1 "Dust_Exist 시 Boost 모드"
-                ctx->state = STATE_DUST_CLEANING;
-                ctx->dust_clean_timer = 5;  // 먼지 청소 상태를 5 tick 동안 유지
-                ctx->state_duration = 0; // 상태의 tick 수를 0으로 리셋
-                printf("[FSM] MOVING -> DUST_CLEANING (dust detected)\n");
-            } 
-            else if (ctx->sensors.front) {
-                // SA PDF p.13 "Moving → Turning (Front Obstacle)"
-                ctx->state = STATE_TURNING;
-                ctx->state_duration = 0;
-                printf("[FSM] MOVING -> TURNING (front obstacle)\n");
-            }
-            break;
-            
-        case STATE_TURNING:  // SA PDF p.11 "Turning: 장애물 회피 회전 중"
-            ctx->cleaner_cmd = CLEANER_ON;
-            
-            if (all_blocked(&ctx->sensors)) {
-                // SA PDF p.13 "Turning → Backwarding (All Blocked)"
-                // SRS PDF p.3 FR-3.3 "좌/우 모두 불가 시 Backward"
-                ctx->state = STATE_BACKWARDING;
-                ctx->backward_timer = 3;  // 후진 상태를 3 tick 동안 유지
-                ctx->state_duration = 0;
-                printf("[FSM] TURNING -> BACKWARDING (all blocked)\n");
-            } 
-            else {
-                TurnDirection turn = decide_turn_priority(&ctx->sensors);
-                // SA PDF p.31 "2.1.2.2 Turning Priority Decision"
-                if (turn == TURN_LEFT) {
-                    ctx->motor_cmd = MOTOR_TURN_LEFT;
-                    printf("[FSM] Turning LEFT (priority)\n");
-                } else if (turn == TURN_RIGHT) {
-                    ctx->motor_cmd = MOTOR_TURN_RIGHT;
-                    printf("[FSM] Turning RIGHT\n");
-                } else {
-                    ctx->state = STATE_PAUSE;
-                    // SA PDF p.11 "Pause: 일시 정지 (탈출 대기)"
-                    ctx->state_duration = 0; // 현재 상태에서 경과한 tick 수
-                    printf("[FSM] TURNING -> PAUSE (no turn available)\n");
-                }
-                
-                // 회전 완료 후 이동 상태로 복귀
-                if (ctx->state_duration >= 2 && turn != TURN_NONE) {
-                    ctx->state = STATE_MOVING;
-                    ctx->state_duration = 0;
-                    printf("[FSM] TURNING -> MOVING (turn complete)\n");
-                }
-            }
-            break;
-            
-        case STATE_BACKWARDING:  // SA PDF p.11 "Backwarding: 후진 중 (전방향 막힘)"
-            // SRS PDF p.3 FR-3.3 "Backward를 T_back 시간 수행"
-            // SRS PDF p.5 "T_back=600 ms"
-            ctx->motor_cmd = MOTOR_BACKWARD;
-            ctx->cleaner_cmd = CLEANER_ON;
-            ctx->backward_timer--;
-            
-            if (ctx->backward_timer <= 0) {
-                ctx->state = STATE_TURNING;
-                ctx->state_duration = 0;
-                printf("[FSM] BACKWARDING -> TURNING (escape)\n");
-            }
-            break;
-            
-        case STATE_DUST_CLEANING:  // SA PDF p.11 "Dust Cleaning: 먼지 집중 청소 (정지)"
-            // SRS PDF p.3 FR-5.2 "일정 시간/영역 청소 후 Normal 복귀"
-            ctx->motor_cmd = MOTOR_STOP;
-            ctx->cleaner_cmd = CLEANER_POWERUP;
-            ctx->dust_clean_timer--;
-            
-            if (ctx->dust_clean_timer <= 0) {
-                ctx->state = STATE_MOVING;
-                ctx->state_duration = 0;// 현재 상태에서 경과한 tick 수를 0으로 리셋
-                printf("[FSM] DUST_CLEANING -> MOVING (clean complete)\n");
-            }
-            break;
-            
-        case STATE_PAUSE:  // SA PDF p.3 "Stop 상태 Deadlock → Pause 상태로 분리"
-            ctx->motor_cmd = MOTOR_STOP;
-            ctx->cleaner_cmd = CLEANER_ON;
-            
-            // 데드락 탈출: 일시정지 후 후진 시도
-            // SRS PDF p.3 FR-4.1 "Deadlock_Suspect로 표식"
-            // SRS PDF p.3 FR-4.2 "Backward→Turn→Forward 시퀀스"
-            if (ctx->state_duration >= 3) {
-                ctx->state = STATE_BACKWARDING;
-                ctx->backward_timer = 3;  // 후진 상태를 3 tick 동안 유지
-                ctx->state_duration = 0;// 현재 상태에서 경과한 tick 수를 0으로 리셋
-                printf("[FSM] PAUSE -> BACKWARDING (deadlock escape)\n");
-            }
-            break;
+    // SRS PDF p.5 "T_back=600 ms", FR-5.2 집중 청소 시간
+    ctx->backward_timer -= ctx->state == STATE_BACKWARDING;
+    ctx->dust_clean_timer -= ctx->state == STATE_DUST_CLEANING;
+
+    int expired = ctx->state_duration >= fsm_v1_timer_limit[ctx->state];
+    const FsmEntry *e = &fsm_v1_table[ctx->state][ctx->sensors][expired];
+
+    if (e->motor != FSM_KEEP) {
+        ctx->motor_cmd = e->motor;
     }
-}
+    ctx->cleaner_cmd = e->cleaner;
 
+    if (e->reload) {
+        // 타이머가 있는 상태로 진입: 후진(FR-3.3) 또는 먼지 집중 청소(FR-5.1)
+        if (e->next == STATE_DUST_CLEANING) {
+            ctx->dust_clean_timer = e->reload;
+        } else {
+            ctx->backward_timer = e->reload;
+        }
+    }
+#if RVC_LOG_LEVEL >= RVC_LOG_TRANSITION
+    // 전이/회전 메시지는 바이너리 레코드로 기록 (텍스트 변환은 eventlog.c)
+    for (int k = 0; k < 2 && e->msg[k]; k++) {
+        evlog_emit(LOG_NODE_FSM, ctx->state, e->next, e->msg[k], 0, 0);
+    }
+#endif
+    if (e->next != ctx->state) {
+        ctx->state = e->next;
+        ctx->state_duration = 0; // 상태의 tick 수를 0으로 리셋
+    }
+}
 
 /* ========== 액추에이터 인터페이스 함수 ========== */
 
 
-// 모터 제어 (SA PDF p.7 "3.0 Actuator Interface")
-// SA PDF p.22-23 Process Spec 3.0
+// 함수 선언
+void evlog_emit(int node, int from, int to, int reason, int value, int value2);
+
+// 모터 명령 이름 (이벤트 로그 텍스트 변환용)
 // SRS PDF p.2 "Motor: Motor_Cmd -> {Forward, TurnLeft...}"
-void motor_control(MotorCommand cmd) {
+const char *motor_command_name(int cmd) {
     const char *direction;
     switch (cmd) {
         case MOTOR_FORWARD:   direction = "MOVE_FORWARD"; break;
@@ -264,12 +693,12 @@ void motor_control(MotorCommand cmd) {
         case MOTOR_STOP:      direction = "STOP"; break;
         default:              direction = "UNKNOWN"; break;
     }
-    printf("  [MOTOR] %s\n", direction);
+    return direction;
 }
 
-// 청소기 제어 (SA PDF p.22-23 Process Spec 3.0 "Actuator Interface")
+// 청소기 명령 이름 (이벤트 로그 텍스트 변환용)
 // SRS PDF p.2 "Cleaner: Clean_Cmd -> {Off, Normal, Boost}"
-void cleaner_control(CleanerCommand cmd) {
+const char *cleaner_command_name(int cmd) {
     const char *clean_cmd;
     switch (cmd) {
         case CLEANER_OFF:     clean_cmd = "VACUUM_OFF"; break;
@@ -277,79 +706,3750 @@ void cleaner_control(CleanerCommand cmd) {
         case CLEANER_POWERUP: clean_cmd = "VACUUM_TURBO"; break;
         default:              clean_cmd = "UNKNOWN"; break;
     }
-    printf("  [CLEANER] %s\n", clean_cmd);
+    return clean_cmd;
+}
+
+// 일괄 쓰기 1회 (SA PDF p.7 "3.0 Actuator Interface")
+// 바뀐 액추에이터의 명령을 I/O 백엔드에 한 번에 쓰고 trace에 기록
+void actuator_write(unsigned int changed, const int cmd[ACTUATOR_COUNT]) {
+    io_backend->write_actuators(changed, cmd);
+#if RVC_LOG_LEVEL >= RVC_LOG_ACTUATOR
+    evlog_emit(LOG_NODE_OUTPUT, changed, cmd[ACTUATOR_MOTOR], cmd[ACTUATOR_CLEANER], 0, 0);
+#endif
+}
+
+// 출력 단계: 마지막으로 내보낸 명령과 비교하여 바뀐 명령만 모아 tick당 최대 1회 쓰기
+void actuator_commit(ActuatorOutput *out, const int cmd[ACTUATOR_COUNT]) {
+    unsigned int changed = 0;
+    for (int a = 0; a < ACTUATOR_COUNT; a++) {
+        if (!out->committed || cmd[a] != out->last[a]) {
+            changed |= 1u << a;
+            out->last[a] = cmd[a];
+            out->emitted[a]++;
+        } else {
+            out->suppressed[a]++;
+        }
+    }
+    out->committed = true;
+    if (changed) {
+        out->writes++;
+        actuator_write(changed, cmd);
+    }
 }
 
+// 액추에이터 인터페이스 (SA PDF p.22-23 Process Spec 3.0)
 void actuator_interface(RVCContext *ctx) {
-    motor_control(ctx->motor_cmd);
-    cleaner_control(ctx->cleaner_cmd);
+    int cmd[ACTUATOR_COUNT];
+    cmd[ACTUATOR_MOTOR] = ctx->motor_cmd;
+    cmd[ACTUATOR_CLEANER] = ctx->cleaner_cmd;
+    actuator_commit(&ctx->output, cmd);
 }
 
+// 조용한 구간 n tick의 출력 (tickless, tick별 출력이 없는 로그 수준)
+// 구간 안에서는 명령이 바뀌지 않으므로 첫 tick만 비교하고 나머지는 생략으로 집계
+void actuator_skip(RVCContext *ctx, int ticks) {
+    actuator_interface(ctx);
+    for (int a = 0; a < ACTUATOR_COUNT; a++) {
+        ctx->output.suppressed[a] += ticks - 1;
+    }
+}
 
-/* ========== 메인 제어 루프 ========== */
+void actuator_report(const ActuatorOutput *out) {
+    long long ticks = out->emitted[ACTUATOR_MOTOR] + out->suppressed[ACTUATOR_MOTOR];
+    printf("Actuator output: %lld writes in %lld ticks (motor %lld emitted / %lld suppressed, "
+           "cleaner %lld emitted / %lld suppressed)\n",
+           out->writes, ticks,
+           out->emitted[ACTUATOR_MOTOR], out->suppressed[ACTUATOR_MOTOR],
+           out->emitted[ACTUATOR_CLEANER], out->suppressed[ACTUATOR_CLEANER]);
+}
 
+/* ========== I/O 백엔드 (센서 입력 / 액추에이터 출력의 하드웨어 경계) ========== */
 
 
 
+#ifndef _WIN32
+#include <stdatomic.h>
+#include <sched.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif
 
-// 전역 변수 정의
-RVCContext rvc;
+#define IO_RING_SLOTS 256       // 링 크기 (2의 거듭제곱, 시뮬레이터는 최대 이만큼 앞서 센서 프레임을 채움)
+#define IO_CHECK_SPINS 1024     // 링에서 기다리는 동안 상대 프로세스가 살아 있는지 확인하는 간격 (양보 횟수)
 
-// 시스템 초기화 (SA PDF p.20-21 Process Spec 2.0 "INITIALIZE CN1_State")
-void initialize_system() {
-    srand(time(NULL));
-    rvc.state = STATE_MOVING;
-    rvc.tick_count = 0;  // SRS PDF p.2 "Tick: 제어 주기"
-    rvc.state_duration = 0;
-    rvc.dust_clean_timer = 0;
-    rvc.backward_timer = 0;
-    rvc.motor_cmd = MOTOR_FORWARD;
-    rvc.cleaner_cmd = CLEANER_ON;
-    printf("=== RVC Control System V1 (Single FSM) Started ===\n\n");
+// 함수 선언
+void sensor_interface(SensorData *sensors, RngState *rng);
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+
+// ---------- local: 프로세스 안의 센서 모델 (기본) ----------
+
+bool io_local_open(unsigned long long seed) {
+    (void)seed;
+    return true;
 }
 
-void print_status(RVCContext *ctx) {
-    const char *state_names[] = {
-        "MOVING", "TURNING", "BACKWARDING", "DUST_CLEANING", "PAUSE"
-    };
-    
-    printf("\n--- Tick %d ---\n", ctx->tick_count);
-    printf("State: %s (duration: %d)\n", 
-           state_names[ctx->state], ctx->state_duration);
-    printf("Sensors: F=%d L=%d R=%d D=%d\n",
-           ctx->sensors.front, ctx->sensors.left, 
-           ctx->sensors.right, ctx->sensors.dust);
+bool io_local_read(SensorData *sensors, RngState *rng) {
+    sensor_interface(sensors, rng);
+    return true;
 }
 
-// 메인 함수 (SA PDF p.6 "RVC Control (0)" 전체 시스템)
-// SRS PDF p.3-4 "P-1 제어주기: 50–100 ms"
-int main(void) {
-    initialize_system();
-    
-    // 시뮬레이션 루프: 50 ticks
-    for (int i = 0; i < 50; i++) {
-        rvc.tick_count = i;
-        
-        // 1. 센서 인터페이스 (SA PDF p.18-19 Process 1.0)
-        sensor_interface(&rvc.sensors);
-        
-        // 2. 제어 로직 (FSM) (SA PDF p.20-21 Process 2.0)
-        fsm_executor(&rvc);
-        
-        // 3. 액추에이터 인터페이스 (SA PDF p.22-23 Process 3.0)
-        actuator_interface(&rvc);
-        
-        // 4. 상태 표시
-        print_status(&rvc);
-        
-        // Tick 지연 시뮬레이션
-        #ifndef _WIN32
-        usleep(200000);  // 200ms - SRS PDF p.3 "P-2 반응시간 ≤ 150 ms"
-        #endif
+void io_local_write(unsigned int changed, const int cmd[ACTUATOR_COUNT]) {
+    (void)changed;
+    (void)cmd;
+}
+
+void io_local_close(void) {
+}
+
+const IoBackend io_local = {
+    "local", io_local_open, io_local_read, io_local_write, io_local_close
+};
+
+#ifndef _WIN32
+
+// ---------- shm: POSIX 공유 메모리 링 + 하드웨어 시뮬레이터 프로세스 ----------
+
+// 액추에이터 명령 1건 (actuator_write의 일괄 쓰기 1회)
+typedef struct {
+    unsigned int changed;       // 바뀐 액추에이터 비트
+    int cmd[ACTUATOR_COUNT];
+} IoCommand;
+
+// 제어기와 시뮬레이터가 함께 매핑하는 영역
+// 링마다 생산자 하나/소비자 하나, head/tail을 캐시 라인으로 분리 → 빠른 경로는 원자적 load/store뿐
+typedef struct {
+    _Alignas(64) atomic_uint sensor_head;   // 제어기가 읽은 센서 프레임 수
+    _Alignas(64) atomic_uint sensor_tail;   // 시뮬레이터가 쓴 센서 프레임 수
+    _Alignas(64) atomic_uint cmd_head;      // 시뮬레이터가 적용한 명령 수
+    _Alignas(64) atomic_uint cmd_tail;      // 제어기가 쓴 명령 수
+    _Alignas(64) atomic_bool stop;          // 제어기 → 시뮬레이터: 남은 명령 적용 후 종료
+    int motor;                  // 시뮬레이터의 액추에이터 레지스터 (마지막 적용 명령)
+    int cleaner;
+    unsigned int idle_waits;    // 시뮬레이터: 센서 링이 가득 차고 새 명령이 없어 쉰 횟수
+    SensorData sensors[IO_RING_SLOTS];
+    IoCommand cmds[IO_RING_SLOTS];
+} IoShared;
+
+typedef struct {
+    IoShared *shared;
+    pid_t simulator;
+    bool lost;                  // 시뮬레이터가 먼저 종료됨 (이미 회수, 이후 읽기/쓰기는 실패)
+    unsigned int sensor_waits;  // 제어기: 센서 프레임이 아직 없어 기다린 횟수
+    unsigned int cmd_waits;     // 제어기: 명령 링이 가득 차 기다린 횟수
+} IoShm;
+
+IoShm io_shm;
+
+// 하드웨어 시뮬레이터 (fork한 자식 프로세스)
+// 센서: local 백엔드와 같은 스트림(시드, 스트림 0)으로 프레임을 만들어 링을 채움 → 같은 trace
+// 액추에이터: 명령을 레지스터에 적용
+// 제어기가 stop 없이 죽으면 (부모가 바뀜) 기다리지 않고 종료
+void io_simulator_main(IoShared *sh, unsigned long long seed, pid_t parent) {
+    RngState rng;
+    rng_seed(&rng, seed, 0);
+    unsigned int tail = 0, head = 0;
+    int idle_spins = 0;
+
+    for (;;) {
+        bool idle = true;
+        // 센서 링: 빈 칸이 있으면 다음 프레임
+        if (tail - atomic_load_explicit(&sh->sensor_head, memory_order_acquire) < IO_RING_SLOTS) {
+            sensor_interface(&sh->sensors[tail & (IO_RING_SLOTS - 1)], &rng);
+            atomic_store_explicit(&sh->sensor_tail, ++tail, memory_order_release);
+            idle = false;
+        }
+        // 명령 링: 도착한 명령 적용
+        while (head != atomic_load_explicit(&sh->cmd_tail, memory_order_acquire)) {
+            const IoCommand *c = &sh->cmds[head & (IO_RING_SLOTS - 1)];
+            if (c->changed & (1u << ACTUATOR_MOTOR)) {
+                sh->motor = c->cmd[ACTUATOR_MOTOR];
+            }
+            if (c->changed & (1u << ACTUATOR_CLEANER)) {
+                sh->cleaner = c->cmd[ACTUATOR_CLEANER];
+            }
+            atomic_store_explicit(&sh->cmd_head, ++head, memory_order_release);
+            idle = false;
+        }
+        if (idle) {
+            // stop은 명령 링을 모두 비운 뒤에만 확인 (제어기가 마지막 명령을 쓴 뒤 stop을 세움)
+            if (atomic_load_explicit(&sh->stop, memory_order_acquire) &&
+                head == atomic_load_explicit(&sh->cmd_tail, memory_order_acquire)) {
+                break;
+            }
+            sh->idle_waits++;
+            // 잠깐은 양보만 하고, 오래 쉬면 잠듦 (실시간 모드에서 주기 내내 CPU를 쓰지 않게)
+            if (++idle_spins < 1000) {
+                sched_yield();
+            } else {
+                if (getppid() != parent) {
+                    break;
+                }
+                usleep(50);
+            }
+        } else {
+            idle_spins = 0;
+        }
     }
-    
-    printf("\n=== Simulation Complete ===\n");
-    return 0;
 }
 
+// 공유 메모리를 만들고 시뮬레이터 프로세스 시작
+// 이름은 fork 직후 지움: 두 프로세스는 매핑으로 계속 공유하고, 비정상 종료해도 /dev/shm에 남지 않음
+bool io_shm_open(unsigned long long seed) {
+    char name[64];
+    snprintf(name, sizeof(name), "/rvc-io-%d", (int)getpid());
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        perror("shm_open");
+        return false;
+    }
+    if (ftruncate(fd, sizeof(IoShared)) != 0) {
+        perror("ftruncate");
+        close(fd);
+        shm_unlink(name);
+        return false;
+    }
+    IoShared *sh = mmap(NULL, sizeof(IoShared), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (sh == MAP_FAILED) {
+        perror("mmap");
+        shm_unlink(name);
+        return false;
+    }
+    memset(sh, 0, sizeof(*sh));     // ftruncate로 0이지만 원자 변수는 명시적으로 초기화
+    atomic_init(&sh->sensor_head, 0);
+    atomic_init(&sh->sensor_tail, 0);
+    atomic_init(&sh->cmd_head, 0);
+    atomic_init(&sh->cmd_tail, 0);
+    atomic_init(&sh->stop, false);
+
+    fflush(NULL);   // 자식이 부모의 출력 버퍼를 물려받지 않도록
+    pid_t parent = getpid();
+    pid_t pid = fork();
+    if (pid == 0) {
+        io_simulator_main(sh, seed, parent);
+        _exit(0);
+    }
+    shm_unlink(name);
+    if (pid < 0) {
+        perror("fork");
+        munmap(sh, sizeof(IoShared));
+        return false;
+    }
+    io_shm.shared = sh;
+    io_shm.simulator = pid;
+    io_shm.lost = false;
+    return true;
+}
+
+// 링에서 IO_CHECK_SPINS번 양보할 때마다 호출: 시뮬레이터가 이미 종료했으면 회수하고 false
+// (죽은 시뮬레이터는 링을 다시 움직이지 않으므로 계속 기다리면 제어기가 멈춤)
+bool io_shm_alive(void) {
+    if (!io_shm.lost && waitpid(io_shm.simulator, NULL, WNOHANG) != 0) {
+        fprintf(stderr, "I/O backend: shm simulator (pid %d) exited; stopping\n",
+                (int)io_shm.simulator);
+        io_shm.lost = true;
+    }
+    return !io_shm.lost;
+}
+
+// 센서 프레임 읽기: 링 칸에서 바로 읽음 (복사 없음, 시스템 호출 없음)
+// 프레임이 아직 없을 때만 양보하며 기다림, 시뮬레이터가 종료했으면 false
+bool io_shm_read(SensorData *sensors, RngState *rng) {
+    IoShared *sh = io_shm.shared;
+    unsigned int head = atomic_load_explicit(&sh->sensor_head, memory_order_relaxed);
+    unsigned int spins = 0;
+    (void)rng;
+    while (atomic_load_explicit(&sh->sensor_tail, memory_order_acquire) == head) {
+        if (io_shm.lost || (++spins % IO_CHECK_SPINS == 0 && !io_shm_alive())) {
+            return false;
+        }
+        io_shm.sensor_waits++;
+        sched_yield();
+    }
+    *sensors = sh->sensors[head & (IO_RING_SLOTS - 1)];
+    atomic_store_explicit(&sh->sensor_head, head + 1, memory_order_release);
+    return true;
+}
+
+// 명령 게시: 링 칸에 쓰고 tail 갱신 (시스템 호출 없음)
+// 시뮬레이터가 종료했으면 버림 (다음 센서 읽기가 실패해 제어 루프가 멈춤)
+void io_shm_write(unsigned int changed, const int cmd[ACTUATOR_COUNT]) {
+    IoShared *sh = io_shm.shared;
+    unsigned int tail = atomic_load_explicit(&sh->cmd_tail, memory_order_relaxed);
+    unsigned int spins = 0;
+    while (tail - atomic_load_explicit(&sh->cmd_head, memory_order_acquire) >= IO_RING_SLOTS) {
+        if (io_shm.lost || (++spins % IO_CHECK_SPINS == 0 && !io_shm_alive())) {
+            return;
+        }
+        io_shm.cmd_waits++;
+        sched_yield();
+    }
+    IoCommand *c = &sh->cmds[tail & (IO_RING_SLOTS - 1)];
+    c->changed = changed;
+    for (int a = 0; a < ACTUATOR_COUNT; a++) {
+        c->cmd[a] = cmd[a];
+    }
+    atomic_store_explicit(&sh->cmd_tail, tail + 1, memory_order_release);
+}
+
+// 시뮬레이터 종료 대기 후 통계 출력, 공유 메모리 해제
+void io_shm_close(void) {
+    IoShared *sh = io_shm.shared;
+    if (!sh) {
+        return;
+    }
+    atomic_store_explicit(&sh->stop, true, memory_order_release);
+    if (!io_shm.lost) {
+        waitpid(io_shm.simulator, NULL, 0);
+    }
+    printf("I/O backend: shm, %u sensor frames read, %u commands applied "
+           "(motor=%d, cleaner=%d), controller waits: sensor %u, command %u, simulator idle %u\n",
+           atomic_load(&sh->sensor_head), atomic_load(&sh->cmd_head),
+           sh->motor, sh->cleaner, io_shm.sensor_waits, io_shm.cmd_waits, sh->idle_waits);
+    munmap(sh, sizeof(IoShared));
+    io_shm.shared = NULL;
+}
+
+const IoBackend io_shm_backend = {
+    "shm", io_shm_open, io_shm_read, io_shm_write, io_shm_close
+};
+
+#endif
+
+// 현재 백엔드 (main의 --io로 선택, 벤치마크 등 그 외에는 local)
+const IoBackend *io_backend = &io_local;
+
+// 이름으로 백엔드 선택, 없는 이름이면 false
+bool io_select(const char *name) {
+    if (strcmp(name, io_local.name) == 0) {
+        io_backend = &io_local;
+        return true;
+    }
+    if (strcmp(name, io_grid.name) == 0) {
+        io_backend = &io_grid;
+        return true;
+    }
+#ifndef _WIN32
+    if (strcmp(name, io_shm_backend.name) == 0) {
+        io_backend = &io_shm_backend;
+        return true;
+    }
+#endif
+    fprintf(stderr, "Unknown I/O backend: %s\n", name);
+    return false;
+}
+
+/* ========== 운동학 (모터 명령 → 자세, 고정소수점) ========== */
+/*
+ * 자세는 Q8 (1/256 단위) 정수, 방향은 45° 단위 8방향 (SRS PDF p.3 FR-3.2 "45° 회전")
+ * 방향별 이동량은 Q15 cos/sin 표로 kin_init에서 한 번만 계산하고, 매 tick 갱신은 덧셈뿐
+ * 부동소수점을 쓰지 않으므로 컴파일러/플랫폼과 무관하게 같은 궤적
+ */
+
+
+#define KIN_Q15 15
+
+// 방향별 cos/sin (Q15, 0: +x, 1씩 시계 방향, y는 아래로 증가), 23170 = round(2^15 / √2)
+const int kin_cos[ENV_HEADINGS] = {32768, 23170, 0, -23170, -32768, -23170, 0, 23170};
+const int kin_sin[ENV_HEADINGS] = {0, 23170, 32768, 23170, 0, -23170, -32768, -23170};
+
+// d × c (Q15) 반올림, 부호와 크기를 나눠 계산 → 반대 방향 이동량이 정확히 부호만 다름
+int kin_scale(long long d, int c) {
+    int len = (int)((d * (c < 0 ? -c : c) + (1 << (KIN_Q15 - 1))) >> KIN_Q15);
+    return c < 0 ? -len : len;
+}
+
+// 모델 준비: tick당 step_mm 이동, 자세 단위는 unit_mm의 1/256
+void kin_init(KinModel *kin, int step_mm, int unit_mm) {
+    long long d = ((long long)step_mm << KIN_FRAC_BITS) / unit_mm;
+    for (int h = 0; h < ENV_HEADINGS; h++) {
+        kin->step[h][0] = kin_scale(d, kin_cos[h]);
+        kin->step[h][1] = kin_scale(d, kin_sin[h]);
+    }
+    kin->unit_mm = unit_mm;
+}
+
+// 모터 명령 1 tick 적용 (충돌 검사 없음): 전진/후진은 이동량 ±, 회전은 45°, 정지는 그대로
+RobotPose kin_next(const KinModel *kin, RobotPose p, int motor) {
+    switch (motor) {
+        case MOTOR_FORWARD:
+            p.x += kin->step[p.heading][0];
+            p.y += kin->step[p.heading][1];
+            break;
+        case MOTOR_BACKWARD:
+            p.x -= kin->step[p.heading][0];
+            p.y -= kin->step[p.heading][1];
+            break;
+        case MOTOR_TURN_LEFT:  p.heading = (p.heading + 7) & 7; break;
+        case MOTOR_TURN_RIGHT: p.heading = (p.heading + 1) & 7; break;
+        default:             break;
+    }
+    return p;
+}
+
+// [begin, end) 구간 로봇들에 이번 tick 모터 명령 적용 (kin_next와 같은 결과)
+// 방향 부호는 비교 연산으로, 길이는 직선/대각선 두 값의 선택으로 구해 표 조회(gather) 없이 벡터화
+void kin_fleet_step(RVCFleet *fleet, int begin, int end) {
+    const unsigned char *command = fleet->motor_cmd;
+    unsigned int *pose_x = fleet->pose_x;
+    unsigned int *pose_y = fleet->pose_y;
+    unsigned char *heading = fleet->heading;
+    int straight = fleet->kin.step[0][0];
+    int diagonal = fleet->kin.step[1][0];
+
+    #pragma GCC ivdep
+    for (int i = begin; i < end; i++) {
+        int c = command[i];
+        int h = heading[i];
+        int move = (c == MOTOR_FORWARD) - (c == MOTOR_BACKWARD);
+        int turn = (c == MOTOR_TURN_RIGHT) - (c == MOTOR_TURN_LEFT);
+        int dir_x = (((h + 1) & 7) < 3) - (((h + 5) & 7) < 3);
+        int dir_y = (((h + 7) & 7) < 3) - (((h + 3) & 7) < 3);
+        int len = straight + (h & 1) * (diagonal - straight);
+        pose_x[i] += (unsigned int)(move * dir_x * len);
+        pose_y[i] += (unsigned int)(move * dir_y * len);
+        heading[i] = (unsigned char)((h + turn) & 7);
+    }
+}
+
+/* ========== 격자 환경 (점유 비트보드 + 로봇 자세) ========== */
+
+
+
+
+#define ENV_ROOM_MM 10000           // 생성하는 방 한 변 기본값 (10 m × 10 m, --room-m)
+#define ENV_CELL_MM 10              // 격자 해상도 (1 cm)
+#define ENV_WALL_MM 50              // 벽 두께
+#define ENV_FURNITURE 12            // 방 안에 놓는 가구(직사각형 장애물) 수
+#define ENV_FURNITURE_MIN_MM 300
+#define ENV_FURNITURE_MAX_MM 1000
+#define ENV_MAP_STREAM 0xE11        // 지도 생성 난수 스트림 (로봇 센서 스트림과 겹치지 않게)
+
+// 함수 선언
+unsigned long long rng_next(RngState *rng);
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+bool coverage_init(CoverageMap *cov, const GridMap *map);
+void coverage_free(CoverageMap *cov);
+void coverage_update(CoverageMap *cov, const GridMap *map, int x, int y,
+                     bool cleaning, long long time_us);
+void coverage_report(const CoverageMap *cov, const GridMap *map);
+bool dust_init(DustField *dust, const GridMap *map);
+void dust_free(DustField *dust);
+bool dust_scatter(DustField *dust, const GridMap *map, unsigned long long seed);
+int dust_at(const DustField *dust, int x, int y);
+void dust_clean(DustField *dust, const GridMap *map, int x, int y, int pickup);
+void dust_report(const DustField *dust);
+bool grid_save(const GridMap *map, const char *path);
+bool grid_map_file(GridMap *map, const char *path);
+void grid_unmap_file(GridMap *map);
+void grid_free(GridMap *map);
+void kin_init(KinModel *kin, int step_mm, int unit_mm);
+RobotPose kin_next(const KinModel *kin, RobotPose p, int motor);
+
+// 방향별 단위 벡터 (y는 아래로 증가, 방향 번호가 늘면 시계 방향)
+const int env_dir[ENV_HEADINGS][2] = {
+    {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}
+};
+
+// 5비트 타일 좌표 → Morton 번호의 짝수 비트 (x는 그대로, y는 1비트 올려 OR)
+const unsigned short grid_morton[1 << GRID_BLOCK_BITS] = {
+    0, 1, 4, 5, 16, 17, 20, 21,
+    64, 65, 68, 69, 80, 81, 84, 85,
+    256, 257, 260, 261, 272, 273, 276, 277,
+    320, 321, 324, 325, 336, 337, 340, 341,
+};
+
+// 메모리 지도: 블록을 연속 배열에 두고 블록 오프셋 표는 블록 번호 × 8 KB
+bool grid_init(GridMap *map, int width, int height, int cell_mm) {
+    int block_cells = 1 << (GRID_BLOCK_BITS + GRID_TILE_BITS);
+    map->width = width;
+    map->height = height;
+    map->cell_mm = cell_mm;
+    map->blocks_x = (width + block_cells - 1) / block_cells;
+    map->blocks_y = (height + block_cells - 1) / block_cells;
+    map->words = (long long)map->blocks_x * map->blocks_y * GRID_BLOCK_WORDS;
+    map->occupied = calloc((size_t)map->words, sizeof(unsigned long long));
+    map->mapping = NULL;
+    map->mapping_size = 0;
+    map->free_cells = (long long)width * height;
+
+    long long blocks = (long long)map->blocks_x * map->blocks_y;
+    unsigned long long *offsets = malloc((size_t)blocks * sizeof(unsigned long long));
+    for (long long b = 0; offsets && b < blocks; b++) {
+        offsets[b] = (unsigned long long)b * GRID_BLOCK_WORDS * sizeof(unsigned long long);
+    }
+    map->tile_base = (const unsigned char *)map->occupied;
+    map->block_offset = offsets;
+    if (!map->occupied || !offsets) {
+        grid_free(map);
+        return false;
+    }
+    return true;
+}
+
+void grid_free(GridMap *map) {
+    if (map->mapping) {
+        grid_unmap_file(map);
+    } else {
+        free(map->occupied);
+        free((void *)map->block_offset);
+    }
+    map->occupied = NULL;
+    map->tile_base = NULL;
+    map->block_offset = NULL;
+}
+
+// (x, y) 칸이 든 타일 워드: 블록 번호 + 블록 안 Morton 번호
+size_t grid_word(const GridMap *map, int x, int y) {
+    int tx = x >> GRID_TILE_BITS, ty = y >> GRID_TILE_BITS;
+    size_t block = (size_t)(ty >> GRID_BLOCK_BITS) * map->blocks_x + (tx >> GRID_BLOCK_BITS);
+    return block << (2 * GRID_BLOCK_BITS)
+         | grid_morton[tx & ((1 << GRID_BLOCK_BITS) - 1)]
+         | (size_t)grid_morton[ty & ((1 << GRID_BLOCK_BITS) - 1)] << 1;
+}
+
+// grid_word 번호의 타일 워드 (블록 오프셋 표 → 블록 안 워드)
+unsigned long long grid_tile(const GridMap *map, size_t word) {
+    const unsigned long long *block = (const unsigned long long *)
+        (map->tile_base + map->block_offset[word / GRID_BLOCK_WORDS]);
+    return block[word & (GRID_BLOCK_WORDS - 1)];
+}
+
+// 칸 조회: 지도 밖은 장애물 (블록 오프셋 + 워드 load, 분기 1개)
+int grid_occupied(const GridMap *map, int x, int y) {
+    if ((unsigned)x >= (unsigned)map->width || (unsigned)y >= (unsigned)map->height) {
+        return 1;
+    }
+    return (int)(grid_tile(map, grid_word(map, x, y)) >> (((y & 7) << 3) | (x & 7))) & 1;
+}
+
+// 타일 열 tx에서 [x0, x1)에 드는 열 비트를 8행 모두에 복제한 마스크 (겹치지 않으면 0)
+unsigned long long grid_tile_cols(int tx, int x0, int x1) {
+    int ox = tx << GRID_TILE_BITS;
+    int lo = (x0 > ox ? x0 : ox) - ox, hi = (x1 < ox + 8 ? x1 : ox + 8) - ox;
+    if (lo >= hi) {
+        return 0;
+    }
+    return (((1ULL << (hi - lo)) - 1) << lo) * 0x0101010101010101ULL;
+}
+
+// 타일 행 ty에서 [y0, y1)에 드는 행 전체의 마스크 (겹치지 않으면 0)
+unsigned long long grid_tile_rows(int ty, int y0, int y1) {
+    int oy = ty << GRID_TILE_BITS;
+    int top = (y0 > oy ? y0 : oy) - oy, bottom = (y1 < oy + 8 ? y1 : oy + 8) - oy;
+    if (top >= bottom) {
+        return 0;
+    }
+    return bottom - top == 8 ? ~0ULL : ((1ULL << 8 * (bottom - top)) - 1) << 8 * top;
+}
+
+// [x0, x1) × [y0, y1) 직사각형을 장애물로 채움 (지도 밖은 잘라냄, 타일마다 워드 마스크 1회)
+void grid_fill_rect(GridMap *map, int x0, int y0, int x1, int y1) {
+    x0 = x0 < 0 ? 0 : x0;
+    y0 = y0 < 0 ? 0 : y0;
+    x1 = x1 > map->width ? map->width : x1;
+    y1 = y1 > map->height ? map->height : y1;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    for (int ty = y0 >> GRID_TILE_BITS; ty <= (y1 - 1) >> GRID_TILE_BITS; ty++) {
+        for (int tx = x0 >> GRID_TILE_BITS; tx <= (x1 - 1) >> GRID_TILE_BITS; tx++) {
+            map->occupied[grid_word(map, tx << GRID_TILE_BITS, ty << GRID_TILE_BITS)]
+                |= grid_tile_cols(tx, x0, x1) & grid_tile_rows(ty, y0, y1);
+        }
+    }
+}
+
+// 빈 칸 수 갱신: 워드마다 popcount (지도 바깥 여분 비트는 항상 0)
+void grid_count_free(GridMap *map) {
+    long long occupied = 0;
+    for (long long i = 0; i < map->words; i++) {
+        occupied += __builtin_popcountll(map->occupied[i]);
+    }
+    map->free_cells = (long long)map->width * map->height - occupied;
+}
+
+// 방 생성: 테두리 벽 + 무작위 가구, 시작 위치(중앙) 주변은 비워 둠
+bool grid_generate_room(GridMap *map, int room_mm, int cell_mm, unsigned long long seed) {
+    int cells = room_mm / cell_mm;
+    int wall = ENV_WALL_MM / cell_mm;
+    int clear = 2 * ENV_ROBOT_RADIUS_MM / cell_mm;
+    RngState rng;
+
+    if (!grid_init(map, cells, cells, cell_mm)) {
+        return false;
+    }
+    grid_fill_rect(map, 0, 0, cells, wall);
+    grid_fill_rect(map, 0, cells - wall, cells, cells);
+    grid_fill_rect(map, 0, 0, wall, cells);
+    grid_fill_rect(map, cells - wall, 0, cells, cells);
+
+    rng_seed(&rng, seed, ENV_MAP_STREAM);
+    int span = (ENV_FURNITURE_MAX_MM - ENV_FURNITURE_MIN_MM) / cell_mm;
+    for (int placed = 0; placed < ENV_FURNITURE; ) {
+        unsigned long long r = rng_next(&rng);
+        int w = ENV_FURNITURE_MIN_MM / cell_mm + (int)(r % (span + 1));
+        int h = ENV_FURNITURE_MIN_MM / cell_mm + (int)((r >> 16) % (span + 1));
+        int x = (int)((r >> 32) % (unsigned)(cells - w));
+        int y = (int)((r >> 48) % (unsigned)(cells - h));
+        if (x < cells / 2 + clear && x + w > cells / 2 - clear &&
+            y < cells / 2 + clear && y + h > cells / 2 - clear) {
+            continue;   // 시작 위치와 겹침
+        }
+        grid_fill_rect(map, x, y, x + w, y + h);
+        placed++;
+    }
+    grid_count_free(map);
+    return true;
+}
+
+// 방향별 오프셋 (mm → 칸), 대각선은 1/√2 (181/256)
+void env_offsets(int out[ENV_HEADINGS][2], int mm, int cell_mm) {
+    int d = mm / cell_mm;
+    int diag = (d * 181 + 128) / 256;
+    for (int h = 0; h < ENV_HEADINGS; h++) {
+        int len = (h & 1) ? diag : d;
+        out[h][0] = env_dir[h][0] * len;
+        out[h][1] = env_dir[h][1] * len;
+    }
+}
+
+// 지도 위 로봇 1대 준비 (방 중앙, +x 방향)
+void env_world_init(GridWorld *world) {
+    const GridMap *map = &world->map;
+    world->pose.x = map->width / 2 << KIN_FRAC_BITS;
+    world->pose.y = map->height / 2 << KIN_FRAC_BITS;
+    world->pose.heading = 0;
+    world->motor = MOTOR_STOP;
+    world->cleaner = CLEANER_OFF;
+    world->moves = 0;
+    world->bumps = 0;
+    env_offsets(world->probe, ENV_ROBOT_RADIUS_MM + ENV_SENSOR_RANGE_MM, map->cell_mm);
+    kin_init(&world->kin, ENV_STEP_MM, map->cell_mm);
+    env_offsets(world->body, ENV_ROBOT_RADIUS_MM, map->cell_mm);
+}
+
+// 장애물 센서: 앞 / 왼쪽(-90°) / 오른쪽(+90°) 탐지 지점 3곳의 비트 조회
+SensorData env_sense(const GridWorld *world) {
+    const RobotPose *p = &world->pose;
+    int x = p->x >> KIN_FRAC_BITS, y = p->y >> KIN_FRAC_BITS;
+    const int *f = world->probe[p->heading];
+    const int *l = world->probe[(p->heading + 6) & 7];
+    const int *r = world->probe[(p->heading + 2) & 7];
+    return (SensorData)(grid_occupied(&world->map, x + f[0], y + f[1]) * SENSOR_FRONT
+                      | grid_occupied(&world->map, x + l[0], y + l[1]) * SENSOR_LEFT
+                      | grid_occupied(&world->map, x + r[0], y + r[1]) * SENSOR_RIGHT);
+}
+
+// 래치된 모터 명령으로 1 tick 진행 (자세 계산은 kin_next)
+// 전진/후진: 이동 후 몸체 끝이 장애물이면 제자리 (범퍼 접촉), 회전: 45° (SRS PDF p.3 FR-3.2)
+void env_move(GridWorld *world) {
+    RobotPose *p = &world->pose;
+    RobotPose next = kin_next(&world->kin, *p, world->motor);
+    if (world->motor == MOTOR_FORWARD || world->motor == MOTOR_BACKWARD) {
+        int sign = world->motor == MOTOR_FORWARD ? 1 : -1;
+        if (grid_occupied(&world->map, (next.x >> KIN_FRAC_BITS) + sign * world->body[p->heading][0],
+                          (next.y >> KIN_FRAC_BITS) + sign * world->body[p->heading][1])) {
+            world->bumps++;
+            return;
+        }
+        world->moves++;
+    }
+    *p = next;
+}
+
+// ---------- grid I/O 백엔드: 격자 세계에서 센서 유도, 모터 명령으로 로봇 이동 ----------
+
+GridWorld env_world;
+
+void io_grid_release(void) {
+    dust_free(&env_world.dust);
+    coverage_free(&env_world.coverage);
+    grid_free(&env_world.map);
+}
+
+// 격자 세계 지도 (main의 --map / --save-map / --room-m)
+EnvOptions env_options = {NULL, NULL, ENV_ROOM_MM};
+
+// 지도 파일이 있으면 mmap으로 열고 (타일은 로봇이 닿는 곳만 페이지 인), 없으면 시드로 방 생성
+bool io_grid_load_map(GridMap *map, unsigned long long seed) {
+    if (env_options.map_path) {
+        return grid_map_file(map, env_options.map_path);
+    }
+    if (!grid_generate_room(map, env_options.room_mm, ENV_CELL_MM, seed)) {
+        fprintf(stderr, "Grid world allocation failed\n");
+        return false;
+    }
+    return !env_options.save_path || grid_save(map, env_options.save_path);
+}
+
+bool io_grid_open(unsigned long long seed) {
+    if (!io_grid_load_map(&env_world.map, seed)) {
+        io_grid_release();
+        return false;
+    }
+    if (!coverage_init(&env_world.coverage, &env_world.map) ||
+        !dust_init(&env_world.dust, &env_world.map) ||
+        !dust_scatter(&env_world.dust, &env_world.map, seed)) {
+        fprintf(stderr, "Grid world allocation failed\n");
+        io_grid_release();
+        return false;
+    }
+    env_world_init(&env_world);
+    return true;
+}
+
+// tick 시작: 지난 tick까지 래치된 명령으로 이동한 뒤 장애물 센서와 먼지 센서(발밑 밀도)를 읽음
+// 그 뒤 래치된 청소 명령이 켜져 있으면 그 자리의 청소 범위와 먼지를 갱신 (센서는 치우기 전 값)
+bool io_grid_read(SensorData *sensors, RngState *rng) {
+    GridWorld *world = &env_world;
+    const RobotPose *p = &world->pose;
+    (void)rng;
+    env_move(world);
+    int x = p->x >> KIN_FRAC_BITS, y = p->y >> KIN_FRAC_BITS;
+    SensorData dust = (dust_at(&world->dust, x, y) >= ENV_DUST_SENSE) * SENSOR_DUST;
+    world->dust.detections += dust != 0;
+    *sensors = env_sense(world) | dust;
+
+    bool cleaning = world->cleaner == CLEANER_ON || world->cleaner == CLEANER_POWERUP;
+    coverage_update(&world->coverage, &world->map, x, y, cleaning, rvc.tick_time_us);
+    if (cleaning) {
+        dust_clean(&world->dust, &world->map, x, y,
+                   world->cleaner == CLEANER_POWERUP ? ENV_DUST_PICKUP_TURBO : ENV_DUST_PICKUP_NORMAL);
+    }
+    return true;
+}
+
+void io_grid_write(unsigned int changed, const int cmd[ACTUATOR_COUNT]) {
+    if (changed & (1u << ACTUATOR_MOTOR)) {
+        env_world.motor = cmd[ACTUATOR_MOTOR];
+    }
+    if (changed & (1u << ACTUATOR_CLEANER)) {
+        env_world.cleaner = cmd[ACTUATOR_CLEANER];
+    }
+}
+
+void io_grid_close(void) {
+    const GridMap *map = &env_world.map;
+    if (!map->block_offset) {
+        return;
+    }
+    printf("Grid world: %d x %d cells (%d mm), %.1f%% free, robot at (%lld, %lld) mm heading %d deg, "
+           "moved %lld ticks, bumped %lld\n",
+           map->width, map->height, map->cell_mm,
+           100.0 * map->free_cells / ((double)map->width * map->height),
+           (long long)env_world.pose.x * map->cell_mm >> KIN_FRAC_BITS,
+           (long long)env_world.pose.y * map->cell_mm >> KIN_FRAC_BITS,
+           env_world.pose.heading * 45, env_world.moves, env_world.bumps);
+    if (map->mapping) {
+        printf("Map file: %s, %.1f MB mapped\n", env_options.map_path, map->mapping_size / 1048576.0);
+    }
+    coverage_report(&env_world.coverage, map);
+    dust_report(&env_world.dust);
+    io_grid_release();
+}
+
+const IoBackend io_grid = {
+    "grid", io_grid_open, io_grid_read, io_grid_write, io_grid_close
+};
+
+/* ========== 지도 파일 (블록 오프셋 표 + 8 KB 타일 블록, mmap 로더) ========== */
+/*
+ * 파일 구성 (리틀 엔디언, 호스트 구조체 그대로):
+ *   GridFileHeader
+ *   블록 오프셋 표: 블록마다 uint64 (파일 처음부터의 바이트 오프셋, 블록 번호 = 행 우선)
+ *   4 KB 정렬 후 블록 데이터: 공유 빈 블록 1개 + 장애물이 있는 블록만 (블록마다 1024 워드)
+ * 장애물이 없는 블록은 모두 공유 빈 블록을 가리키므로 파일은 벽/선반이 있는 면적에 비례하고,
+ * 칸 조회는 오프셋 표 1회 + 워드 1회로 O(1), 여는 데는 헤더/표 검사만 하고 블록은 읽지 않음
+ */
+
+
+
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define GRID_FILE_MAGIC "RVCGRID1"
+#define GRID_FILE_ALIGN 4096
+#define GRID_BLOCK_BYTES (GRID_BLOCK_WORDS * sizeof(unsigned long long))
+
+// 함수 선언
+void grid_unmap_file(GridMap *map);
+
+typedef struct {
+    char magic[8];
+    int width;
+    int height;
+    int cell_mm;
+    int blocks_x;
+    int blocks_y;
+    int reserved;
+    long long free_cells;
+    unsigned long long index_offset;    // 블록 오프셋 표 위치
+    unsigned long long data_offset;     // 공유 빈 블록 위치 (첫 블록, 4 KB 정렬)
+    unsigned long long file_size;
+} GridFileHeader;
+
+// 블록 b가 모두 빈 칸인지
+bool grid_block_empty(const GridMap *map, long long b) {
+    const unsigned long long *block = (const unsigned long long *)(map->tile_base + map->block_offset[b]);
+    for (int i = 0; i < GRID_BLOCK_WORDS; i++) {
+        if (block[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 지도 저장: 빈 블록은 공유 빈 블록으로 합침
+bool grid_save(const GridMap *map, const char *path) {
+    long long blocks = (long long)map->blocks_x * map->blocks_y;
+    unsigned long long *index = malloc((size_t)blocks * sizeof(unsigned long long));
+    FILE *f = fopen(path, "wb");
+    if (!index || !f) {
+        perror(path);
+        free(index);
+        if (f) {
+            fclose(f);
+        }
+        return false;
+    }
+
+    GridFileHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, GRID_FILE_MAGIC, sizeof(h.magic));
+    h.width = map->width;
+    h.height = map->height;
+    h.cell_mm = map->cell_mm;
+    h.blocks_x = map->blocks_x;
+    h.blocks_y = map->blocks_y;
+    h.free_cells = map->free_cells;
+    h.index_offset = sizeof(h);
+    h.data_offset = (h.index_offset + blocks * sizeof(unsigned long long) + GRID_FILE_ALIGN - 1)
+                    / GRID_FILE_ALIGN * GRID_FILE_ALIGN;
+    unsigned long long next = h.data_offset + GRID_BLOCK_BYTES;
+    for (long long b = 0; b < blocks; b++) {
+        if (grid_block_empty(map, b)) {
+            index[b] = h.data_offset;
+        } else {
+            index[b] = next;
+            next += GRID_BLOCK_BYTES;
+        }
+    }
+    h.file_size = next;
+
+    static const unsigned long long zero[GRID_BLOCK_WORDS];
+    bool ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+              fwrite(index, sizeof(unsigned long long), (size_t)blocks, f) == (size_t)blocks &&
+              fwrite(zero, 1, (size_t)(h.data_offset - h.index_offset - blocks * sizeof(unsigned long long)), f)
+                  == (size_t)(h.data_offset - h.index_offset - blocks * sizeof(unsigned long long)) &&
+              fwrite(zero, GRID_BLOCK_BYTES, 1, f) == 1;
+    for (long long b = 0; ok && b < blocks; b++) {
+        if (index[b] != h.data_offset) {
+            ok = fwrite(map->tile_base + map->block_offset[b], GRID_BLOCK_BYTES, 1, f) == 1;
+        }
+    }
+    if (fclose(f) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        fprintf(stderr, "%s: write failed\n", path);
+    }
+    free(index);
+    return ok;
+}
+
+// 헤더와 블록 오프셋 표 검사 (블록 데이터는 읽지 않음)
+bool grid_file_valid(const unsigned char *data, long long size) {
+    const GridFileHeader *h = (const GridFileHeader *)data;
+    int block_cells = 1 << (GRID_BLOCK_BITS + GRID_TILE_BITS);
+    if (size < (long long)sizeof(*h) || memcmp(h->magic, GRID_FILE_MAGIC, sizeof(h->magic)) != 0 ||
+        h->width <= 0 || h->height <= 0 || h->cell_mm <= 0 ||
+        h->blocks_x != ((long long)h->width + block_cells - 1) / block_cells ||
+        h->blocks_y != ((long long)h->height + block_cells - 1) / block_cells ||
+        h->file_size != (unsigned long long)size || h->index_offset % 8 != 0 ||
+        h->file_size < GRID_BLOCK_BYTES) {
+        return false;
+    }
+    // 외부 파일이므로 오프셋 + 길이를 더하지 않고 남은 크기와 비교 (unsigned 덧셈 wrap 방지)
+    unsigned long long blocks = (unsigned long long)h->blocks_x * h->blocks_y;
+    unsigned long long last = h->file_size - GRID_BLOCK_BYTES;    // 블록이 시작할 수 있는 마지막 위치
+    if (h->index_offset < sizeof(*h) || h->index_offset > h->file_size ||
+        blocks > (h->file_size - h->index_offset) / sizeof(unsigned long long) ||
+        h->data_offset < h->index_offset + blocks * sizeof(unsigned long long) ||
+        h->data_offset > last) {
+        return false;
+    }
+    const unsigned long long *index = (const unsigned long long *)(data + h->index_offset);
+    for (unsigned long long b = 0; b < blocks; b++) {
+        if (index[b] < h->data_offset || index[b] % 8 != 0 || index[b] > last) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 지도 파일 열기: 파일 전체를 읽기 전용으로 mmap (블록은 처음 조회할 때 페이지 인)
+// 로봇 주변만 읽으므로 미리 읽기(readahead)는 끔, Windows는 파일 전체를 읽음
+bool grid_map_file(GridMap *map, const char *path) {
+    unsigned char *data;
+    long long size;
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        perror(path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    size = st.st_size;
+    data = size > 0 ? mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "%s: cannot map file\n", path);
+        return false;
+    }
+    madvise(data, (size_t)size, MADV_RANDOM);
+#else
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = size > 0 ? malloc((size_t)size) : NULL;
+    if (!data || fread(data, 1, (size_t)size, f) != (size_t)size) {
+        fprintf(stderr, "%s: read failed\n", path);
+        free(data);
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+#endif
+
+    map->mapping = data;
+    map->mapping_size = size;
+    if (!grid_file_valid(data, size)) {
+        fprintf(stderr, "%s: not a grid map file\n", path);
+        grid_unmap_file(map);
+        return false;
+    }
+    const GridFileHeader *h = (const GridFileHeader *)data;
+    map->width = h->width;
+    map->height = h->height;
+    map->cell_mm = h->cell_mm;
+    map->blocks_x = h->blocks_x;
+    map->blocks_y = h->blocks_y;
+    map->words = (long long)h->blocks_x * h->blocks_y * GRID_BLOCK_WORDS;
+    map->free_cells = h->free_cells;
+    map->occupied = NULL;
+    map->tile_base = data;
+    map->block_offset = (const unsigned long long *)(data + h->index_offset);
+    return true;
+}
+
+void grid_unmap_file(GridMap *map) {
+#ifndef _WIN32
+    munmap(map->mapping, (size_t)map->mapping_size);
+#else
+    free(map->mapping);
+#endif
+    map->mapping = NULL;
+    map->mapping_size = 0;
+}
+
+// 매핑 중 페이지 캐시에 올라와 있는 바이트 (Windows는 파일 전체)
+// 캐시에서 내린 파일을 열었다면 이 프로세스가 조회한 블록만큼
+long long grid_resident_bytes(const GridMap *map) {
+#ifndef _WIN32
+    long long page = sysconf(_SC_PAGESIZE);
+    size_t pages = (size_t)((map->mapping_size + page - 1) / page);
+    unsigned char *vec = malloc(pages ? pages : 1);
+    long long resident = 0;
+    if (vec && mincore(map->mapping, (size_t)map->mapping_size, vec) == 0) {
+        for (size_t i = 0; i < pages; i++) {
+            resident += vec[i] & 1;
+        }
+    }
+    free(vec);
+    return resident * page;
+#else
+    return map->mapping_size;
+#endif
+}
+
+/* ========== 청소 범위 비트맵 (청소한 칸 / 재청소 / 90% 도달 시간) ========== */
+
+
+
+// 함수 선언
+size_t grid_word(const GridMap *map, int x, int y);
+unsigned long long grid_tile(const GridMap *map, size_t word);
+unsigned long long grid_tile_cols(int tx, int x0, int x1);
+unsigned long long grid_tile_rows(int ty, int y0, int y1);
+
+bool coverage_init(CoverageMap *cov, const GridMap *map) {
+    cov->cleaned = calloc((size_t)map->words, sizeof(unsigned long long));
+    cov->cleaned_cells = 0;
+    cov->swept_cells = 0;
+    cov->recleaned_cells = 0;
+    cov->ticks = 0;
+    cov->tick_90 = -1;
+    cov->time_90_us = 0;
+    cov->time_us = 0;
+    cov->prev_x = 0;
+    cov->prev_y = 0;
+    cov->prev_valid = false;
+    return cov->cleaned != NULL;
+}
+
+void coverage_free(CoverageMap *cov) {
+    free(cov->cleaned);
+    cov->cleaned = NULL;
+}
+
+// 흡입구 footprint 하나 반영: 걸친 타일마다 워드 마스크를 OR하고 바뀐 비트만 popcount
+// footprint 크기에만 비례 (지도 크기와 무관, 지도를 다시 세지 않음)
+// prev_valid면 직전 tick footprint (px, py)와 겹치는 칸은 같은 통과로 보고 재청소에서 제외, 장애물 칸은 세지 않음
+void coverage_sweep(CoverageMap *cov, const GridMap *map, int x, int y,
+                    int px, int py, bool prev_valid) {
+    if (prev_valid && x == px && y == py) {
+        return;     // 제자리 (회전/막힘): footprint가 직전과 같아 새로 지나간 칸 없음
+    }
+    int r = ENV_NOZZLE_MM / 2 / map->cell_mm;
+    int x0 = x - r < 0 ? 0 : x - r;
+    int x1 = x + r > map->width ? map->width : x + r;
+    int y0 = y - r < 0 ? 0 : y - r;
+    int y1 = y + r > map->height ? map->height : y + r;
+    int px0 = px - r, px1 = px + r;
+    int py0 = prev_valid ? py - r : 0;
+    int py1 = prev_valid ? py + r : 0;
+
+    for (int ty = y0 >> GRID_TILE_BITS; ty <= (y1 - 1) >> GRID_TILE_BITS; ty++) {
+        unsigned long long rows = grid_tile_rows(ty, y0, y1);
+        unsigned long long prev_rows = grid_tile_rows(ty, py0, py1);
+        for (int tx = x0 >> GRID_TILE_BITS; tx <= (x1 - 1) >> GRID_TILE_BITS; tx++) {
+            size_t w = grid_word(map, tx << GRID_TILE_BITS, ty << GRID_TILE_BITS);
+            unsigned long long m = grid_tile_cols(tx, x0, x1) & rows & ~grid_tile(map, w);
+            m &= ~(grid_tile_cols(tx, px0, px1) & prev_rows);
+            unsigned long long old = cov->cleaned[w];
+            int swept = __builtin_popcountll(m);
+            int recleaned = __builtin_popcountll(m & old);
+            cov->swept_cells += swept;
+            cov->recleaned_cells += recleaned;
+            cov->cleaned_cells += swept - recleaned;
+            cov->cleaned[w] = old | m;
+        }
+    }
+}
+
+// tick 마감: tick 수와 시각을 갱신하고 빈 칸의 90%를 처음 넘었는지 확인
+void coverage_tick(CoverageMap *cov, const GridMap *map, long long time_us) {
+    cov->ticks++;
+    cov->time_us = time_us;
+    if (cov->tick_90 < 0 && cov->cleaned_cells * 10 >= map->free_cells * 9) {
+        cov->tick_90 = cov->ticks;
+        cov->time_90_us = time_us;
+    }
+}
+
+// 로봇 1대의 1 tick 갱신 (직전 footprint는 cov에 보관)
+void coverage_update(CoverageMap *cov, const GridMap *map, int x, int y,
+                     bool cleaning, long long time_us) {
+    if (cleaning) {
+        coverage_sweep(cov, map, x, y, cov->prev_x, cov->prev_y, cov->prev_valid);
+        cov->prev_x = x;
+        cov->prev_y = y;
+    }
+    cov->prev_valid = cleaning;
+    coverage_tick(cov, map, time_us);
+}
+
+// 청소 범위 / 재청소 비율 / 90% 도달 시간 / 분당 청소 면적 출력
+void coverage_report(const CoverageMap *cov, const GridMap *map) {
+    double cell_m2 = (double)map->cell_mm * map->cell_mm / 1e6;
+    double minutes = cov->time_us / 60e6;
+    printf("Coverage: %.1f%% of free floor (%.2f m^2), re-clean ratio %.1f%%, ",
+           map->free_cells ? 100.0 * cov->cleaned_cells / map->free_cells : 0.0,
+           cov->cleaned_cells * cell_m2,
+           cov->swept_cells ? 100.0 * cov->recleaned_cells / cov->swept_cells : 0.0);
+    if (cov->tick_90 >= 0) {
+        printf("90%% at tick %lld (%.1f s), ", cov->tick_90, cov->time_90_us / 1e6);
+    } else {
+        printf("90%% not reached in %lld ticks, ", cov->ticks);
+    }
+    printf("%.2f m^2/min\n", minutes > 0 ? cov->cleaned_cells * cell_m2 / minutes : 0.0);
+}
+
+/* ========== 바닥 먼지 밀도 (타일 단위 희소 저장) ========== */
+
+
+
+#define DUST_PATCHES 30             // 방에 뿌리는 먼지 덩어리 수
+#define DUST_PATCH_MIN_MM 100       // 덩어리 반지름
+#define DUST_PATCH_MAX_MM 400
+#define DUST_PATCH_MIN_PEAK 64      // 덩어리 중심 밀도
+#define DUST_STREAM 0xD57           // 먼지 배치 난수 스트림 (지도/센서 스트림과 겹치지 않게)
+
+// 함수 선언
+unsigned long long rng_next(RngState *rng);
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+int grid_occupied(const GridMap *map, int x, int y);
+
+bool dust_init(DustField *dust, const GridMap *map) {
+    dust->tiles_x = (map->width + DUST_TILE - 1) >> DUST_TILE_BITS;
+    dust->tiles_y = (map->height + DUST_TILE - 1) >> DUST_TILE_BITS;
+    dust->tiles = calloc((size_t)dust->tiles_x * dust->tiles_y, sizeof(unsigned char *));
+    dust->tile_dust = calloc((size_t)dust->tiles_x * dust->tiles_y, sizeof(unsigned int));
+    dust->live_tiles = 0;
+    dust->peak_tiles = 0;
+    dust->deposited = 0;
+    dust->removed = 0;
+    dust->detections = 0;
+    return dust->tiles != NULL && dust->tile_dust != NULL;
+}
+
+void dust_free(DustField *dust) {
+    if (dust->tiles) {
+        for (int t = 0; t < dust->tiles_x * dust->tiles_y; t++) {
+            free(dust->tiles[t]);
+        }
+    }
+    free(dust->tiles);
+    free(dust->tile_dust);
+    dust->tiles = NULL;
+    dust->tile_dust = NULL;
+}
+
+// 칸 조회: 타일이 없거나 지도 밖이면 0
+int dust_at(const DustField *dust, int x, int y) {
+    int tx = x >> DUST_TILE_BITS, ty = y >> DUST_TILE_BITS;
+    if ((unsigned)tx >= (unsigned)dust->tiles_x || (unsigned)ty >= (unsigned)dust->tiles_y) {
+        return 0;
+    }
+    const unsigned char *tile = dust->tiles[ty * dust->tiles_x + tx];
+    return tile ? tile[((y & (DUST_TILE - 1)) << DUST_TILE_BITS) | (x & (DUST_TILE - 1))] : 0;
+}
+
+// 칸에 먼지 추가 (255에서 포화), 타일이 없으면 할당
+bool dust_add(DustField *dust, int x, int y, int amount) {
+    int t = (y >> DUST_TILE_BITS) * dust->tiles_x + (x >> DUST_TILE_BITS);
+    if (!dust->tiles[t]) {
+        dust->tiles[t] = calloc(DUST_TILE * DUST_TILE, 1);
+        if (!dust->tiles[t]) {
+            return false;
+        }
+        if (++dust->live_tiles > dust->peak_tiles) {
+            dust->peak_tiles = dust->live_tiles;
+        }
+    }
+    unsigned char *cell = &dust->tiles[t][((y & (DUST_TILE - 1)) << DUST_TILE_BITS) | (x & (DUST_TILE - 1))];
+    int add = *cell + amount > 255 ? 255 - *cell : amount;
+    *cell += add;
+    dust->tile_dust[t] += add;
+    dust->deposited += add;
+    return true;
+}
+
+// 시드로 먼지 덩어리 배치: 중심에서 멀어질수록 옅어지는 원 (장애물 칸 제외)
+// 덩어리가 닿는 타일만 할당되므로 나머지 바닥은 메모리를 쓰지 않음
+bool dust_scatter(DustField *dust, const GridMap *map, unsigned long long seed) {
+    RngState rng;
+    rng_seed(&rng, seed, DUST_STREAM);
+    int span = (DUST_PATCH_MAX_MM - DUST_PATCH_MIN_MM) / map->cell_mm;
+    for (int p = 0; p < DUST_PATCHES; p++) {
+        unsigned long long r = rng_next(&rng);
+        int radius = DUST_PATCH_MIN_MM / map->cell_mm + (int)(r % (span + 1));
+        int peak = DUST_PATCH_MIN_PEAK + (int)((r >> 16) % (256 - DUST_PATCH_MIN_PEAK));
+        int cx = (int)((r >> 32) % (unsigned)map->width);
+        int cy = (int)((r >> 48) % (unsigned)map->height);
+        long long r2 = (long long)radius * radius;
+        for (int y = cy - radius; y <= cy + radius; y++) {
+            for (int x = cx - radius; x <= cx + radius; x++) {
+                long long d2 = (long long)(x - cx) * (x - cx) + (long long)(y - cy) * (y - cy);
+                if (d2 >= r2 || grid_occupied(map, x, y)) {
+                    continue;   // 덩어리 밖, 지도 밖, 장애물
+                }
+                int amount = (int)(peak * (r2 - d2) / r2);
+                if (amount > 0 && !dust_add(dust, x, y, amount)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// 흡입구 footprint의 먼지를 칸마다 pickup만큼 제거
+// 타일 단위로 잘라 순회하고 먼지 없는 타일은 건너뜀, 다 치운 타일은 해제
+void dust_clean(DustField *dust, const GridMap *map, int x, int y, int pickup) {
+    int r = ENV_NOZZLE_MM / 2 / map->cell_mm;
+    int x0 = x - r < 0 ? 0 : x - r;
+    int x1 = x + r > map->width ? map->width : x + r;
+    int y0 = y - r < 0 ? 0 : y - r;
+    int y1 = y + r > map->height ? map->height : y + r;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    for (int ty = y0 >> DUST_TILE_BITS; ty <= (y1 - 1) >> DUST_TILE_BITS; ty++) {
+        for (int tx = x0 >> DUST_TILE_BITS; tx <= (x1 - 1) >> DUST_TILE_BITS; tx++) {
+            int t = ty * dust->tiles_x + tx;
+            unsigned char *tile = dust->tiles[t];
+            if (!tile) {
+                continue;
+            }
+            int cx0 = x0 > tx * DUST_TILE ? x0 : tx * DUST_TILE;
+            int cx1 = x1 < (tx + 1) * DUST_TILE ? x1 : (tx + 1) * DUST_TILE;
+            int cy0 = y0 > ty * DUST_TILE ? y0 : ty * DUST_TILE;
+            int cy1 = y1 < (ty + 1) * DUST_TILE ? y1 : (ty + 1) * DUST_TILE;
+            unsigned int taken = 0;
+            for (int cy = cy0; cy < cy1; cy++) {
+                unsigned char *row = &tile[(cy & (DUST_TILE - 1)) << DUST_TILE_BITS];
+                for (int cx = cx0; cx < cx1; cx++) {
+                    unsigned char *cell = &row[cx & (DUST_TILE - 1)];
+                    int take = *cell < pickup ? *cell : pickup;
+                    *cell -= take;
+                    taken += take;
+                }
+            }
+            dust->tile_dust[t] -= taken;
+            dust->removed += taken;
+            if (dust->tile_dust[t] == 0) {
+                free(tile);
+                dust->tiles[t] = NULL;
+                dust->live_tiles--;
+            }
+        }
+    }
+}
+
+void dust_report(const DustField *dust) {
+    printf("Dust: %.1f%% of %lld units removed, sensor on %lld ticks, tiles %d live / %d peak of %d (%d KB peak)\n",
+           dust->deposited ? 100.0 * dust->removed / dust->deposited : 0.0, dust->deposited,
+           dust->detections, dust->live_tiles, dust->peak_tiles, dust->tiles_x * dust->tiles_y,
+           dust->peak_tiles * DUST_TILE * DUST_TILE / 1024);
+}
+
+/* ========== 가상 시계 (Tick 타이밍) ========== */
+
+
+
+
+#ifndef _WIN32
+#include <errno.h>
+#endif
+
+// 함수 선언
+void evlog_emit(int node, int from, int to, int reason, int value, int value2);
+
+// 단조 시계 현재 값 (us)
+long long monotonic_us(void) {
+#ifndef _WIN32
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+#else
+    return (long long)clock() * 1000000LL / CLOCKS_PER_SEC;
+#endif
+}
+
+// 단조 시계 현재 값 (ns, tick 단계별 지연 측정용)
+long long monotonic_ns(void) {
+#ifndef _WIN32
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#else
+    return (long long)clock() * (1000000000LL / CLOCKS_PER_SEC);
+#endif
+}
+
+// 절대 시각(단조 시계)까지 대기
+// 상대 대기(usleep)와 달리 처리 시간만큼 주기가 밀리지 않음
+void sleep_until_us(long long deadline_us) {
+#ifndef _WIN32
+    struct timespec ts;
+    ts.tv_sec = deadline_us / 1000000LL;
+    ts.tv_nsec = (deadline_us % 1000000LL) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+        // 시그널로 깨어나면 같은 데드라인으로 다시 대기
+    }
+#else
+    (void)deadline_us;
+#endif
+}
+
+// 가상 시계 초기화
+// REALTIME: 제어 주기마다 절대 데드라인까지 대기 (SRS PDF p.3-4 "P-1 제어주기: 50–100 ms")
+// FAST: 대기 없이 진행하고 tick 시각은 tick 번호 × 주기로 합성
+void clock_init(VirtualClock *clk, ClockMode mode, long long period_us) {
+    clk->mode = mode;
+    clk->period_us = period_us;
+    clk->start_us = monotonic_us();
+    clk->anchored = false;
+    clk->now_us = 0;
+    clk->deadline_us = clk->start_us;
+    clk->tick_start_us = clk->start_us;
+    clk->jitter_us = 0;
+    clk->jitter_sum_us = 0;
+    clk->jitter_max_us = 0;
+    clk->work_us = 0;
+    clk->work_max_us = 0;
+    clk->missed_deadlines = 0;
+    clk->ticks_done = 0;
+}
+
+// 해당 tick의 시작 시각까지 진행하고 그 시각을 반환
+long long clock_advance(VirtualClock *clk, int tick) {
+    if (clk->mode == CLOCK_MODE_FAST) {
+        clk->now_us = (long long)tick * clk->period_us;
+        return clk->now_us;
+    }
+
+    // 데드라인은 시작 시각 기준 절대 격자 (start + tick × period)
+    // → 처리 시간이나 대기 오차가 다음 주기로 누적되지 않음
+    // 격자는 첫 tick이 시작하는 순간에 잡음: clock_init 시각에 잡으면 첫 tick이 항상 늦은 것으로 셈
+    long long now = monotonic_us();
+    if (!clk->anchored) {
+        clk->start_us = now - (long long)tick * clk->period_us;
+        clk->anchored = true;
+    }
+    clk->deadline_us = clk->start_us + (long long)tick * clk->period_us;
+
+    if (now > clk->deadline_us) {
+        // 이전 tick 처리가 이번 데드라인을 넘김 (overrun)
+        clk->missed_deadlines++;
+    } else {
+        sleep_until_us(clk->deadline_us);
+        now = monotonic_us();
+    }
+
+    clk->tick_start_us = now;
+    clk->jitter_us = now - clk->deadline_us;
+    clk->jitter_sum_us += clk->jitter_us;
+    if (clk->jitter_us > clk->jitter_max_us) {
+        clk->jitter_max_us = clk->jitter_us;
+    }
+    clk->now_us = now - clk->start_us;
+    return clk->now_us;
+}
+
+// tick 처리(센서 → 제어 → 액추에이터) 완료 기록
+void clock_tick_done(VirtualClock *clk) {
+    clk->ticks_done++;
+    if (clk->mode == CLOCK_MODE_FAST) {
+        return;
+    }
+
+    clk->work_us = monotonic_us() - clk->tick_start_us;
+    if (clk->work_us > clk->work_max_us) {
+        clk->work_max_us = clk->work_us;
+    }
+}
+
+// tick별 jitter / 처리 시간 레코드 (--sched-trace, 실시간 모드, 상태 표시 뒤에 호출)
+// 벽시계에 따라 달라지는 값이라 기본 trace에는 넣지 않음 (같은 시드면 같은 trace)
+void clock_trace(const VirtualClock *clk) {
+#if RVC_LOG_LEVEL >= RVC_LOG_STATUS
+    if (clk->mode == CLOCK_MODE_REALTIME) {
+        evlog_emit(LOG_NODE_SCHED, 0, 0, 0, (int)clk->jitter_us, (int)clk->work_us);
+    }
+#else
+    (void)clk;
+#endif
+}
+
+// 처리 없이 지나간 tick 기록 (tickless 실행, FAST 모드 전용)
+void clock_skip(VirtualClock *clk, int ticks) {
+    clk->ticks_done += ticks;
+}
+
+// 시작 이후 실제 경과 시간 (us)
+long long clock_elapsed_us(VirtualClock *clk) {
+    return monotonic_us() - clk->start_us;
+}
+
+// 스케줄링 결과 보고 (SRS PDF p.3-4 "P-1", "P-2")
+void clock_report(VirtualClock *clk) {
+    long long wall_us = clock_elapsed_us(clk);
+    // 시뮬레이션 시각은 마지막 tick의 시작 시각 (tick 0이 t=0, N tick이면 (N-1) × 주기)
+    long long simulated_us = clk->ticks_done > 0 ? (long long)(clk->ticks_done - 1) * clk->period_us : 0;
+
+    printf("Ticks: %d, simulated: %lld ms, wall: %lld ms",
+           clk->ticks_done, simulated_us / 1000, wall_us / 1000);
+    if (wall_us > 0) {
+        printf(" (%.0f ticks/s)", clk->ticks_done * 1e6 / wall_us);
+    }
+    printf("\n");
+
+    if (clk->mode == CLOCK_MODE_FAST || clk->ticks_done == 0) {
+        return;
+    }
+
+    // 최악 반응시간: 직후 샘플링을 놓친 이벤트가 다음 tick에서 처리되는 경우
+    // = 주기 + 최대 시작 지연 + 최대 처리 시간
+    long long reaction_us = clk->period_us + clk->jitter_max_us + clk->work_max_us;
+    bool p1_ok = clk->period_us >= 50000 && clk->period_us <= 100000
+                 && clk->missed_deadlines == 0;
+    bool p2_ok = reaction_us <= 150000;
+
+    printf("[SCHED] period=%lld ms, missed deadlines=%d\n",
+           clk->period_us / 1000, clk->missed_deadlines);
+    printf("[SCHED] jitter avg=%lld us, max=%lld us, worst work=%lld us\n",
+           clk->jitter_sum_us / clk->ticks_done, clk->jitter_max_us,
+           clk->work_max_us);
+    printf("[SCHED] P-1 control period 50-100 ms: %s\n", p1_ok ? "OK" : "VIOLATED");
+    printf("[SCHED] P-2 worst reaction %lld ms <= 150 ms: %s\n",
+           reaction_us / 1000, p2_ok ? "OK" : "VIOLATED");
+}
+
+/* ========== 반응 지연 히스토그램 (센서 → 액추에이터) ========== */
+
+
+
+#include <signal.h>
+
+// SIGUSR1 수신 표시 (핸들러는 표시만 하고, 출력은 제어 루프가 tick 사이에 수행)
+volatile sig_atomic_t latency_dump_requested;
+
+// 통계 초기화
+void latency_init(LatencyStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+// 값 → 구간 번호
+// 2^(SUB_BITS+1) 미만은 1 ns 단위 그대로, 그 이상은 최상위 비트 아래 SUB_BITS 비트로 하위 구간 결정
+int latency_bucket(long long ns) {
+    unsigned long long v = ns < 0 ? 0 : (unsigned long long)ns;
+    if (v >= (1ULL << LATENCY_MAX_BITS)) {
+        v = (1ULL << LATENCY_MAX_BITS) - 1;
+    }
+    if (v < (2ULL << LATENCY_SUB_BITS)) {
+        return (int)v;
+    }
+    int shift = 63 - __builtin_clzll(v) - LATENCY_SUB_BITS;
+    return (shift << LATENCY_SUB_BITS) + (int)(v >> shift);
+}
+
+// 구간 번호 → 구간에 속하는 가장 큰 값 (HDR "highest equivalent value")
+long long latency_bucket_value(int bucket) {
+    if (bucket < (2 << LATENCY_SUB_BITS)) {
+        return bucket;
+    }
+    int shift = (bucket >> LATENCY_SUB_BITS) - 1;
+    long long sub = (bucket & ((1 << LATENCY_SUB_BITS) - 1)) + (1 << LATENCY_SUB_BITS);
+    return ((sub + 1) << shift) - 1;
+}
+
+void latency_add(LatencyHistogram *hist, long long ns) {
+    hist->counts[latency_bucket(ns)]++;
+    hist->samples++;
+    if (ns > hist->max_ns) {
+        hist->max_ns = ns;
+    }
+}
+
+// tick 1개의 단계별 시각 기록
+// t0: tick 시작, t1: sensor_interface 후, t2: fsm_executor 후, t3: actuator_interface 후
+void latency_record(LatencyStats *stats, int state,
+                    long long t0, long long t1, long long t2, long long t3) {
+    latency_add(&stats->stage[LATENCY_SENSE], t1 - t0);
+    latency_add(&stats->stage[LATENCY_CONTROL], t2 - t1);
+    latency_add(&stats->stage[LATENCY_ACTUATE], t3 - t2);
+    latency_add(&stats->stage[LATENCY_REACTION], t3 - t0);
+    latency_add(&stats->by_state[state], t3 - t0);
+}
+
+// tick 시작 지연 기록 (실시간 모드만, FAST 모드는 대기가 없어 항상 0)
+void latency_jitter(LatencyStats *stats, const VirtualClock *clk) {
+    if (clk->mode == CLOCK_MODE_REALTIME) {
+        latency_add(&stats->jitter, clk->jitter_us * 1000);
+    }
+}
+
+// 백분위 값 (q: 0-1), 최댓값을 넘지 않음
+long long latency_percentile(const LatencyHistogram *hist, double q) {
+    unsigned long long rank = (unsigned long long)(q * hist->samples + 0.999999);
+    unsigned long long seen = 0;
+    if (rank == 0) {
+        rank = 1;
+    }
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+        seen += hist->counts[b];
+        if (seen >= rank) {
+            long long value = latency_bucket_value(b);
+            return value < hist->max_ns ? value : hist->max_ns;
+        }
+    }
+    return hist->max_ns;
+}
+
+void latency_print_row(FILE *out, const char *name, const LatencyHistogram *hist) {
+    fprintf(out, "[LATENCY] %-16s %10llu %9lld %9lld %9lld %9lld\n",
+            name, hist->samples,
+            latency_percentile(hist, 0.50), latency_percentile(hist, 0.99),
+            latency_percentile(hist, 0.999), hist->max_ns);
+}
+
+// 단계별 / 상태별 지연 보고 (SRS PDF p.3-4 "P-2 반응시간 ≤ 150 ms")
+void latency_report(const LatencyStats *stats, FILE *out) {
+    const char *stage_names[LATENCY_STAGES] = {
+        "sense", "fsm", "actuate", "reaction"
+    };
+    const char *state_names[] = {
+        "MOVING", "TURNING", "BACKWARDING", "DUST_CLEANING", "PAUSE"
+    };
+
+    if (stats->stage[LATENCY_REACTION].samples == 0) {
+        return;
+    }
+    fprintf(out, "[LATENCY] %-16s %10s %9s %9s %9s %9s (ns)\n",
+            "stage", "samples", "p50", "p99", "p99.9", "max");
+    for (int s = 0; s < LATENCY_STAGES; s++) {
+        latency_print_row(out, stage_names[s], &stats->stage[s]);
+    }
+    if (stats->jitter.samples > 0) {
+        latency_print_row(out, "jitter", &stats->jitter);
+    }
+    for (int s = 0; s < 5; s++) {
+        if (stats->by_state[s].samples > 0) {
+            char name[32];
+            snprintf(name, sizeof(name), "@%s", state_names[s]);
+            latency_print_row(out, name, &stats->by_state[s]);
+        }
+    }
+}
+
+void latency_signal(int sig) {
+    (void)sig;
+    latency_dump_requested = 1;
+}
+
+// SIGUSR1로 실행 중 히스토그램 출력 (kill -USR1 <pid>)
+void latency_install_signal(void) {
+#ifdef SIGUSR1
+    signal(SIGUSR1, latency_signal);
+#endif
+}
+
+// 제어 루프에서 tick마다 호출: 요청이 있으면 지금까지의 분포를 stderr로 출력
+// (stdout의 tick별 trace와 섞이지 않도록)
+void latency_poll(const LatencyStats *stats) {
+    if (latency_dump_requested) {
+        latency_dump_requested = 0;
+        latency_report(stats, stderr);
+    }
+}
+
+/* ========== Tickless 실행 (이벤트 사이 구간 건너뛰기) ========== */
+
+
+
+#include <limits.h>
+
+// 함수 선언
+void rng_skip(RngState *rng, unsigned long long n);
+void sensor_interface(SensorData *sensors, RngState *rng);
+void print_status(RVCContext *ctx);
+void actuator_interface(RVCContext *ctx);
+void actuator_skip(RVCContext *ctx, int ticks);
+void evlog_emit(int node, int from, int to, int reason, int value, int value2);
+void evlog_set_tick(int tick);
+void clock_skip(VirtualClock *clk, int ticks);
+
+// 전이 테이블 한 행에서 상태가 "조용한"지 검사
+// 타이머가 만료되지 않은 동안 어떤 센서 워드가 와도 상태 유지, 메시지 없음, 같은 명령이면 조용함
+// (타이머 없는 상태는 만료 플래그가 항상 1이므로 두 열을 모두 검사)
+bool tickless_quiet_row(const FsmEntry (*row)[2], int state, int words, bool timed) {
+    const FsmEntry *first = &row[0][0];
+    for (int w = 0; w < words; w++) {
+        for (int expired = 0; expired < (timed ? 1 : 2); expired++) {
+            const FsmEntry *e = &row[w][expired];
+            if (e->next != state || e->msg[0] || e->reload ||
+                e->motor != first->motor || e->cleaner != first->cleaner) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// 엔진 초기화: 상태별 조용함 여부를 생성된 전이 테이블에서 미리 계산
+void tickless_init(TicklessEngine *eng, bool summary) {
+    eng->count = 0;
+    eng->summary = summary;
+    for (int n = 0; n < TICKLESS_MAX_EVENTS; n++) {
+        eng->pos[n] = -1;
+        eng->key[n] = -1;
+    }
+    eng->stepped = 0;
+    eng->skipped = 0;
+    for (int s = 0; s < 5; s++) {
+        eng->quiet[s] = tickless_quiet_row(fsm_v1_table[s], s, 16, fsm_v1_timer_limit[s] > 0);
+    }
+}
+
+// 이벤트 큐 (tick 기준 최소 힙, 노드당 항목 하나)
+// 항목은 실행 사이에도 유지되고, 상태가 바뀐 노드의 항목만 제자리에서 tick을 고침
+void tickless_place(TicklessEngine *eng, int i, TicklessEvent ev) {
+    eng->heap[i] = ev;
+    eng->pos[ev.node] = i;
+}
+
+void tickless_sift(TicklessEngine *eng, int i) {
+    TicklessEvent ev = eng->heap[i];
+    while (i > 0 && eng->heap[(i - 1) / 2].tick > ev.tick) {
+        tickless_place(eng, i, eng->heap[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= eng->count) {
+            break;
+        }
+        if (child + 1 < eng->count && eng->heap[child + 1].tick < eng->heap[child].tick) {
+            child++;
+        }
+        if (eng->heap[child].tick >= ev.tick) {
+            break;
+        }
+        tickless_place(eng, i, eng->heap[child]);
+        i = child;
+    }
+    tickless_place(eng, i, ev);
+}
+
+// 노드의 이벤트를 절대 tick으로 예약 (이미 있으면 옮김)
+void tickless_schedule(TicklessEngine *eng, int node, long long tick) {
+    int i = eng->pos[node];
+    if (i < 0) {
+        i = eng->count++;
+    }
+    eng->heap[i].tick = tick;
+    eng->heap[i].node = node;
+    tickless_sift(eng, i);
+}
+
+// 노드의 예약이 아직 유효한지: 예약할 때의 상태 키가 그대로이고 예약 tick이 지나지 않음
+// (상태가 그대로면 지속 시간은 실행하든 건너뛰든 tick마다 1씩 늘어 만료 tick이 같음)
+bool tickless_valid(const TicklessEngine *eng, int node, int key, int tick) {
+    return eng->pos[node] >= 0 && eng->key[node] == key &&
+           eng->heap[eng->pos[node]].tick >= tick;
+}
+
+// 다음 이벤트까지 tick 수(1: 이번 tick) → 절대 tick
+long long tickless_at(int tick, long long wait) {
+    return wait == LLONG_MAX ? LLONG_MAX : tick + wait - 1;
+}
+
+// FSM의 다음 이벤트까지 tick 수 (1: 이번 tick에 전이 가능, LLONG_MAX: 없음)
+// 조용한 상태는 상태 타이머가 만료되는 tick (state_duration + n >= 한계)까지 변화 없음
+long long v1_next_event(const TicklessEngine *eng, const RVCContext *ctx) {
+    if (!eng->quiet[ctx->state]) {
+        return 1;   // Moving / Turning: 매 tick 센서에 따라 전이
+    }
+    int limit = fsm_v1_timer_limit[ctx->state];
+    if (limit == 0) {
+        return LLONG_MAX;
+    }
+    return limit - ctx->state_duration > 1 ? limit - ctx->state_duration : 1;
+}
+
+// 조용한 구간 n tick을 fsm_executor 없이 진행
+// 상태 유지 → 지속 시간과 카운트다운 타이머만 n만큼 변하고 명령은 상태 기본값
+void v1_quiet_advance(RVCContext *ctx, int ticks) {
+    const FsmEntry *e = &fsm_v1_table[ctx->state][0][0];
+    ctx->state_duration += ticks;
+    ctx->backward_timer -= ticks * (ctx->state == STATE_BACKWARDING);
+    ctx->dust_clean_timer -= ticks * (ctx->state == STATE_DUST_CLEANING);
+    if (e->motor != FSM_KEEP) {
+        ctx->motor_cmd = e->motor;
+    }
+    ctx->cleaner_cmd = e->cleaner;
+}
+
+// 건너뛴 구간의 센서 워드와 상태 표시 (상태는 이미 구간 끝으로 진행됨)
+// 센서 난수는 카운터 기반이라 구간 첫 tick의 난수 상태(frames)에서 바로 마지막 프레임을 만들 수 있음
+// 상태 표시(RVC_LOG_STATUS)는 tick 단위 실행과 같은 tick별 레코드: 프레임을 차례로 다시 만들고
+// 지속 시간은 tick마다 1씩 늘림 (출력 자체가 tick 수에 비례), --tickless-summary면 구간 요약 1개
+void v1_skip_status(const TicklessEngine *eng, RVCContext *ctx, RngState frames, int tick, int skip) {
+#if RVC_LOG_LEVEL >= RVC_LOG_STATUS
+    if (!eng->summary) {
+        ctx->state_duration -= skip;
+        for (int k = 0; k < skip; k++) {
+            evlog_set_tick(tick + k);
+            sensor_interface(&ctx->sensors, &frames);
+            ctx->state_duration++;
+            print_status(ctx);
+        }
+        return;
+    }
+    evlog_emit(LOG_NODE_SKIP, ctx->state, 0, 0, skip, 0);
+#else
+    (void)eng;
+    (void)tick;
+#endif
+    rng_skip(&frames, (unsigned long long)(skip - 1));
+    sensor_interface(&ctx->sensors, &frames);
+}
+
+// tick부터 다음 이벤트 직전까지 건너뛰고 건너뛴 tick 수를 반환 (0: 이번 tick을 실행)
+// 건너뛴 구간은 상태와 명령이 그대로이므로 tick별로 재생하지 않고 한 번에 진행:
+// 명령 변화는 첫 tick에만 있을 수 있어 액추에이터 출력은 tick 단위 실행과 같고,
+// 상태 표시도 tick 단위 실행과 같음 (v1_skip_status)
+int tickless_skip(TicklessEngine *eng, RVCContext *ctx, VirtualClock *clk,
+                  int tick, int end_tick) {
+    if (!tickless_valid(eng, 0, ctx->state, tick)) {
+        eng->key[0] = ctx->state;
+        tickless_schedule(eng, 0, tickless_at(tick, v1_next_event(eng, ctx)));
+    }
+    long long skip = eng->heap[0].tick - tick;
+    if (skip > end_tick - tick) {
+        skip = end_tick - tick;
+    }
+    if (skip <= 0) {
+        eng->stepped++;
+        return 0;
+    }
+
+    ctx->tick_count = tick;
+    evlog_set_tick(tick);
+    RngState frames = ctx->rng;     // 구간 첫 tick의 센서 난수
+    rng_skip(&ctx->rng, (unsigned long long)skip);
+    v1_quiet_advance(ctx, (int)skip);
+    actuator_skip(ctx, (int)skip);
+    clock_skip(clk, (int)skip);
+    v1_skip_status(eng, ctx, frames, tick, (int)skip);
+    ctx->tick_count = tick + (int)skip - 1;
+    eng->skipped += skip;
+    if (tick + skip < end_tick) {
+        eng->stepped++;     // 건너뛴 뒤 이어서 실행할 이벤트 tick
+    }
+    return (int)skip;
+}
+
+void tickless_report(const TicklessEngine *eng) {
+    long long total = eng->stepped + eng->skipped;
+    printf("Tickless: %lld ticks stepped, %lld skipped (%.1f%%)\n",
+           eng->stepped, eng->skipped, total > 0 ? 100.0 * eng->skipped / total : 0.0);
+}
+
+/* ========== FSM 전이 함수 (fleet SoA 커널용) ========== */
+
+// 주의: 이 파일은 fsm/fsm_spec.h에서 fsm_gen으로 자동 생성한 것입니다.
+//       전이 규칙은 fsm/fsm_spec.h에서 수정하세요.
+// fsm_table.c와 같은 규칙을 분기 없는 식으로 펼친 것 (fleet.c에서 include)
+
+// fsm_v1_table과 같은 전이를 로봇 1대분 식으로 계산 (fleet_step 루프 본문에 인라인)
+// duration: 이번 tick을 포함한 상태 지속 tick 수, motor/cleaner: 이전 명령
+static inline FsmLane fsm_v1_lane(int state, int word, int duration, int motor, int cleaner) {
+    int one = 1 << state;
+    FsmLane r;
+    r.motor =
+        (-(one >> STATE_MOVING & 1) & MOTOR_FORWARD) +
+        (-(one >> STATE_TURNING & 1) & motor) +
+        (-(one >> STATE_BACKWARDING & 1) & MOTOR_BACKWARD) +
+        (-(one >> STATE_DUST_CLEANING & 1) & MOTOR_STOP) +
+        (-(one >> STATE_PAUSE & 1) & MOTOR_STOP);
+    r.cleaner =
+        (-(one >> STATE_MOVING & 1) & CLEANER_ON) +
+        (-(one >> STATE_TURNING & 1) & CLEANER_ON) +
+        (-(one >> STATE_BACKWARDING & 1) & CLEANER_ON) +
+        (-(one >> STATE_DUST_CLEANING & 1) & CLEANER_POWERUP) +
+        (-(one >> STATE_PAUSE & 1) & CLEANER_ON);
+    (void)cleaner;
+    int limit = 0
+        + (-(one >> STATE_TURNING & 1) & 2)
+        + (-(one >> STATE_BACKWARDING & 1) & 3)
+        + (-(one >> STATE_DUST_CLEANING & 1) & 5)
+        + (-(one >> STATE_PAUSE & 1) & 3);
+    int in = word | (duration >= limit) << 5;    // IN_T: 상태 타이머 만료
+    int open, hit;
+    r.next = state;
+    r.reload = 0;
+    open = one >> STATE_MOVING & 1;
+    // -> STATE_DUST_CLEANING
+    hit = -(open & ((in & 0x08) == 0x08));
+    open &= ~hit;
+    r.next += hit & (STATE_DUST_CLEANING - STATE_MOVING);
+    r.reload += hit & 5;
+    // -> STATE_TURNING
+    hit = -(open & ((in & 0x01) == 0x01));
+    r.next += hit & (STATE_TURNING - STATE_MOVING);
+    open = one >> STATE_TURNING & 1;
+    // -> STATE_BACKWARDING
+    hit = -(open & ((in & 0x07) == 0x07));
+    open &= ~hit;
+    r.next += hit & (STATE_BACKWARDING - STATE_TURNING);
+    r.reload += hit & 3;
+    // -> STATE_MOVING
+    hit = -(open & ((in & 0x22) == 0x20));
+    open &= ~hit;
+    r.next += hit & (STATE_MOVING - STATE_TURNING);
+    r.motor += hit & (MOTOR_TURN_LEFT - motor);
+    // -> STATE_TURNING
+    hit = -(open & ((in & 0x02) == 0x00));
+    open &= ~hit;
+    r.motor += hit & (MOTOR_TURN_LEFT - motor);
+    // -> STATE_MOVING
+    hit = -(open & ((in & 0x24) == 0x20));
+    open &= ~hit;
+    r.next += hit & (STATE_MOVING - STATE_TURNING);
+    r.motor += hit & (MOTOR_TURN_RIGHT - motor);
+    // -> STATE_TURNING
+    hit = -(open & ((in & 0x04) == 0x00));
+    open &= ~hit;
+    r.motor += hit & (MOTOR_TURN_RIGHT - motor);
+    // -> STATE_PAUSE
+    hit = -open;
+    r.next += hit & (STATE_PAUSE - STATE_TURNING);
+    open = one >> STATE_BACKWARDING & 1;
+    // -> STATE_TURNING
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (STATE_TURNING - STATE_BACKWARDING);
+    open = one >> STATE_DUST_CLEANING & 1;
+    // -> STATE_MOVING
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (STATE_MOVING - STATE_DUST_CLEANING);
+    open = one >> STATE_PAUSE & 1;
+    // -> STATE_BACKWARDING
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (STATE_BACKWARDING - STATE_PAUSE);
+    r.reload += hit & 3;
+    return r;
+}
+
+
+/* ========== Fleet: 다수 로봇 일괄 실행 (SoA) ========== */
+
+
+
+
+void kin_init(KinModel *kin, int step_mm, int unit_mm);
+
+// Fleet 할당 및 초기화 (initialize_system과 같은 초기 상태)
+// 로봇 i의 센서 난수열은 (seed, i)로 결정됨
+bool fleet_init(RVCFleet *fleet, int count, unsigned long long seed) {
+    fleet->count = count;
+    fleet->state = calloc(count, sizeof(unsigned char));
+    fleet->motor_cmd = calloc(count, sizeof(unsigned char));
+    fleet->cleaner_cmd = calloc(count, sizeof(unsigned char));
+    fleet->state_since = calloc(count, sizeof(int));
+    fleet->sensors = calloc(count, sizeof(unsigned char));
+    fleet->rng = calloc(count, sizeof(RngState));
+    fleet->pose_x = calloc(count, sizeof(unsigned int));
+    fleet->pose_y = calloc(count, sizeof(unsigned int));
+    fleet->heading = calloc(count, sizeof(unsigned char));
+    fleet->ticks = 0;
+    kin_init(&fleet->kin, ENV_STEP_MM, 1);  // 자세 단위 1/256 mm, 모두 원점에서 +x 방향
+
+    if (!fleet->state || !fleet->motor_cmd || !fleet->cleaner_cmd ||
+        !fleet->state_since || !fleet->sensors || !fleet->rng ||
+        !fleet->pose_x || !fleet->pose_y || !fleet->heading) {
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        fleet->state[i] = STATE_MOVING;
+        fleet->motor_cmd[i] = MOTOR_FORWARD;
+        fleet->cleaner_cmd[i] = CLEANER_ON;
+        fleet->state_since[i] = -1;     // 첫 tick(0)에 state_duration 1
+        rng_seed(&fleet->rng[i], seed, (unsigned long long)i);  // 로봇 번호 = 스트림
+    }
+    return true;
+}
+
+void fleet_free(RVCFleet *fleet) {
+    free(fleet->state);
+    free(fleet->motor_cmd);
+    free(fleet->cleaner_cmd);
+    free(fleet->state_since);
+    free(fleet->sensors);
+    free(fleet->rng);
+    free(fleet->pose_x);
+    free(fleet->pose_y);
+    free(fleet->heading);
+}
+
+// 센서 입력 (sensor_interface와 같은 확률 모델과 비트 분할)
+// 로봇별 카운터 기반 난수라 어느 스레드가 처리해도 로봇별 센서 열이 같음
+void fleet_sense(RVCFleet *fleet, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+        unsigned long long frame = rng_next(&fleet->rng[i]);
+        fleet->sensors[i] = (unsigned char)(
+            ((frame & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_FRONT
+            | (((frame >> 16) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_LEFT
+            | (((frame >> 32) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_RIGHT
+            | (((frame >> 48) & 0xFFFF) < SENSOR_DUST_THRESHOLD) * SENSOR_DUST);
+    }
+}
+
+// [begin, end) 구간 로봇들의 FSM 1 tick 실행
+// 전이는 fsm/fsm_spec.h에서 생성한 fsm_v1_lane (분기 없는 식)으로 계산
+// → 루프 본문에 분기가 없어 컴파일러 자동 벡터화 대상
+// 타이머는 매 tick 세지 않고 상태에 들어간 tick만 기록 (진입 시 1회 예약, 상태가 바뀌면 덮어써 취소)
+// 만료는 "현재 tick - 진입 tick ≥ 한계" 비교 1회, 로봇당 int 배열 3개 읽기/쓰기 → 1개
+void fleet_step(RVCFleet *fleet, int begin, int end) {
+    unsigned char *state = fleet->state;
+    unsigned char *motor_cmd = fleet->motor_cmd;
+    unsigned char *cleaner_cmd = fleet->cleaner_cmd;
+    int *state_since = fleet->state_since;
+    const unsigned char *sensors = fleet->sensors;
+    int now = fleet->ticks;
+
+    // 배열끼리 겹치지 않으므로 별칭 검사 없이 벡터화하도록 지시
+    #pragma GCC ivdep
+    for (int i = begin; i < end; i++) {
+        int s = state[i];
+        int since = state_since[i];
+        FsmLane e = fsm_v1_lane(s, sensors[i], now - since, motor_cmd[i], cleaner_cmd[i]);
+
+        // 값이 모두 0/1이므로 선택은 "조건 × 변화량"의 합으로 계산 (삼항 연산자는 분기로 남음)
+        state[i] = (unsigned char)e.next;
+        motor_cmd[i] = (unsigned char)e.motor;
+        cleaner_cmd[i] = (unsigned char)e.cleaner;
+        state_since[i] = since + (e.next != s) * (now - since);
+    }
+}
+
+// fsm_executor의 타이머 값을 진입 tick에서 복원 (마지막으로 실행한 tick 기준)
+// 명세의 카운트다운 타이머는 진입할 때 그 상태의 한계로 장전되고 그 상태에서만 줄며
+// 한계에서 만료되면 반드시 나가므로 상태 밖에서는 0
+void fleet_timers(const RVCFleet *fleet, int i, int *duration, int *dust_timer, int *back_timer) {
+    int s = fleet->state[i];
+    *duration = fleet->ticks - 1 - fleet->state_since[i];
+    int left = fsm_v1_timer_limit[s] - *duration;
+    *dust_timer = (s == STATE_DUST_CLEANING) * left;
+    *back_timer = (s == STATE_BACKWARDING) * left;
+}
+
+// 전체 로봇 상태의 FNV-1a 해시 (같은 시드로 실행한 결과가 비트 단위로 같은지 비교용)
+unsigned long long fleet_checksum(RVCFleet *fleet) {
+    unsigned long long h = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < fleet->count; i++) {
+        int duration, dust_timer, back_timer;
+        fleet_timers(fleet, i, &duration, &dust_timer, &back_timer);
+        unsigned long long fields[8] = {
+            fleet->state[i], fleet->motor_cmd[i],
+            (unsigned long long)duration,
+            (unsigned long long)dust_timer,
+            (unsigned long long)back_timer,
+            fleet->pose_x[i], fleet->pose_y[i], fleet->heading[i]
+        };
+        for (int k = 0; k < 8; k++) {
+            h = (h ^ fields[k]) * 0x100000001B3ULL;
+        }
+    }
+    return h;
+}
+
+// 시작점에서 이동한 거리 (|dx| + |dy|, 자세는 Q8, 단위 길이는 kin.unit_mm)
+void fleet_pose_report(RVCFleet *fleet) {
+    double total = 0.0, farthest = 0.0;
+    for (int i = 0; i < fleet->count; i++) {
+        long long dx = (int)fleet->pose_x[i], dy = (int)fleet->pose_y[i];
+        double m = (double)(llabs(dx) + llabs(dy)) * fleet->kin.unit_mm / (1000 << KIN_FRAC_BITS);
+        total += m;
+        farthest = m > farthest ? m : farthest;
+    }
+    printf("Fleet poses: mean %.2f m from start (|dx| + |dy|), farthest %.2f m\n",
+           fleet->count > 0 ? total / fleet->count : 0.0, farthest);
+}
+
+// 상태별 로봇 수 출력
+void fleet_report(RVCFleet *fleet) {
+    const char *state_names[] = {
+        "MOVING", "TURNING", "BACKWARDING", "DUST_CLEANING", "PAUSE"
+    };
+    int histogram[5] = {0};
+
+    for (int i = 0; i < fleet->count; i++) {
+        histogram[fleet->state[i]]++;
+    }
+    printf("Fleet states (%d robots):", fleet->count);
+    for (int s = 0; s < 5; s++) {
+        printf(" %s=%d", state_names[s], histogram[s]);
+    }
+    printf("\n");
+    fleet_pose_report(fleet);
+    printf("Fleet checksum: %016llx\n", fleet_checksum(fleet));
+}
+
+/* ========== 공유 격자 세계 (fleet 다수 로봇 + 공간 해시) ========== */
+/*
+ * --robots N --io grid: N대가 한 지도에서 움직이며 벽/가구와 다른 로봇을 front/left/right로 감지
+ * tick 안에서는 공간 해시의 스냅숏(tick 시작 위치)만 읽고 자기 자세만 쓰므로 chunk를 어느 스레드가
+ * 처리해도 결과가 같고, tick이 끝나면 한 스레드가 버킷을 옮긴 로봇만 다시 연결
+ * 같은 tick에 두 로봇이 같은 자리로 들어가는 것은 막지 못함 (겹침은 최대 1 tick 이동량)
+ * 먼지와 청소 범위도 grid 백엔드와 같은 DustField / CoverageMap을 모든 로봇이 공유
+ * tick 안에서는 읽기만 하고 치우는 것은 tick 끝 swarm_update가 로봇 번호 순서로 하므로 스레드 수와 무관
+ */
+
+
+
+#define SWARM_REACH_MM 380          // 다른 로봇이 닿는 중심 거리: 감지 (탐지 지점 210 + 반지름 170), 이동 (30 + 170 + 170)
+#define SWARM_PLACE_STREAM 0x5A3    // 시작 위치 난수 스트림
+#define SWARM_PLACE_TRIES 100000    // 로봇 한 대를 놓을 자리를 찾는 최대 시도 수
+#define SWARM_BLOCKED 8             // swarm_neighbors: 이동하면 다른 로봇과 겹침
+
+// 함수 선언
+unsigned long long rng_next(RngState *rng);
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+bool io_grid_load_map(GridMap *map, unsigned long long seed);
+void grid_free(GridMap *map);
+int grid_occupied(const GridMap *map, int x, int y);
+void env_offsets(int out[ENV_HEADINGS][2], int mm, int cell_mm);
+void kin_init(KinModel *kin, int step_mm, int unit_mm);
+bool coverage_init(CoverageMap *cov, const GridMap *map);
+void coverage_free(CoverageMap *cov);
+void coverage_sweep(CoverageMap *cov, const GridMap *map, int x, int y,
+                    int px, int py, bool prev_valid);
+void coverage_tick(CoverageMap *cov, const GridMap *map, long long time_us);
+void coverage_report(const CoverageMap *cov, const GridMap *map);
+bool dust_init(DustField *dust, const GridMap *map);
+void dust_free(DustField *dust);
+bool dust_scatter(DustField *dust, const GridMap *map, unsigned long long seed);
+int dust_at(const DustField *dust, int x, int y);
+void dust_clean(DustField *dust, const GridMap *map, int x, int y, int pickup);
+void dust_report(const DustField *dust);
+RobotPose kin_next(const KinModel *kin, RobotPose p, int motor);
+void swarm_free(SwarmWorld *world);
+
+SwarmWorld swarm_world;
+
+// 버킷 좌표 → 표 칸: 표를 2^(bits/2) × 2^(bits - bits/2) 버킷 격자로 보고 지도를 그 크기로 접음
+// x로 이웃한 버킷은 이웃한 칸이라 2×2 조회의 머리 노드가 대개 캐시 라인 2개에 모임
+// 표 한 바퀴만큼 떨어진 버킷은 같은 칸을 쓰지만 거리 검사로 걸러짐
+int swarm_slot(const SpatialHash *hash, int bx, int by) {
+    int wbits = hash->bits / 2;
+    return ((by & ((1 << (hash->bits - wbits)) - 1)) << wbits) | (bx & ((1 << wbits) - 1));
+}
+
+// 로봇 r을 (x, y) 칸의 버킷 리스트 앞에 연결
+void swarm_link(SpatialHash *hash, int r, int x, int y) {
+    SwarmNode *nodes = hash->nodes;
+    int slot = swarm_slot(hash, x / hash->bucket_cells, y / hash->bucket_cells);
+    int head = hash->robots + slot;
+    nodes[r].x = x;
+    nodes[r].y = y;
+    hash->slot[r] = slot;
+    nodes[r].next = nodes[head].next;
+    nodes[r].prev = head;
+    nodes[nodes[head].next].prev = r;
+    nodes[head].next = r;
+}
+
+void swarm_unlink(SpatialHash *hash, int r) {
+    SwarmNode *nodes = hash->nodes;
+    nodes[nodes[r].prev].next = nodes[r].next;
+    nodes[nodes[r].next].prev = nodes[r].prev;
+    nodes[r].next = nodes[r].prev = r;
+}
+
+// 로봇 r의 위치 갱신: 같은 표 칸이면 좌표만 쓰고, 칸이 바뀌면 O(1)로 옮겨 연결
+void swarm_relocate(SpatialHash *hash, int r, int x, int y) {
+    int slot = swarm_slot(hash, x / hash->bucket_cells, y / hash->bucket_cells);
+    if (slot == hash->slot[r]) {
+        hash->nodes[r].x = x;
+        hash->nodes[r].y = y;
+        return;
+    }
+    swarm_unlink(hash, r);
+    swarm_link(hash, r, x, y);
+    hash->relinks++;
+}
+
+// 표 할당: 칸 수는 로봇 수의 2배 이상인 2의 거듭제곱, 모든 노드는 빈 리스트로 시작
+// 버킷 한 변은 닿는 거리의 2배 → 로봇에 가까운 쪽 2×2 버킷만 보면 됨
+bool swarm_hash_init(SpatialHash *hash, int robots, int cell_mm) {
+    hash->robots = robots;
+    hash->bits = 6;
+    while ((1 << hash->bits) < 2 * robots && hash->bits < 30) {
+        hash->bits++;
+    }
+    hash->bucket_cells = 2 * (SWARM_REACH_MM / cell_mm + 1);
+    hash->relinks = 0;
+    int nodes = robots + (1 << hash->bits);
+    hash->nodes = malloc(sizeof(SwarmNode) * nodes);
+    hash->slot = calloc(robots > 0 ? robots : 1, sizeof(int));
+    if (!hash->nodes || !hash->slot) {
+        return false;
+    }
+    for (int n = 0; n < nodes; n++) {
+        hash->nodes[n].next = hash->nodes[n].prev = n;
+    }
+    return true;
+}
+
+// self 주변 로봇 조회 (tick 시작 스냅숏, self에서 닿는 거리 안의 로봇은 모두 [x - 버킷/2, x + 버킷/2]의 2×2 버킷에 있음)
+// 비트 k: 탐지 지점 probes[k]가 다른 로봇 몸체 안, SWARM_BLOCKED: 중심을 (nx, ny)로 옮기면 다른 로봇 몸체와 겹침
+// 이미 겹친 로봇(같은 tick에 함께 들어온 경우)에서는 멀어지는 이동만 허용
+int swarm_neighbors(const SwarmWorld *world, int self, const int probes[][2], int n, int nx, int ny) {
+    const SpatialHash *hash = &world->hash;
+    const SwarmNode *nodes = hash->nodes;
+    int x = nodes[self].x, y = nodes[self].y;
+    int half = hash->bucket_cells / 2;
+    int bx = (x - half) / hash->bucket_cells;
+    int by = (y - half) / hash->bucket_cells;
+    int body_sq = 4 * world->radius_sq;
+    int hits = 0;
+    for (int dy = 0; dy <= 1; dy++) {
+        for (int dx = 0; dx <= 1; dx++) {
+            int head = hash->robots + swarm_slot(hash, bx + dx, by + dy);
+            for (int j = nodes[head].next; j != head; j = nodes[j].next) {
+                if (j == self) {
+                    continue;
+                }
+                for (int k = 0; k < n; k++) {
+                    int ex = probes[k][0] - nodes[j].x, ey = probes[k][1] - nodes[j].y;
+                    hits |= (ex * ex + ey * ey < world->radius_sq) << k;
+                }
+                int mx = nx - nodes[j].x, my = ny - nodes[j].y;
+                int ox = x - nodes[j].x, oy = y - nodes[j].y;
+                int d = mx * mx + my * my;
+                hits |= (d < body_sq && d <= ox * ox + oy * oy) * SWARM_BLOCKED;
+            }
+        }
+    }
+    return hits;
+}
+
+// 시작 위치: 몸체가 벽/가구에 걸리지 않고 다른 로봇과 겹치지 않는 빈 칸에 무작위로 놓음
+bool swarm_place(SwarmWorld *world, RVCFleet *fleet, unsigned long long seed) {
+    const GridMap *map = &world->map;
+    int radius = ENV_ROBOT_RADIUS_MM / map->cell_mm;
+    RngState rng;
+    rng_seed(&rng, seed, SWARM_PLACE_STREAM);
+    for (int i = 0; i < fleet->count; i++) {
+        int tries = 0;
+        for (;;) {
+            if (++tries > SWARM_PLACE_TRIES) {
+                fprintf(stderr, "No room for %d robots in a %d x %d m map (placed %d)\n",
+                        fleet->count, map->width * map->cell_mm / 1000,
+                        map->height * map->cell_mm / 1000, i);
+                return false;
+            }
+            unsigned long long r = rng_next(&rng);
+            int x = (int)((r & 0xFFFFFF) % (unsigned)map->width);
+            int y = (int)(((r >> 24) & 0xFFFFFF) % (unsigned)map->height);
+            if (grid_occupied(map, x, y) ||
+                grid_occupied(map, x - radius, y) || grid_occupied(map, x + radius, y) ||
+                grid_occupied(map, x, y - radius) || grid_occupied(map, x, y + radius)) {
+                continue;
+            }
+            swarm_link(&world->hash, i, x, y);
+            if (swarm_neighbors(world, i, NULL, 0, x, y)) {
+                swarm_unlink(&world->hash, i);
+                continue;
+            }
+            world->home_x[i] = (unsigned int)x << KIN_FRAC_BITS;
+            world->home_y[i] = (unsigned int)y << KIN_FRAC_BITS;
+            fleet->heading[i] = (unsigned char)((r >> 56) & 7);
+            break;
+        }
+    }
+    return true;
+}
+
+// fleet을 격자 세계에 놓음: 지도와 먼지는 grid 백엔드와 같은 방법으로 준비 (--map / --save-map / --room-m)
+// fleet 자세 단위를 지도 칸으로 바꿔 칸 번호를 시프트 하나로 구함
+bool swarm_init(SwarmWorld *world, RVCFleet *fleet, unsigned long long seed) {
+    int n = fleet->count > 0 ? fleet->count : 1;
+    world->enabled = false;
+    if (!io_grid_load_map(&world->map, seed)) {
+        return false;
+    }
+    const GridMap *map = &world->map;
+    int radius = ENV_ROBOT_RADIUS_MM / map->cell_mm;
+    world->radius_sq = radius * radius;
+    env_offsets(world->probe, ENV_ROBOT_RADIUS_MM + ENV_SENSOR_RANGE_MM, map->cell_mm);
+    env_offsets(world->body, ENV_ROBOT_RADIUS_MM, map->cell_mm);
+    kin_init(&fleet->kin, ENV_STEP_MM, map->cell_mm);
+    world->home_x = calloc(n, sizeof(unsigned int));
+    world->home_y = calloc(n, sizeof(unsigned int));
+    world->bumps = calloc(n, sizeof(unsigned int));
+    world->contacts = calloc(n, sizeof(unsigned int));
+    world->ahead = calloc(n, sizeof(unsigned char));
+    world->prev_x = calloc(n, sizeof(int));
+    world->prev_y = calloc(n, sizeof(int));
+    world->prev_valid = calloc(n, sizeof(unsigned char));
+    bool field = coverage_init(&world->coverage, map) && dust_init(&world->dust, map) &&
+                 dust_scatter(&world->dust, map, seed);
+    if (!swarm_hash_init(&world->hash, fleet->count, map->cell_mm) ||
+        !world->home_x || !world->home_y || !world->bumps || !world->contacts ||
+        !world->ahead || !world->prev_x || !world->prev_y || !world->prev_valid || !field) {
+        fprintf(stderr, "Swarm allocation failed (%d robots)\n", fleet->count);
+        swarm_free(world);
+        return false;
+    }
+    if (!swarm_place(world, fleet, seed)) {
+        swarm_free(world);
+        return false;
+    }
+    world->enabled = true;
+    return true;
+}
+
+void swarm_free(SwarmWorld *world) {
+    free(world->hash.nodes);
+    free(world->hash.slot);
+    free(world->home_x);
+    free(world->home_y);
+    free(world->bumps);
+    free(world->contacts);
+    free(world->ahead);
+    free(world->prev_x);
+    free(world->prev_y);
+    free(world->prev_valid);
+    dust_free(&world->dust);
+    coverage_free(&world->coverage);
+    grid_free(&world->map);
+    world->enabled = false;
+}
+
+// 센서 입력: 앞/왼쪽/오른쪽 탐지 지점이 벽/가구 칸이거나 다른 로봇 몸체 안이면 감지
+// 전진하면 다른 로봇과 겹치는 경우도 front (비스듬히 다가온 로봇은 탐지 지점 사이로 들어올 수 있음)
+// 먼지는 로봇 중심 칸의 공유 먼지 밀도 (grid 백엔드와 같은 문턱, tick 안에서는 아무도 치우지 않음)
+void swarm_sense(RVCFleet *fleet, int begin, int end) {
+    SwarmWorld *world = &swarm_world;
+    const SwarmNode *nodes = world->hash.nodes;
+    for (int i = begin; i < end; i++) {
+        int x = nodes[i].x, y = nodes[i].y;
+        int h = fleet->heading[i];
+        const int *f = world->probe[h];
+        const int *l = world->probe[(h + 6) & 7];
+        const int *r = world->probe[(h + 2) & 7];
+        const int probes[3][2] = {
+            {x + f[0], y + f[1]}, {x + l[0], y + l[1]}, {x + r[0], y + r[1]}
+        };
+        int ax = (int)(world->home_x[i] + fleet->pose_x[i]) + fleet->kin.step[h][0];
+        int ay = (int)(world->home_y[i] + fleet->pose_y[i]) + fleet->kin.step[h][1];
+        int robots = swarm_neighbors(world, i, probes, 3, ax >> KIN_FRAC_BITS, ay >> KIN_FRAC_BITS);
+        world->ahead[i] = (robots & SWARM_BLOCKED) != 0;
+        fleet->sensors[i] = (unsigned char)(
+            (grid_occupied(&world->map, probes[0][0], probes[0][1]) | (robots & 1) | world->ahead[i]) * SENSOR_FRONT
+            | (grid_occupied(&world->map, probes[1][0], probes[1][1]) | ((robots >> 1) & 1)) * SENSOR_LEFT
+            | (grid_occupied(&world->map, probes[2][0], probes[2][1]) | ((robots >> 2) & 1)) * SENSOR_RIGHT
+            | (dust_at(&world->dust, x, y) >= ENV_DUST_SENSE) * SENSOR_DUST);
+    }
+}
+
+// 이번 tick 모터 명령 적용 (kin_next)
+// 전진/후진 후 몸체 끝이 벽/가구 칸이거나 몸체가 다른 로봇과 겹치면 제자리 (전진은 swarm_sense의 판정 사용)
+void swarm_move(RVCFleet *fleet, int begin, int end) {
+    SwarmWorld *world = &swarm_world;
+    for (int i = begin; i < end; i++) {
+        int c = fleet->motor_cmd[i];
+        RobotPose p = {
+            (int)(world->home_x[i] + fleet->pose_x[i]),
+            (int)(world->home_y[i] + fleet->pose_y[i]),
+            fleet->heading[i]
+        };
+        RobotPose next = kin_next(&fleet->kin, p, c);
+        if (c == MOTOR_FORWARD || c == MOTOR_BACKWARD) {
+            int sign = c == MOTOR_FORWARD ? 1 : -1;
+            int cx = next.x >> KIN_FRAC_BITS, cy = next.y >> KIN_FRAC_BITS;
+            if (grid_occupied(&world->map, cx + sign * world->body[p.heading][0],
+                              cy + sign * world->body[p.heading][1])) {
+                world->bumps[i]++;
+                continue;
+            }
+            if (c == MOTOR_FORWARD ? world->ahead[i]
+                                 : (swarm_neighbors(world, i, NULL, 0, cx, cy) & SWARM_BLOCKED) != 0) {
+                world->contacts[i]++;
+                continue;
+            }
+        }
+        fleet->pose_x[i] += (unsigned int)(next.x - p.x);
+        fleet->pose_y[i] += (unsigned int)(next.y - p.y);
+        fleet->heading[i] = (unsigned char)next.heading;
+    }
+}
+
+// tick 끝 (모든 chunk 처리 후, 한 스레드): 청소 중인 로봇마다 센서를 읽은 칸(tick 시작 위치)의
+// 청소 범위와 먼지를 로봇 번호 순서로 갱신 (grid 백엔드처럼 센서는 치우기 전 값)
+// 그다음 스냅숏을 새 위치로 갱신, 버킷을 옮긴 로봇만 다시 연결
+void swarm_update(RVCFleet *fleet, long long time_us) {
+    SwarmWorld *world = &swarm_world;
+    const SwarmNode *nodes = world->hash.nodes;
+    for (int i = 0; i < fleet->count; i++) {
+        int x = nodes[i].x, y = nodes[i].y;
+        int c = fleet->cleaner_cmd[i];
+        bool cleaning = c == CLEANER_ON || c == CLEANER_POWERUP;
+        world->dust.detections += (fleet->sensors[i] & SENSOR_DUST) != 0;
+        if (cleaning) {
+            coverage_sweep(&world->coverage, &world->map, x, y,
+                           world->prev_x[i], world->prev_y[i], world->prev_valid[i]);
+            dust_clean(&world->dust, &world->map, x, y,
+                       c == CLEANER_POWERUP ? ENV_DUST_PICKUP_TURBO : ENV_DUST_PICKUP_NORMAL);
+            world->prev_x[i] = x;
+            world->prev_y[i] = y;
+        }
+        world->prev_valid[i] = cleaning;
+    }
+    coverage_tick(&world->coverage, &world->map, time_us);
+    for (int i = 0; i < fleet->count; i++) {
+        swarm_relocate(&world->hash, i,
+                       (int)(world->home_x[i] + fleet->pose_x[i]) >> KIN_FRAC_BITS,
+                       (int)(world->home_y[i] + fleet->pose_y[i]) >> KIN_FRAC_BITS);
+    }
+}
+
+void swarm_report(const RVCFleet *fleet, int ticks) {
+    const SwarmWorld *world = &swarm_world;
+    const SpatialHash *hash = &world->hash;
+    const GridMap *map = &world->map;
+    long long bumps = 0, contacts = 0;
+    for (int i = 0; i < fleet->count; i++) {
+        bumps += world->bumps[i];
+        contacts += world->contacts[i];
+    }
+    int slots = 1 << hash->bits, used = 0, longest = 0;
+    for (int s = 0; s < slots; s++) {
+        int head = hash->robots + s, len = 0;
+        for (int j = hash->nodes[head].next; j != head; j = hash->nodes[j].next) {
+            len++;
+        }
+        used += len > 0;
+        longest = len > longest ? len : longest;
+    }
+    double robot_ticks = (double)fleet->count * ticks;
+    printf("Swarm: %d robots in a %d x %d cell map (%d mm, %.1f%% free), blocked by walls %lld, "
+           "by robots %lld robot-ticks\n",
+           fleet->count, map->width, map->height, map->cell_mm,
+           100.0 * map->free_cells / ((double)map->width * map->height), bumps, contacts);
+    printf("Spatial hash: %d slots (%d in use, longest list %d), %d mm buckets, "
+           "%.4f relinks/robot-tick\n",
+           slots, used, longest, hash->bucket_cells * map->cell_mm,
+           robot_ticks > 0 ? hash->relinks / robot_ticks : 0.0);
+    coverage_report(&world->coverage, map);
+    dust_report(&world->dust);
+}
+
+/* ========== Fleet 스레드 풀 (work-stealing) ========== */
+
+
+
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#endif
+
+#define POOL_CHUNK_ROBOTS 4096  // 한 번에 가져가는 로봇 수 (벡터 폭의 배수)
+#define POOL_MAX_THREADS 256
+
+// 사용 가능한 코어 수
+int pool_cpu_count(void) {
+#ifndef _WIN32
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#else
+    return 1;
+#endif
+}
+
+// chunk 하나 처리: 센서 → FSM → 운동학
+// 로봇별 상태와 난수가 서로 독립이라 어느 스레드가 처리해도 결과가 같음
+// 공유 격자 세계에서는 다른 로봇을 tick 시작 위치(공간 해시 스냅숏)로만 보므로 마찬가지
+void pool_run_chunk(RVCFleet *fleet, int chunk) {
+    int begin = chunk * POOL_CHUNK_ROBOTS;
+    int end = begin + POOL_CHUNK_ROBOTS;
+    if (end > fleet->count) {
+        end = fleet->count;
+    }
+    if (swarm_world.enabled) {
+        swarm_sense(fleet, begin, end);
+        fleet_step(fleet, begin, end);
+        swarm_move(fleet, begin, end);
+        return;
+    }
+    fleet_sense(fleet, begin, end);
+    fleet_step(fleet, begin, end);
+    kin_fleet_step(fleet, begin, end);
+}
+
+#ifndef _WIN32
+
+// 워커별 chunk 구간 [chunk_begin, chunk_end)
+// next_chunk는 소유자와 훔치는 쪽이 함께 fetch_add 하므로 같은 chunk를 두 번 처리하지 않음
+// 워커마다 캐시 라인을 따로 써서 false sharing 방지
+typedef struct {
+    _Alignas(64) atomic_int next_chunk;
+    int chunk_begin;
+    int chunk_end;
+    int stolen;
+} PoolWorker;
+
+typedef struct {
+    RVCFleet *fleet;
+    VirtualClock *clk;
+    int ticks;
+    int threads;
+    PoolWorker *workers;
+    pthread_barrier_t barrier;
+    pthread_mutex_t gate_lock;  // 워커는 시작 신호까지 대기 → 생성된 워커 수로 barrier를 만든 뒤 출발
+    pthread_cond_t gate;
+    bool open;
+    long long step_us;
+} FleetPool;
+
+typedef struct {
+    FleetPool *pool;
+    int id;
+} PoolThreadArg;
+
+// 워커 루프: tick마다 barrier로 시작/끝을 맞춰 tick 간 순서를 결정적으로 유지
+void pool_worker_loop(FleetPool *pool, int id) {
+    PoolWorker *self = &pool->workers[id];
+    long long t0 = 0;
+    int chunk;
+
+    for (int t = 0; t < pool->ticks; t++) {
+        if (id == 0) {
+            clock_advance(pool->clk, t);
+            t0 = monotonic_us();
+        }
+        pthread_barrier_wait(&pool->barrier);  // tick 시작
+
+        // 1. 자기 구간을 앞에서부터 소비
+        while ((chunk = atomic_fetch_add(&self->next_chunk, 1)) < self->chunk_end) {
+            pool_run_chunk(pool->fleet, chunk);
+        }
+        // 2. 다 끝나면 다른 워커의 남은 chunk를 훔침
+        for (int k = 1; k < pool->threads; k++) {
+            PoolWorker *victim = &pool->workers[(id + k) % pool->threads];
+            while ((chunk = atomic_fetch_add(&victim->next_chunk, 1)) < victim->chunk_end) {
+                pool_run_chunk(pool->fleet, chunk);
+                self->stolen++;
+            }
+        }
+
+        pthread_barrier_wait(&pool->barrier);  // tick 끝: 모든 로봇 처리 완료
+        // 다음 tick 시작 barrier 전이므로 아무도 이 구간을 훔치지 않음
+        atomic_store(&self->next_chunk, self->chunk_begin);
+
+        if (id == 0) {
+            if (swarm_world.enabled) {
+                swarm_update(pool->fleet, pool->clk->now_us);   // 다른 워커는 다음 tick 시작 barrier에서 기다림
+            }
+            pool->fleet->ticks++;           // 다음 tick 시작 barrier 뒤에 워커가 읽음
+            pool->step_us += monotonic_us() - t0;
+            clock_tick_done(pool->clk);
+        }
+    }
+}
+
+void *pool_thread_main(void *arg) {
+    PoolThreadArg *a = arg;
+    FleetPool *pool = a->pool;
+    pthread_mutex_lock(&pool->gate_lock);
+    while (!pool->open) {
+        pthread_cond_wait(&pool->gate, &pool->gate_lock);
+    }
+    pthread_mutex_unlock(&pool->gate_lock);
+    pool_worker_loop(pool, a->id);
+    return NULL;
+}
+
+// chunk를 워커 수로 균등 분할 (초기 소유 구간)
+void pool_split(FleetPool *pool, int chunks) {
+    for (int w = 0; w < pool->threads; w++) {
+        pool->workers[w].chunk_begin = (int)((long long)chunks * w / pool->threads);
+        pool->workers[w].chunk_end = (int)((long long)chunks * (w + 1) / pool->threads);
+        pool->workers[w].stolen = 0;
+        atomic_init(&pool->workers[w].next_chunk, pool->workers[w].chunk_begin);
+    }
+}
+
+#endif
+
+// Fleet을 threads개 워커로 ticks만큼 실행
+// threads <= 0이면 모든 코어 사용, 반환값은 tick 처리(센서+FSM)에 걸린 시간(us)
+long long pool_run_fleet(RVCFleet *fleet, VirtualClock *clk, int ticks,
+                         int *threads, int *stolen) {
+    int chunks = (fleet->count + POOL_CHUNK_ROBOTS - 1) / POOL_CHUNK_ROBOTS;
+    int n = *threads > 0 ? *threads : pool_cpu_count();
+    if (n > POOL_MAX_THREADS) {
+        n = POOL_MAX_THREADS;
+    }
+    if (n > chunks) {
+        n = chunks > 0 ? chunks : 1;
+    }
+    *threads = n;
+    *stolen = 0;
+
+#ifndef _WIN32
+    PoolWorker *workers = n > 1 ? aligned_alloc(64, sizeof(PoolWorker) * n) : NULL;
+    if (workers) {
+        FleetPool pool;
+        pthread_t tids[POOL_MAX_THREADS];
+        PoolThreadArg args[POOL_MAX_THREADS];
+
+        pool.fleet = fleet;
+        pool.clk = clk;
+        pool.ticks = ticks;
+        pool.threads = n;
+        pool.step_us = 0;
+        pool.workers = workers;
+        pool.open = false;
+        pthread_mutex_init(&pool.gate_lock, NULL);
+        pthread_cond_init(&pool.gate, NULL);
+
+        // 워커 0은 호출 스레드가 직접 수행, 생성에 실패하면 거기까지 만든 워커로 실행
+        int started = 1;
+        for (int w = 1; w < n; w++) {
+            args[w].pool = &pool;
+            args[w].id = w;
+            if (pthread_create(&tids[w], NULL, pool_thread_main, &args[w]) != 0) {
+                fprintf(stderr, "Fleet pool: started %d of %d worker threads\n", started, n);
+                break;
+            }
+            started++;
+        }
+        pool.threads = started;
+        pool_split(&pool, chunks);
+        // barrier를 만들 수 없으면 워커는 tick 없이 끝나고 아래 단일 스레드 경로로 실행
+        bool ok = pthread_barrier_init(&pool.barrier, NULL, started) == 0;
+        if (!ok) {
+            pool.ticks = 0;
+        }
+        pthread_mutex_lock(&pool.gate_lock);
+        pool.open = true;
+        pthread_cond_broadcast(&pool.gate);
+        pthread_mutex_unlock(&pool.gate_lock);
+
+        if (ok) {
+            pool_worker_loop(&pool, 0);
+        }
+        for (int w = 1; w < started; w++) {
+            pthread_join(tids[w], NULL);
+        }
+        pthread_mutex_destroy(&pool.gate_lock);
+        pthread_cond_destroy(&pool.gate);
+        if (ok) {
+            for (int w = 0; w < started; w++) {
+                *stolen += pool.workers[w].stolen;
+            }
+            pthread_barrier_destroy(&pool.barrier);
+            free(pool.workers);
+            *threads = started;
+            return pool.step_us;
+        }
+        free(pool.workers);
+    }
+    *threads = 1;  // 워커 할당이나 barrier 생성 실패 시 단일 스레드로 실행
+#endif
+
+    // 단일 스레드 (또는 _WIN32): 같은 chunk 순서로 실행
+    long long step_us = 0;
+    for (int t = 0; t < ticks; t++) {
+        clock_advance(clk, t);
+        long long t0 = monotonic_us();
+        for (int c = 0; c < chunks; c++) {
+            pool_run_chunk(fleet, c);
+        }
+        if (swarm_world.enabled) {
+            swarm_update(fleet, clk->now_us);
+        }
+        fleet->ticks++;
+        step_us += monotonic_us() - t0;
+        clock_tick_done(clk);
+    }
+    return step_us;
+}
+
+/* ========== 상태 공간 탐색 (Deadlock / Livelock 검사) ========== */
+
+
+
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#define EXPLORE_ATOMIC _Atomic
+#else
+#define EXPLORE_ATOMIC          // _WIN32: 단일 스레드 탐색
+#endif
+
+#define EXPLORE_WORDS 16                        // 센서 워드 (Front/Left/Right/Dust)
+#define EXPLORE_MAX_NODES (1 << 20)             // 방문 집합에 담을 수 있는 구성 수
+#define EXPLORE_SLOTS (EXPLORE_MAX_NODES * 2)   // 해시 칸 수 (적재율 1/2 이하)
+#define EXPLORE_CHUNK 64                        // 스레드가 frontier에서 한 번에 가져가는 구성 수
+#define EXPLORE_MAX_THREADS 256
+
+// 함수 선언
+void fsm_executor(RVCContext *ctx);
+void evlog_mute(bool muted);
+int pool_cpu_count(void);
+long long monotonic_us(void);
+const char *motor_command_name(int cmd);
+const char *cleaner_command_name(int cmd);
+
+// 탐색 상태
+// 구성(configuration) = fsm_executor가 읽는 RVCContext 필드 전체를 64비트 키로 압축한 것
+// 구성 번호는 발견 순서이므로 BFS 깊이 d의 frontier는 항상 번호가 연속인 구간
+typedef struct {
+    EXPLORE_ATOMIC unsigned long long *keys;    // 해시 칸: 0 = 빈 칸, 그 외 = 키 + 1
+    EXPLORE_ATOMIC int *ids;                    // 칸별 구성 번호 (-1: 삽입한 스레드가 기록 전)
+    unsigned long long *nodes;  // 구성 번호 → 키
+    int *succ;                  // [구성 × 센서 워드] → 다음 구성 번호
+    int *parent;                // 처음 발견한 이전 구성 (최단 경로 복원용)
+    unsigned char *parent_word;
+    EXPLORE_ATOMIC int count;   // 발견한 구성 수
+    EXPLORE_ATOMIC int next;    // 현재 frontier에서 다음에 가져갈 구성
+    EXPLORE_ATOMIC bool overflow;   // 구성 수 한계 또는 키 인코딩 범위 초과
+    int level_begin;            // 현재 frontier [level_begin, level_end)
+    int level_end;
+    int depth;
+    bool done;
+    int threads;
+#ifndef _WIN32
+    pthread_barrier_t barrier;
+#endif
+} StateExplorer;
+
+int explore_fetch_add(EXPLORE_ATOMIC int *p, int n) {
+#ifndef _WIN32
+    return atomic_fetch_add(p, n);
+#else
+    int old = *p;
+    *p += n;
+    return old;
+#endif
+}
+
+bool explore_claim(EXPLORE_ATOMIC unsigned long long *slot, unsigned long long *expected,
+                   unsigned long long key) {
+#ifndef _WIN32
+    return atomic_compare_exchange_strong(slot, expected, key);
+#else
+    if (*slot != *expected) {
+        *expected = *slot;
+        return false;
+    }
+    *slot = key;
+    return true;
+#endif
+}
+
+// 구성 → 키 (범위를 벗어나면 false)
+// state_duration은 상태의 타이머 한계에서 포화: fsm_executor는 "한계 이상" 여부만 보므로
+// 한계를 넘은 값들은 같은 구성 (타이머 없는 상태는 항상 0)
+bool explore_encode(const RVCContext *ctx, unsigned long long *key) {
+    int limit = fsm_v1_timer_limit[ctx->state];
+    int duration = ctx->state_duration < limit ? ctx->state_duration : limit;
+    if (ctx->dust_clean_timer < -128 || ctx->dust_clean_timer > 127 ||
+        ctx->backward_timer < -128 || ctx->backward_timer > 127) {
+        return false;
+    }
+    *key = (unsigned long long)ctx->state
+        | (unsigned long long)ctx->motor_cmd << 3
+        | (unsigned long long)ctx->cleaner_cmd << 6
+        | (unsigned long long)duration << 8
+        | (unsigned long long)(ctx->dust_clean_timer + 128) << 16
+        | (unsigned long long)(ctx->backward_timer + 128) << 24;
+    return true;
+}
+
+void explore_decode(unsigned long long key, RVCContext *ctx) {
+    ctx->state = (SystemState)(key & 7);
+    ctx->motor_cmd = (MotorCommand)((key >> 3) & 7);
+    ctx->cleaner_cmd = (CleanerCommand)((key >> 6) & 3);
+    ctx->state_duration = (int)((key >> 8) & 0xFF);
+    ctx->dust_clean_timer = (int)((key >> 16) & 0xFF) - 128;
+    ctx->backward_timer = (int)((key >> 24) & 0xFF) - 128;
+}
+
+// 전진(Moving) 중인 구성 = 진행(progress)
+bool explore_progress(unsigned long long key) {
+    return (key & 7) == STATE_MOVING;
+}
+
+void explore_print_node(const StateExplorer *ex, int id) {
+    const char *state_names[] = {
+        "MOVING", "TURNING", "BACKWARDING", "DUST_CLEANING", "PAUSE"
+    };
+    RVCContext ctx;
+    explore_decode(ex->nodes[id], &ctx);
+    printf("%s duration=%d dust_timer=%d back_timer=%d motor=%s cleaner=%s",
+           state_names[ctx.state], ctx.state_duration, ctx.dust_clean_timer,
+           ctx.backward_timer, motor_command_name(ctx.motor_cmd),
+           cleaner_command_name(ctx.cleaner_cmd));
+}
+
+// 시작 구성에서 id까지의 최단 센서 입력열
+void explore_print_path(const StateExplorer *ex, int id) {
+    unsigned char words[256];
+    int n = 0;
+    for (int v = id; ex->parent[v] >= 0 && n < 256; v = ex->parent[v]) {
+        words[n++] = ex->parent_word[v];
+    }
+    printf("    reached in %d ticks, sensor words:", n);
+    while (n > 0) {
+        printf(" 0x%X", words[--n]);
+    }
+    printf("\n");
+}
+
+// 방문 집합에 키를 넣고 구성 번호를 반환 (이미 있으면 기존 번호)
+// 선형 탐사 + CAS: 칸을 먼저 차지한 스레드만 번호를 발급하고 나머지는 번호 기록을 기다림
+int explore_insert(StateExplorer *ex, unsigned long long key, int from, int word) {
+    unsigned long long slot = (key + 1) * 0x9E3779B97F4A7C15ULL;
+    unsigned long long h = (slot >> 32) & (EXPLORE_SLOTS - 1);
+
+    for (;;) {
+        unsigned long long seen = 0;
+        if (explore_claim(&ex->keys[h], &seen, key + 1)) {
+            int id = explore_fetch_add(&ex->count, 1);
+            if (id >= EXPLORE_MAX_NODES) {
+                ex->overflow = true;
+                id = EXPLORE_MAX_NODES;     // 번호 없음 (탐색은 실패로 끝남)
+            } else {
+                ex->nodes[id] = key;
+                ex->parent[id] = from;
+                ex->parent_word[id] = (unsigned char)word;
+            }
+            ex->ids[h] = id;
+            return id;
+        }
+        if (seen == key + 1) {
+            int id;
+            while ((id = ex->ids[h]) < 0) {
+                // 다른 스레드가 방금 차지한 칸: 번호 기록까지 짧게 대기
+            }
+            return id;
+        }
+        h = (h + 1) & (EXPLORE_SLOTS - 1);
+    }
+}
+
+// 구성 하나를 모든 센서 워드로 1 tick 실행 (실제 fsm_executor 사용)
+void explore_expand(StateExplorer *ex, int id) {
+    RVCContext ctx = {0};
+    explore_decode(ex->nodes[id], &ctx);
+    for (int w = 0; w < EXPLORE_WORDS; w++) {
+        RVCContext next = ctx;
+        unsigned long long key;
+        next.sensors = (SensorData)w;
+        fsm_executor(&next);
+        if (!explore_encode(&next, &key)) {
+            ex->overflow = true;
+            ex->succ[id * EXPLORE_WORDS + w] = id;
+            continue;
+        }
+        ex->succ[id * EXPLORE_WORDS + w] = explore_insert(ex, key, id, w);
+    }
+}
+
+// 현재 frontier를 chunk 단위로 가져가며 확장
+void explore_level(StateExplorer *ex) {
+    int begin;
+    while ((begin = explore_fetch_add(&ex->next, EXPLORE_CHUNK)) < ex->level_end) {
+        int end = begin + EXPLORE_CHUNK < ex->level_end ? begin + EXPLORE_CHUNK : ex->level_end;
+        for (int id = begin; id < end; id++) {
+            explore_expand(ex, id);
+        }
+    }
+}
+
+// 깊이 하나가 끝난 뒤 다음 frontier 설정 (한 스레드만 호출)
+void explore_next_level(StateExplorer *ex) {
+    int count = ex->count < EXPLORE_MAX_NODES ? ex->count : EXPLORE_MAX_NODES;
+    ex->level_begin = ex->level_end;
+    ex->level_end = count;
+    ex->next = ex->level_begin;
+    ex->done = ex->level_begin == ex->level_end || ex->overflow;
+    ex->depth += !ex->done;
+}
+
+#ifndef _WIN32
+
+// 깊이 단위 동기 BFS: barrier로 깊이를 맞추고 스레드 0이 다음 frontier를 설정
+void explore_worker_loop(StateExplorer *ex, int id) {
+    for (;;) {
+        pthread_barrier_wait(&ex->barrier);     // 깊이 시작
+        if (ex->done) {
+            break;
+        }
+        explore_level(ex);
+        pthread_barrier_wait(&ex->barrier);     // 깊이 끝: frontier 전체 확장 완료
+        if (id == 0) {
+            explore_next_level(ex);
+        }
+    }
+}
+
+typedef struct {
+    StateExplorer *ex;
+    int id;
+} ExploreThreadArg;
+
+void *explore_thread_main(void *arg) {
+    ExploreThreadArg *a = arg;
+    explore_worker_loop(a->ex, a->id);
+    return NULL;
+}
+
+#endif
+
+// 시작 구성(initialize_system과 같은 값)에서 도달 가능한 모든 구성을 BFS로 탐색
+void explore_bfs(StateExplorer *ex) {
+    RVCContext init = {0};
+    unsigned long long key;
+    init.state = STATE_MOVING;
+    init.motor_cmd = MOTOR_FORWARD;
+    init.cleaner_cmd = CLEANER_ON;
+    explore_encode(&init, &key);
+    explore_insert(ex, key, -1, 0);
+
+    ex->level_begin = 0;
+    ex->level_end = 1;
+    ex->next = 0;
+    ex->depth = 0;
+    ex->done = false;
+
+#ifndef _WIN32
+    if (ex->threads > 1) {
+        pthread_t tids[EXPLORE_MAX_THREADS];
+        ExploreThreadArg args[EXPLORE_MAX_THREADS];
+        pthread_barrier_init(&ex->barrier, NULL, ex->threads);
+        for (int t = 1; t < ex->threads; t++) {
+            args[t].ex = ex;
+            args[t].id = t;
+            pthread_create(&tids[t], NULL, explore_thread_main, &args[t]);
+        }
+        explore_worker_loop(ex, 0);
+        for (int t = 1; t < ex->threads; t++) {
+            pthread_join(tids[t], NULL);
+        }
+        pthread_barrier_destroy(&ex->barrier);
+        return;
+    }
+#endif
+    ex->threads = 1;
+    while (!ex->done) {
+        explore_level(ex);
+        explore_next_level(ex);
+    }
+}
+
+// 진행(Moving) 구성을 뺀 부분 그래프의 강연결요소(SCC) 분해 (Tarjan, 재귀 대신 명시적 스택)
+// 이 그래프의 순환 = Moving을 한 번도 거치지 않고 계속 돌 수 있는 구성열
+// comp[v]: v가 속한 SCC 번호 (진행 구성은 -1), 반환값은 SCC 수 (실패 시 -1)
+int explore_scc(const StateExplorer *ex, int n, int *comp) {
+    int *index = malloc(sizeof(int) * n);
+    int *low = malloc(sizeof(int) * n);
+    int *stack = malloc(sizeof(int) * n);
+    int *call_node = malloc(sizeof(int) * n);
+    int *call_edge = malloc(sizeof(int) * n);
+    bool *on_stack = calloc(n, sizeof(bool));
+    int comps = -1;
+
+    if (index && low && stack && call_node && call_edge && on_stack) {
+        int counter = 0, sp = 0;
+        comps = 0;
+        for (int v = 0; v < n; v++) {
+            index[v] = -1;
+            comp[v] = -1;
+        }
+        for (int root = 0; root < n; root++) {
+            if (index[root] >= 0 || explore_progress(ex->nodes[root])) {
+                continue;
+            }
+            int cp = 0;
+            index[root] = low[root] = counter++;
+            stack[sp++] = root;
+            on_stack[root] = true;
+            call_node[cp] = root;
+            call_edge[cp++] = 0;
+
+            while (cp > 0) {
+                int v = call_node[cp - 1];
+                if (call_edge[cp - 1] < EXPLORE_WORDS) {
+                    int w = ex->succ[v * EXPLORE_WORDS + call_edge[cp - 1]++];
+                    if (explore_progress(ex->nodes[w])) {
+                        continue;
+                    }
+                    if (index[w] < 0) {
+                        index[w] = low[w] = counter++;
+                        stack[sp++] = w;
+                        on_stack[w] = true;
+                        call_node[cp] = w;
+                        call_edge[cp++] = 0;
+                    } else if (on_stack[w] && index[w] < low[v]) {
+                        low[v] = index[w];
+                    }
+                    continue;
+                }
+                cp--;
+                if (cp > 0 && low[v] < low[call_node[cp - 1]]) {
+                    low[call_node[cp - 1]] = low[v];
+                }
+                if (low[v] == index[v]) {
+                    int w;
+                    do {
+                        w = stack[--sp];
+                        on_stack[w] = false;
+                        comp[w] = comps;
+                    } while (w != v);
+                    comps++;
+                }
+            }
+        }
+    }
+
+    free(index);
+    free(low);
+    free(stack);
+    free(call_node);
+    free(call_edge);
+    free(on_stack);
+    return comps;
+}
+
+// 장애물/먼지가 없는 입력(워드 0)만 계속 들어올 때 진행 구성까지의 tick 수
+// -1: 진행 없이 순환 (길이 트인 상황에서의 livelock)
+void explore_clear_path(const StateExplorer *ex, int n, int *dist) {
+    int *path = malloc(sizeof(int) * n);
+    for (int v = 0; v < n; v++) {
+        dist[v] = explore_progress(ex->nodes[v]) ? 0 : -2;     // -2: 미확인
+    }
+    for (int v = 0; v < n && path; v++) {
+        int len = 0, u = v;
+        while (dist[u] == -2) {
+            dist[u] = -3;       // 현재 경로 위
+            path[len++] = u;
+            u = ex->succ[u * EXPLORE_WORDS];
+        }
+        int d = dist[u] == -3 ? -1 : dist[u];
+        while (len > 0) {
+            u = path[--len];
+            dist[u] = d < 0 ? -1 : ++d;
+        }
+    }
+    free(path);
+}
+
+// 탐색 결과 분석과 보고
+// - 도달 불가 상태: 어떤 센서 입력열로도 들어가지 않는 FSM 상태
+// - Deadlock / Livelock: Moving 없는 순환 중 빠져나가는 전이가 없는(닫힌) 것
+//   → 센서 입력이 무엇이든 다시는 전진하지 못함 (SA PDF p.3 "Stop 상태 Deadlock")
+// - 센서 의존 순환: Moving 없이 돌 수 있지만 입력에 따라 빠져나갈 수 있는 순환 (장애물이 계속될 때)
+// - 길 트임 복귀: 장애물/먼지가 없으면 모든 구성이 유한 tick 안에 Moving으로 돌아오는지
+int explore_report(const StateExplorer *ex, long long elapsed_us) {
+    const char *state_names[] = {
+        "MOVING", "TURNING", "BACKWARDING", "DUST_CLEANING", "PAUSE"
+    };
+    int n = ex->count;
+    int *comp = malloc(sizeof(int) * n);
+    int *dist = malloc(sizeof(int) * n);
+    int comps = comp && dist ? explore_scc(ex, n, comp) : -1;
+    if (comps < 0) {
+        fprintf(stderr, "Explorer: analysis allocation failed (%d configurations)\n", n);
+        free(comp);
+        free(dist);
+        return 1;
+    }
+    // comps가 0이어도 할당 크기가 0이 되지 않도록 + 1
+    int *size = calloc(comps + 1, sizeof(int));
+    int *example = malloc(sizeof(int) * (comps + 1));
+    bool *closed = malloc(sizeof(bool) * (comps + 1));
+    bool *cyclic = calloc(comps + 1, sizeof(bool));
+    bool reached[5] = {false};
+    int failures = 0;
+
+    for (int c = 0; c < comps; c++) {
+        closed[c] = true;
+        example[c] = -1;
+    }
+    for (int v = 0; v < n; v++) {
+        int c = comp[v];
+        reached[ex->nodes[v] & 7] = true;
+        if (c < 0) {
+            continue;
+        }
+        size[c]++;
+        if (example[c] < 0) {
+            example[c] = v;     // BFS 순서 → 시작 구성에서 가장 가까운 구성
+        }
+        for (int w = 0; w < EXPLORE_WORDS; w++) {
+            int u = ex->succ[v * EXPLORE_WORDS + w];
+            closed[c] &= comp[u] == c;
+            cyclic[c] |= comp[u] == c;
+        }
+    }
+    explore_clear_path(ex, n, dist);
+
+    printf("=== State Space Exploration: V1 fsm_executor ===\n");
+    printf("Threads: %d, BFS depth: %d, time: %.1f ms\n",
+           ex->threads, ex->depth, elapsed_us / 1000.0);
+    printf("Reachable configurations: %d (x %d sensor words = %lld transitions)\n",
+           n, EXPLORE_WORDS, (long long)n * EXPLORE_WORDS);
+
+    printf("Unreachable states:");
+    int unreachable = 0;
+    for (int s = 0; s < 5; s++) {
+        if (!reached[s]) {
+            printf(" %s", state_names[s]);
+            unreachable++;
+        }
+    }
+    printf("%s\n", unreachable ? "" : " none");
+
+    int deadlocks = 0, livelocks = 0, env_cycles = 0, env_nodes = 0;
+    for (int c = 0; c < comps; c++) {
+        if (!cyclic[c]) {
+            continue;
+        }
+        if (!closed[c]) {
+            env_cycles++;
+            env_nodes += size[c];
+            continue;
+        }
+        // 닫힌 SCC: 어떤 입력으로도 빠져나갈 수 없음
+        if (size[c] == 1) {
+            deadlocks++;
+            printf("DEADLOCK: ");
+        } else {
+            livelocks++;
+            printf("LIVELOCK (%d configurations): ", size[c]);
+        }
+        explore_print_node(ex, example[c]);
+        printf("\n");
+        explore_print_path(ex, example[c]);
+    }
+    printf("Deadlocks (stuck for every sensor input): %d\n", deadlocks);
+    printf("Livelocks (closed cycles never reaching MOVING): %d\n", livelocks);
+    printf("Sensor-dependent cycles without MOVING: %d SCCs, %d configurations "
+           "(persist only while obstacles persist)\n", env_cycles, env_nodes);
+
+    int stuck = 0, worst = 0, worst_node = 0;
+    for (int v = 0; v < n; v++) {
+        if (dist[v] < 0) {
+            if (stuck++ == 0) {
+                printf("NO RECOVERY on clear path: ");
+                explore_print_node(ex, v);
+                printf("\n");
+                explore_print_path(ex, v);
+            }
+        } else if (dist[v] > worst) {
+            worst = dist[v];
+            worst_node = v;
+        }
+    }
+    if (stuck > 0) {
+        printf("Clear-path recovery: %d configurations never return to MOVING\n", stuck);
+    } else {
+        printf("Clear-path recovery: every configuration returns to MOVING within %d ticks "
+               "(worst: ", worst);
+        explore_print_node(ex, worst_node);
+        printf(")\n");
+    }
+
+    failures = deadlocks + livelocks + (stuck > 0);
+    printf("Result: %s\n", failures ? "FAIL" : "PASS");
+
+    free(comp);
+    free(dist);
+    free(size);
+    free(example);
+    free(closed);
+    free(cyclic);
+    return failures ? 1 : 0;
+}
+
+// 상태 공간 탐색 모드 진입점 (--explore)
+// threads <= 0이면 모든 코어 사용, 반환값은 프로세스 종료 코드 (0: 문제 없음)
+int explore_run(int threads) {
+    StateExplorer ex;
+    int n = threads > 0 ? threads : pool_cpu_count();
+    if (n > EXPLORE_MAX_THREADS) {
+        n = EXPLORE_MAX_THREADS;
+    }
+
+    ex.keys = malloc(sizeof(*ex.keys) * EXPLORE_SLOTS);
+    ex.ids = malloc(sizeof(*ex.ids) * EXPLORE_SLOTS);
+    ex.nodes = malloc(sizeof(*ex.nodes) * EXPLORE_MAX_NODES);
+    ex.succ = malloc(sizeof(*ex.succ) * EXPLORE_MAX_NODES * EXPLORE_WORDS);
+    ex.parent = malloc(sizeof(*ex.parent) * EXPLORE_MAX_NODES);
+    ex.parent_word = malloc(EXPLORE_MAX_NODES);
+    ex.count = 0;
+    ex.overflow = false;
+    ex.threads = n;
+
+    int result = 1;
+    if (!ex.keys || !ex.ids || !ex.nodes || !ex.succ || !ex.parent || !ex.parent_word) {
+        fprintf(stderr, "Explorer allocation failed\n");
+    } else {
+        for (int h = 0; h < EXPLORE_SLOTS; h++) {
+            ex.keys[h] = 0;
+            ex.ids[h] = -1;
+        }
+        evlog_mute(true);   // 탐색 중 fsm_executor의 전이 메시지는 출력하지 않음
+        long long t0 = monotonic_us();
+        explore_bfs(&ex);
+        long long elapsed_us = monotonic_us() - t0;
+        evlog_mute(false);
+
+        if (ex.overflow) {
+            fprintf(stderr, "Explorer: state space exceeds %d configurations or key range\n",
+                    EXPLORE_MAX_NODES);
+        } else {
+            result = explore_report(&ex, elapsed_us);
+        }
+    }
+
+    free(ex.keys);
+    free(ex.ids);
+    free(ex.nodes);
+    free(ex.succ);
+    free(ex.parent);
+    free(ex.parent_word);
+    return result;
+}
+
+/* ========== 이벤트 로그 (lock-free 바이너리 링 버퍼) ========== */
+
+
+
+
+
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sched.h>
+#endif
+
+// 스레드별 링 크기 (2의 거듭제곱, 레코드 24바이트 → 24 MB)
+// 텍스트 drain은 생산자보다 몇 배 느리므로 (레코드당 fprintf) 링이 수십만 tick의 밀린 레코드를 담아야
+// 생산자가 FSM 경로에서 기다리지 않음. 큰 할당은 mmap이라 실제로 쓴 페이지만 메모리를 차지
+#define LOG_RING_RECORDS (1 << 20)
+#define LOG_MAX_RINGS 256
+#define LOG_FILE_MAGIC "RVC1LOG2"   // 바이너리 로그 파일 머리말 (8바이트, 버전별로 다름, 끝자리는 레코드 형식 개정: 2 = 64비트 순번)
+
+// 함수 선언
+const char *motor_command_name(int cmd);
+const char *cleaner_command_name(int cmd);
+void render_status(const LogRecord *rec, FILE *out);
+
+// 레코드 1개를 오늘과 같은 텍스트로 출력 (drain 스레드와 오프라인 디코더가 공유)
+void evlog_render(const LogRecord *rec, FILE *out) {
+    switch (rec->node) {
+#if RVC_LOG_LEVEL >= RVC_LOG_TRANSITION
+        case LOG_NODE_FSM:
+            fprintf(out, "%s\n", fsm_v1_messages[rec->reason]);
+            break;
+#endif
+        case LOG_NODE_MOTOR:
+            fprintf(out, "  [MOTOR] %s\n", motor_command_name(rec->to));
+            break;
+        case LOG_NODE_CLEANER:
+            fprintf(out, "  [CLEANER] %s\n", cleaner_command_name(rec->to));
+            break;
+        case LOG_NODE_STATUS:
+        case LOG_NODE_SKIP:
+            render_status(rec, out);
+            break;
+        case LOG_NODE_SCHED:
+            fprintf(out, "[SCHED] jitter=%d us, work=%d us\n", rec->value, rec->value2);
+            break;
+        case LOG_NODE_OUTPUT:
+            if (rec->from & (1u << ACTUATOR_MOTOR)) {
+                fprintf(out, "  [MOTOR] %s\n", motor_command_name(rec->to));
+            }
+            if (rec->from & (1u << ACTUATOR_CLEANER)) {
+                fprintf(out, "  [CLEANER] %s\n", cleaner_command_name(rec->reason));
+            }
+            break;
+    }
+}
+
+#ifndef _WIN32
+
+// 스레드 하나가 쓰고(생산자) drain 스레드가 읽는(소비자) 단일 생산자/단일 소비자 링
+// head/tail을 캐시 라인으로 분리하고 생산자는 head 사본을 둬서 공유 라인 읽기를 줄임
+typedef struct {
+    _Alignas(64) atomic_uint head;  // 소비자가 읽은 위치
+    _Alignas(64) atomic_uint tail;  // 생산자가 쓴 위치
+    unsigned int cached_head;       // 생산자가 마지막으로 본 head
+    unsigned int full_waits;        // 링이 가득 차 기다린 횟수
+    LogRecord records[LOG_RING_RECORDS];
+} LogRing;
+
+typedef struct {
+    LogRing *rings[LOG_MAX_RINGS];
+    atomic_int ring_count;
+    atomic_bool stop;
+    unsigned long long next_seq;    // drain 스레드가 다음에 출력할 순번
+    // 다음에 발급할 순번: 생산자마다 fetch_add하는 유일한 공유 쓰기라 캐시 라인을 따로 둠
+    // (drain 스레드가 읽는 ring_count / next_seq와 같은 라인이면 기록마다 라인을 빼앗김)
+    _Alignas(64) atomic_ullong seq;
+    pthread_mutex_t attach_lock;    // 링 등록 (스레드당 한 번)
+    pthread_t drainer;
+    bool running;
+} LogRings;
+
+LogRings evlog_rings = { .attach_lock = PTHREAD_MUTEX_INITIALIZER };
+_Thread_local LogRing *evlog_ring;
+
+#endif
+
+// 출력 대상과 통계
+typedef struct {
+    FILE *out;                  // NULL: stdout
+    bool binary;                // true: 레코드를 그대로 파일에 저장
+    const char *path;
+    unsigned long long written;
+    unsigned long long dropped;
+    unsigned long long full_waits;  // 링이 가득 차 생산자가 기다린 횟수 (모든 링 합계)
+    unsigned long long seq;     // 동기 출력용 순번 (drain 스레드 없을 때)
+    bool muted;                 // true: 기록하지 않음 (상태 공간 탐색 중)
+} EventLog;
+
+EventLog evlog;
+_Thread_local int evlog_tick;   // 이 스레드가 처리 중인 tick
+
+// 레코드 1개를 출력 대상에 기록
+void evlog_write(const LogRecord *rec) {
+    FILE *out = evlog.out ? evlog.out : stdout;
+    if (evlog.binary) {
+        fwrite(rec, sizeof(*rec), 1, out);
+    } else {
+        evlog_render(rec, out);
+    }
+    evlog.written++;
+}
+
+void evlog_set_tick(int tick) {
+    evlog_tick = tick;
+}
+
+#ifndef _WIN32
+
+// 호출 스레드의 링을 만들어 등록 (실패 시 NULL)
+LogRing *evlog_attach(void) {
+    size_t size = (sizeof(LogRing) + 63) / 64 * 64;  // aligned_alloc 크기는 정렬의 배수
+    LogRing *ring = aligned_alloc(64, size);
+    if (!ring) {
+        return NULL;
+    }
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    ring->cached_head = 0;
+    ring->full_waits = 0;
+
+    pthread_mutex_lock(&evlog_rings.attach_lock);
+    int n = atomic_load(&evlog_rings.ring_count);
+    if (n < LOG_MAX_RINGS) {
+        evlog_rings.rings[n] = ring;
+        atomic_store_explicit(&evlog_rings.ring_count, n + 1, memory_order_release);
+    } else {
+        free(ring);
+        ring = NULL;
+    }
+    pthread_mutex_unlock(&evlog_rings.attach_lock);
+    evlog_ring = ring;
+    return ring;
+}
+
+// 모든 링에서 순번 순서대로 출력 가능한 레코드를 출력하고 개수를 반환
+// 링마다 순번이 증가하므로 다음 순번은 항상 어느 링의 맨 앞에 있음
+// (아직 게시 전이면 다음 호출에서 출력)
+int evlog_drain(void) {
+    int count = atomic_load_explicit(&evlog_rings.ring_count, memory_order_acquire);
+    int drained = 0;
+    bool progress = true;
+
+    while (progress) {
+        progress = false;
+        for (int r = 0; r < count; r++) {
+            LogRing *ring = evlog_rings.rings[r];
+            unsigned int head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+            unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+            while (head != tail &&
+                   ring->records[head & (LOG_RING_RECORDS - 1)].seq == evlog_rings.next_seq) {
+                evlog_write(&ring->records[head & (LOG_RING_RECORDS - 1)]);
+                head++;
+                evlog_rings.next_seq++;
+                drained++;
+                progress = true;
+            }
+            atomic_store_explicit(&ring->head, head, memory_order_release);
+        }
+    }
+    return drained;
+}
+
+// drain 스레드: 링을 비우고, 비어 있으면 잠깐 쉼
+// 종료 요청 후에는 발급된 모든 순번을 출력할 때까지 계속
+void *evlog_drain_main(void *arg) {
+    (void)arg;
+    struct timespec nap = {0, 200000};  // 200 us
+
+    for (;;) {
+        if (evlog_drain() > 0) {
+            continue;
+        }
+        if (atomic_load(&evlog_rings.stop) &&
+            evlog_rings.next_seq == atomic_load(&evlog_rings.seq)) {
+            break;
+        }
+        nanosleep(&nap, NULL);
+    }
+    return NULL;
+}
+
+#endif
+
+// 이벤트 로그 시작
+// path == NULL: drain 스레드가 오늘과 같은 텍스트를 stdout에 출력
+// path != NULL: 바이너리 레코드를 파일에 저장 (--decode로 텍스트 변환)
+bool evlog_start(const char *path) {
+    if (path) {
+        evlog.out = fopen(path, "wb");
+        if (!evlog.out) {
+            perror(path);
+            return false;
+        }
+        fwrite(LOG_FILE_MAGIC, 1, 8, evlog.out);
+        evlog.binary = true;
+        evlog.path = path;
+    }
+#if !defined(_WIN32) && RVC_LOG_LEVEL > RVC_LOG_NONE
+    // 로그 없는 빌드는 기록하는 곳이 없으므로 drain 스레드도 만들지 않음
+    atomic_store(&evlog_rings.stop, false);
+    evlog_rings.running =
+        pthread_create(&evlog_rings.drainer, NULL, evlog_drain_main, NULL) == 0;
+#endif
+    return true;
+}
+
+// 이벤트 기록 (제어 경로에서 호출, printf 대신)
+// 링에 고정 크기 레코드를 복사하고 tail을 게시하는 것이 전부 (잠금/포맷 없음)
+void evlog_emit(int node, int from, int to, int reason, int value, int value2) {
+    LogRecord rec;
+    if (evlog.muted) {
+        return;
+    }
+    rec.tick = evlog_tick;
+    rec.value = value;
+    rec.value2 = value2;
+    rec.node = (unsigned char)node;
+    rec.from = (unsigned char)from;
+    rec.to = (unsigned char)to;
+    rec.reason = (unsigned char)reason;
+
+#ifndef _WIN32
+    if (evlog_rings.running) {
+        LogRing *ring = evlog_ring ? evlog_ring : evlog_attach();
+        if (!ring) {
+            evlog.dropped++;  // 링 할당 실패: 순번을 받기 전에 버림
+            return;
+        }
+        rec.seq = atomic_fetch_add_explicit(&evlog_rings.seq, 1, memory_order_relaxed);
+
+        unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        while (tail - ring->cached_head >= LOG_RING_RECORDS) {
+            // 링이 가득 참: 레코드를 버리면 순번이 끊기므로 drain 스레드를 기다림
+            ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+            if (tail - ring->cached_head >= LOG_RING_RECORDS) {
+                ring->full_waits++;
+                sched_yield();
+            }
+        }
+        ring->records[tail & (LOG_RING_RECORDS - 1)] = rec;
+        atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+        return;
+    }
+#endif
+
+    // drain 스레드 없음 (_WIN32 또는 생성 실패): 바로 출력
+    rec.seq = evlog.seq++;
+    evlog_write(&rec);
+}
+
+// 기록 중지/재개 (--explore는 같은 FSM 함수를 수많은 구성에 실행하므로 전이 메시지를 끔)
+void evlog_mute(bool muted) {
+    evlog.muted = muted;
+}
+
+// 이벤트 로그 종료: 남은 레코드를 모두 출력하고 drain 스레드와 링 정리
+void evlog_stop(void) {
+#ifndef _WIN32
+    if (evlog_rings.running) {
+        atomic_store(&evlog_rings.stop, true);
+        pthread_join(evlog_rings.drainer, NULL);
+        evlog_rings.running = false;
+
+        int count = atomic_load(&evlog_rings.ring_count);
+        for (int r = 0; r < count; r++) {
+            evlog.full_waits += evlog_rings.rings[r]->full_waits;
+            free(evlog_rings.rings[r]);
+        }
+        atomic_store(&evlog_rings.ring_count, 0);
+        evlog_ring = NULL;
+    }
+#endif
+    fflush(stdout);
+    if (evlog.binary) {
+        fclose(evlog.out);
+        evlog.out = NULL;
+        evlog.binary = false;
+        printf("Event log: %llu records -> %s\n", evlog.written, evlog.path);
+    }
+    if (evlog.full_waits > 0) {
+        // drain 스레드가 링 하나 분량 이상 밀림: 그동안 생산자가 기다림 (레코드는 버리지 않음)
+        printf("Event log: ring full %llu times (producer waited for the drain thread)\n",
+               evlog.full_waits);
+    }
+    if (evlog.dropped > 0) {
+        fprintf(stderr, "Event log: %llu records dropped\n", evlog.dropped);
+    }
+}
+
+int evlog_compare_seq(const void *a, const void *b) {
+    unsigned long long x = ((const LogRecord *)a)->seq;
+    unsigned long long y = ((const LogRecord *)b)->seq;
+    return (x > y) - (x < y);
+}
+
+// 오프라인 디코더: 바이너리 로그를 순번 순서로 정렬하여 텍스트로 출력
+int evlog_decode(const char *path) {
+    char magic[8];
+    FILE *in = fopen(path, "rb");
+    if (!in) {
+        perror(path);
+        return 1;
+    }
+    if (fread(magic, 1, 8, in) != 8 || memcmp(magic, LOG_FILE_MAGIC, 8) != 0) {
+        fprintf(stderr, "%s: not a " LOG_FILE_MAGIC " event log\n", path);
+        fclose(in);
+        return 1;
+    }
+
+    size_t capacity = 4096, count = 0;
+    LogRecord *records = malloc(capacity * sizeof(LogRecord));
+    while (records && fread(&records[count], sizeof(LogRecord), 1, in) == 1) {
+        if (++count == capacity) {
+            LogRecord *grown = realloc(records, capacity * 2 * sizeof(LogRecord));
+            if (!grown) {
+                free(records);
+                records = NULL;
+                break;
+            }
+            records = grown;
+            capacity *= 2;
+        }
+    }
+    fclose(in);
+    if (!records) {
+        fprintf(stderr, "%s: out of memory\n", path);
+        return 1;
+    }
+
+    qsort(records, count, sizeof(LogRecord), evlog_compare_seq);
+    for (size_t i = 0; i < count; i++) {
+        evlog_render(&records[i], stdout);
+    }
+    free(records);
+    return 0;
+}
+
+/* ========== 메인 제어 루프 ========== */
+
+
+
+
+
+
+// 전역 변수 정의
+RVCContext rvc;
+
+// 시스템 초기화 (SA PDF p.20-21 Process Spec 2.0 "INITIALIZE CN1_State")
+void initialize_system(unsigned long long seed) {
+    rng_seed(&rvc.rng, seed, 0);
+    rvc.state = STATE_MOVING;
+    rvc.tick_count = 0;  // SRS PDF p.2 "Tick: 제어 주기"
+    rvc.tick_time_us = 0;
+    rvc.state_duration = 0;
+    rvc.dust_clean_timer = 0;
+    rvc.backward_timer = 0;
+    rvc.motor_cmd = MOTOR_FORWARD;
+    rvc.cleaner_cmd = CLEANER_ON;
+    printf("=== RVC Control System V1 (Single FSM) Started ===\n");
+    printf("Seed: %llu\n\n", seed);  // --seed로 같은 실행 재현
+}
+
+// 상태 표시: tick별 상태를 이벤트 로그 레코드 1개로 기록
+void print_status(RVCContext *ctx) {
+#if RVC_LOG_LEVEL >= RVC_LOG_STATUS
+    evlog_emit(LOG_NODE_STATUS, ctx->state, 0, ctx->sensors, ctx->state_duration, 0);
+#else
+    (void)ctx;
+#endif
+}
+
+// 상태 표시 레코드의 텍스트 변환 (eventlog.c의 drain 스레드/디코더가 호출)
+// tickless 구간 요약(LOG_NODE_SKIP, --tickless-summary)은 구간의 첫/마지막 tick과 유지된 상태만 출력
+void render_status(const LogRecord *rec, FILE *out) {
+    const char *state_names[] = {
+        "MOVING", "TURNING", "BACKWARDING", "DUST_CLEANING", "PAUSE"
+    };
+    
+    if (rec->node == LOG_NODE_SKIP) {
+        if (rec->value == 1) {
+            fprintf(out, "\n--- Tick %d: no events, skipped ---\n", rec->tick);
+        } else {
+            fprintf(out, "\n--- Ticks %d-%d: no events, skipped ---\n",
+                    rec->tick, rec->tick + rec->value - 1);
+        }
+        fprintf(out, "State: %s\n", state_names[rec->from]);
+        return;
+    }
+    fprintf(out, "\n--- Tick %d ---\n", rec->tick);
+    fprintf(out, "State: %s (duration: %d)\n", 
+            state_names[rec->from], rec->value);
+    fprintf(out, "Sensors: F=%d L=%d R=%d D=%d\n",
+            (rec->reason & SENSOR_FRONT) != 0, (rec->reason & SENSOR_LEFT) != 0,
+            (rec->reason & SENSOR_RIGHT) != 0, (rec->reason & SENSOR_DUST) != 0);
+}
+
+// 명령행 옵션 해석
+//   --fast      가상 시간 모드: 대기 없이 최대 속도로 실행
+//   --ticks N   시뮬레이션 tick 수 (기본 50)
+//   --period-ms N  제어 주기 (기본 100 ms, SRS PDF p.3-4 "P-1 제어주기: 50–100 ms")
+//   --robots N  N대 로봇을 SoA 배치로 일괄 실행 (fleet 모드, tick별 출력 없음)
+//   --threads N fleet 모드 워커 스레드 수 (기본 1, 0: 모든 코어)
+//   --seed N    센서 난수 시드 (기본: 현재 시각). 같은 시드면 같은 실행 결과
+//   --log FILE  tick별 출력을 텍스트 대신 바이너리 이벤트 로그로 저장
+//   --decode FILE  저장된 이벤트 로그를 텍스트로 출력하고 종료
+//   --sched-trace  실시간 모드: tick별 [SCHED] jitter / 처리 시간을 상태 표시 뒤에 출력
+//   --explore   도달 가능한 모든 구성을 병렬 BFS로 탐색하여 deadlock/livelock 검사 후 종료
+//               (--threads로 스레드 수 지정)
+//   --tickless  (--fast 전용) 상태가 바뀔 수 없는 tick을 건너뛰고 다음 이벤트로 바로 진행
+//   --tickless-summary  --tickless와 같되 건너뛴 구간의 tick별 상태 표시를 요약 1줄로 줄임
+//   --io NAME   센서/액추에이터 I/O 백엔드 (기본 local: 프로세스 안의 센서 모델,
+//               shm: 공유 메모리 링으로 하드웨어 시뮬레이터 프로세스와 연결,
+//               grid: 격자 지도에서 장애물 센서를 유도하고 모터 명령으로 로봇 이동,
+//               --robots와 함께 쓰면 N대가 한 지도를 공유하며 서로를 장애물로 감지)
+//   --map FILE  grid: 지도 파일을 mmap으로 열어 사용 (로봇이 닿는 타일만 메모리에 올라옴)
+//   --save-map FILE  grid: 시드로 생성한 방을 지도 파일로 저장
+//   --room-m N  grid: 생성할 방 한 변 (기본 10 m, 창고 규모 지도 파일을 만들 때 사용)
+void parse_args(int argc, char *argv[], RunConfig *cfg) {
+    cfg->clock_mode = CLOCK_MODE_REALTIME;
+    cfg->ticks = 50;
+    cfg->robots = 0;
+    cfg->threads = 1;
+    cfg->seed = (unsigned long long)time(NULL);
+    cfg->period_us = 100000;  // 100ms - SRS PDF p.3-4 "P-1 제어주기: 50–100 ms"
+    cfg->log_path = NULL;
+    cfg->decode_path = NULL;
+    cfg->io = "local";
+    cfg->map_path = NULL;
+    cfg->map_save_path = NULL;
+    cfg->room_m = 10;
+    cfg->tickless = false;
+    cfg->tickless_summary = false;
+    cfg->explore = false;
+    cfg->sched_trace = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--fast") == 0) {
+            cfg->clock_mode = CLOCK_MODE_FAST;
+        } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            cfg->ticks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--period-ms") == 0 && i + 1 < argc) {
+            cfg->period_us = atoll(argv[++i]) * 1000;
+        } else if (strcmp(argv[i], "--robots") == 0 && i + 1 < argc) {
+            cfg->robots = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            cfg->threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            cfg->seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--log") == 0 && i + 1 < argc) {
+            cfg->log_path = argv[++i];
+        } else if (strcmp(argv[i], "--decode") == 0 && i + 1 < argc) {
+            cfg->decode_path = argv[++i];
+        } else if (strcmp(argv[i], "--io") == 0 && i + 1 < argc) {
+            cfg->io = argv[++i];
+        } else if (strcmp(argv[i], "--map") == 0 && i + 1 < argc) {
+            cfg->map_path = argv[++i];
+        } else if (strcmp(argv[i], "--save-map") == 0 && i + 1 < argc) {
+            cfg->map_save_path = argv[++i];
+        } else if (strcmp(argv[i], "--room-m") == 0 && i + 1 < argc) {
+            cfg->room_m = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--tickless") == 0) {
+            cfg->tickless = true;
+        } else if (strcmp(argv[i], "--tickless-summary") == 0) {
+            cfg->tickless = true;
+            cfg->tickless_summary = true;
+        } else if (strcmp(argv[i], "--explore") == 0) {
+            cfg->explore = true;
+        } else if (strcmp(argv[i], "--sched-trace") == 0) {
+            cfg->sched_trace = true;
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        }
+    }
+    if (cfg->tickless && cfg->clock_mode != CLOCK_MODE_FAST) {
+        // 실시간 모드는 어차피 tick마다 주기를 기다리므로 건너뛸 수 없음
+        fprintf(stderr, "--tickless requires --fast; running tick by tick\n");
+        cfg->tickless = false;
+    }
+    if (cfg->tickless && strcmp(cfg->io, "local") != 0) {
+        // 건너뛴 tick의 센서 난수를 제어기가 직접 넘기므로 외부 센서 프레임과 어긋남
+        fprintf(stderr, "--tickless requires --io local; running tick by tick\n");
+        cfg->tickless = false;
+    }
+}
+
+// Fleet 모드: N대 로봇을 SoA 배치로 일괄 실행
+// 센서 → FSM 전이 규칙은 단일 로봇 모드와 같고, tick별 출력 대신 통계만 보고
+// 로봇을 chunk로 나눠 work-stealing 스레드 풀이 처리하며 tick 사이는 barrier로 구분
+int run_fleet(RunConfig *cfg) {
+    RVCFleet fleet;
+    VirtualClock clk;
+    int threads = cfg->threads;
+    int stolen = 0;
+    long long step_us;
+
+    if (!fleet_init(&fleet, cfg->robots, cfg->seed)) {
+        fprintf(stderr, "Fleet allocation failed (%d robots)\n", cfg->robots);
+        fleet_free(&fleet);
+        return 1;
+    }
+    // --io grid: 로봇 전체가 한 격자 지도를 공유 (공간 해시로 이웃 로봇 감지)
+    if (io_backend == &io_grid && !swarm_init(&swarm_world, &fleet, cfg->seed)) {
+        fleet_free(&fleet);
+        return 1;
+    }
+    clock_init(&clk, cfg->clock_mode, cfg->period_us);
+
+    step_us = pool_run_fleet(&fleet, &clk, cfg->ticks, &threads, &stolen);
+    evlog_stop();
+
+    printf("\n=== Fleet Simulation Complete ===\n");
+    fleet_report(&fleet);
+    if (swarm_world.enabled) {
+        swarm_report(&fleet, cfg->ticks);
+        swarm_free(&swarm_world);
+    }
+    clock_report(&clk);
+
+    printf("Threads: %d, chunks stolen: %d\n", threads, stolen);
+
+    double robot_ticks = (double)fleet.count * cfg->ticks;
+    if (step_us > 0) {
+        printf("Sense + FSM step: %.2f ns/robot-tick (%.1f M robot-ticks/s)\n",
+               step_us * 1000.0 / robot_ticks, robot_ticks / step_us);
+    }
+    fleet_free(&fleet);
+    return 0;
+}
+
+// 메인 함수 (SA PDF p.6 "RVC Control (0)" 전체 시스템)
+// SRS PDF p.3-4 "P-1 제어주기: 50–100 ms"
+int main(int argc, char *argv[]) {
+    RunConfig cfg;
+    VirtualClock clk;
+    LatencyStats lat;
+    TicklessEngine eng;
+    bool io_lost = false;   // 하드웨어(I/O 백엔드) 연결이 끊겨 루프를 일찍 끝냄
+
+    parse_args(argc, argv, &cfg);
+    if (cfg.decode_path) {
+        return evlog_decode(cfg.decode_path);
+    }
+    if (cfg.explore) {
+        return explore_run(cfg.threads);
+    }
+    if (!io_select(cfg.io)) {
+        return 1;
+    }
+    env_options.map_path = cfg.map_path;
+    env_options.save_path = cfg.map_save_path;
+    env_options.room_mm = cfg.room_m * 1000;
+    initialize_system(cfg.seed);
+    // 시뮬레이터 프로세스는 스레드(이벤트 로그 drain 등)를 만들기 전에 fork
+    if (cfg.robots == 0 && !io_backend->open(cfg.seed)) {
+        return 1;
+    }
+    if (!evlog_start(cfg.log_path)) {
+        io_backend->close();
+        return 1;
+    }
+    if (cfg.robots > 0) {
+        return run_fleet(&cfg);
+    }
+    clock_init(&clk, cfg.clock_mode, cfg.period_us);
+    latency_init(&lat);
+    latency_install_signal();
+    tickless_init(&eng, cfg.tickless_summary);
+    
+    // 시뮬레이션 루프: 기본 50 ticks
+    for (int i = 0; i < cfg.ticks; i++) {
+        if (cfg.tickless) {
+            // 다음 이벤트 직전까지 건너뜀 (건너뛴 구간은 엔진이 한 번에 진행하고 요약 레코드 1개)
+            i += tickless_skip(&eng, &rvc, &clk, i, cfg.ticks);
+            if (i >= cfg.ticks) {
+                break;
+            }
+        }
+        rvc.tick_count = i;
+        evlog_set_tick(i);
+        rvc.tick_time_us = clock_advance(&clk, i);
+        // 반응 지연은 tick 시작 시 상태로 분류, 단계 경계마다 단조 시계 기록
+        int state = rvc.state;
+        long long t0 = monotonic_ns();
+        
+        // 1. 센서 인터페이스 (SA PDF p.18-19 Process 1.0)
+        if (!io_backend->read_sensors(&rvc.sensors, &rvc.rng)) {
+            io_lost = true;
+            break;
+        }
+        long long t1 = monotonic_ns();
+        
+        // 2. 제어 로직 (FSM) (SA PDF p.20-21 Process 2.0)
+        fsm_executor(&rvc);
+        long long t2 = monotonic_ns();
+        
+        // 3. 액추에이터 인터페이스 (SA PDF p.22-23 Process 3.0)
+        actuator_interface(&rvc);
+        long long t3 = monotonic_ns();
+        clock_tick_done(&clk);
+        latency_record(&lat, state, t0, t1, t2, t3);
+        latency_jitter(&lat, &clk);
+        
+        // 4. 상태 표시
+        print_status(&rvc);
+        if (cfg.sched_trace) {
+            clock_trace(&clk);  // tick별 jitter / 처리 시간 (상태 표시 뒤)
+        }
+        latency_poll(&lat);  // SIGUSR1: 실행 중 분포 출력
+    }
+    
+    evlog_stop();
+    printf("\n=== Simulation Complete ===\n");
+    clock_report(&clk);
+    actuator_report(&rvc.output);
+    io_backend->close();
+    latency_report(&lat, stdout);
+    if (cfg.tickless) {
+        tickless_report(&eng);
+    }
+    return io_lost ? 1 : 0;
+}
 
@@ -0,0 +1,32 @@
+# 벤치마크 실행 스크립트
+# 분할 빌드(src/, src2/)와 병합 빌드(1.c, 2.c)를 같은 조건으로 측정하여
+# 표로 출력하고 CSV에 행을 추가 (실행 간 비교용)
+#
+# 사용법: .\bench\bench.ps1 [-Ticks 1000000] [-Seed 1] [-Csv bench\results.csv]
+
+param(
+    [int]$Ticks = 1000000,
+    [int]$Seed = 1,
+    [string]$Csv = "bench\results.csv"
+)
+
+# 병합 빌드가 src/, src2/의 현재 코드와 같도록 다시 생성
+.\merge.ps1
+.\merge2.ps1
+
+# 로그 없는 빌드 + 프로그램 main 이름 변경 (벤치마크 main과 함께 링크)
+$flags = @("-O2", "-DRVC_LOG_LEVEL=0", "-Dmain=rvc_main")
+
+gcc @flags -Isrc bench\bench1.c (Get-ChildItem src\*.c).FullName -o bench1_split.exe
+gcc @flags -Isrc bench\bench1.c 1.c -o bench1_amalgamated.exe
+gcc @flags -Isrc2 bench\bench2.c (Get-ChildItem src2\*.c).FullName -o bench2_split.exe
+gcc @flags -Isrc2 bench\bench2.c 2.c -o bench2_amalgamated.exe
+# 격자 저장 순서 비교: 두 방식의 칸 조회가 똑같이 인라인되도록 LTO로 링크
+gcc @flags -flto -Isrc2 bench\bench_grid.c 2.c -o bench_grid.exe
+
+foreach ($build in @("split", "amalgamated")) {
+    & ".\bench1_$build.exe" --build $build --ticks $Ticks --seed $Seed --csv $Csv
+    & ".\bench2_$build.exe" --build $build --ticks $Ticks --seed $Seed --csv $Csv
+}
+
+.\bench_grid.exe --seed $Seed --csv $Csv
@@ -0,0 +1,238 @@
+/* ========== 벤치마크: Version 1 제어 경로 ========== */
+/*
+ * 고정 시드 센서 스트림으로 제어 경로 함수를 하나씩 반복 실행하여
+ * ns/tick, ticks/s, tick당 / 전이당 사이클을 측정합니다.
+ *
+ * 프로그램의 main은 -Dmain=rvc_main으로 이름을 바꿔 함께 링크하고,
+ * 로그 출력이 측정에 섞이지 않도록 RVC_LOG_LEVEL=0으로 빌드합니다.
+ * 분할 빌드(src/)와 병합 빌드(1.c)를 모두 만드는 명령은 bench/bench.ps1 참고.
+ *
+ * 실행: bench1_split.exe --build split --ticks 1000000 --seed 1 --csv bench\results.csv
+ */
+
+#undef main     // 이 파일의 main만 실제 진입점
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "types.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if RVC_LOG_LEVEL != RVC_LOG_NONE
+#error "벤치마크는 -DRVC_LOG_LEVEL=0으로 빌드하세요 (trace 출력이 측정에 섞임)"
+#endif
+
+#define BENCH_STREAM 65536      // 센서 워드 스트림 길이 (2의 거듭제곱)
+#define BENCH_RUNS 5            // 반복 측정 후 가장 빠른 값 사용
+
+// 함수 선언
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+void sensor_interface(SensorData *sensors, RngState *rng);
+void fsm_executor(RVCContext *ctx);
+void actuator_interface(RVCContext *ctx);
+long long monotonic_ns(void);
+
+// 측정 설정 (명령행 옵션)
+typedef struct {
+    const char *build;          // 결과 표시용 빌드 이름 (split / amalgamated)
+    int ticks;
+    unsigned long long seed;
+    const char *csv_path;       // NULL: 표만 출력
+} BenchConfig;
+
+// 측정 대상: ticks번 실행하고 상태 전이 횟수를 반환
+typedef long long (*BenchCase)(RVCContext *ctx, int ticks);
+
+typedef struct {
+    const char *name;
+    BenchCase run;
+} BenchEntry;
+
+// 미리 만든 센서 워드 스트림 (sensor_interface와 같은 확률 모델, 측정 중 난수 생성 제외)
+SensorData bench_stream[BENCH_STREAM];
+
+// 사이클 카운터 (x86: TSC, 그 외: 0 → 사이클 열은 -1로 표시)
+unsigned long long bench_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// initialize_system과 같은 초기 상태 (시작 메시지 출력 없음)
+void bench_reset(RVCContext *ctx, unsigned long long seed) {
+    memset(ctx, 0, sizeof(*ctx));
+    rng_seed(&ctx->rng, seed, 0);
+    ctx->state = STATE_MOVING;
+    ctx->motor_cmd = MOTOR_FORWARD;
+    ctx->cleaner_cmd = CLEANER_ON;
+}
+
+// 1.0 센서 인터페이스
+long long bench_sense(RVCContext *ctx, int ticks) {
+    for (int i = 0; i < ticks; i++) {
+        sensor_interface(&ctx->sensors, &ctx->rng);
+    }
+    return 0;
+}
+
+// 2.0 FSM 실행기 (고정 센서 스트림)
+long long bench_fsm(RVCContext *ctx, int ticks) {
+    long long transitions = 0;
+    for (int i = 0; i < ticks; i++) {
+        SystemState before = ctx->state;
+        ctx->sensors = bench_stream[i & (BENCH_STREAM - 1)];
+        fsm_executor(ctx);
+        transitions += ctx->state != before;
+    }
+    return transitions;
+}
+
+// 회전 결정 (FR-3.2 좌회전 우선, FR-3.3 전방향 막힘)
+// decide_turn_priority는 전이 테이블의 Turning 행으로 합쳐졌으므로 매 tick Turning에서 시작
+long long bench_turn(RVCContext *ctx, int ticks) {
+    long long transitions = 0;
+    for (int i = 0; i < ticks; i++) {
+        ctx->state = STATE_TURNING;
+        ctx->state_duration = 1;    // 이번 tick에 회전 완료 가능
+        ctx->sensors = bench_stream[i & (BENCH_STREAM - 1)];
+        fsm_executor(ctx);
+        transitions += ctx->state != STATE_TURNING;
+    }
+    return transitions;
+}
+
+// 3.0 액추에이터 인터페이스
+long long bench_actuate(RVCContext *ctx, int ticks) {
+    for (int i = 0; i < ticks; i++) {
+        ctx->motor_cmd = (MotorCommand)(bench_stream[i & (BENCH_STREAM - 1)] % 5);
+        actuator_interface(ctx);
+    }
+    return 0;
+}
+
+// 센서 → FSM → 액추에이터 전체 tick (main 루프와 같은 순서)
+long long bench_tick(RVCContext *ctx, int ticks) {
+    long long transitions = 0;
+    for (int i = 0; i < ticks; i++) {
+        SystemState before = ctx->state;
+        ctx->tick_count = i;
+        sensor_interface(&ctx->sensors, &ctx->rng);
+        fsm_executor(ctx);
+        actuator_interface(ctx);
+        transitions += ctx->state != before;
+    }
+    return transitions;
+}
+
+//   --build NAME  결과에 붙일 빌드 이름 (기본 split)
+//   --ticks N     측정 1회당 tick 수 (기본 1000000)
+//   --seed N      센서 스트림 시드 (기본 1)
+//   --csv FILE    결과를 CSV 행으로 추가 (실행 간 비교용)
+void bench_parse_args(int argc, char *argv[], BenchConfig *cfg) {
+    cfg->build = "split";
+    cfg->ticks = 1000000;
+    cfg->seed = 1;
+    cfg->csv_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--build") == 0 && i + 1 < argc) {
+            cfg->build = argv[++i];
+        } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            cfg->ticks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            cfg->seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            cfg->csv_path = argv[++i];
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    BenchConfig cfg;
+    RVCContext ctx;
+    RngState rng;
+    const BenchEntry cases[] = {
+        {"sensor_interface", bench_sense},
+        {"fsm_executor", bench_fsm},
+        {"turn_decision", bench_turn},
+        {"actuator_interface", bench_actuate},
+        {"tick", bench_tick},
+    };
+
+    bench_parse_args(argc, argv, &cfg);
+    if (cfg.ticks <= 0) {
+        fprintf(stderr, "--ticks must be positive\n");
+        return 1;
+    }
+
+    rng_seed(&rng, cfg.seed, 1);    // 스트림 1: 로봇 0의 센서 열과 겹치지 않게
+    for (int i = 0; i < BENCH_STREAM; i++) {
+        sensor_interface(&bench_stream[i], &rng);
+    }
+
+    FILE *csv = NULL;
+    if (cfg.csv_path) {
+        csv = fopen(cfg.csv_path, "a");
+        if (!csv) {
+            perror(cfg.csv_path);
+            return 1;
+        }
+        fseek(csv, 0, SEEK_END);
+        if (ftell(csv) == 0) {
+            fprintf(csv, "version,build,case,ticks,seed,ns_per_tick,ticks_per_s,"
+                         "cycles_per_tick,transitions,cycles_per_transition\n");
+        }
+    }
+
+    printf("=== RVC V1 benchmark (%s, %d ticks x %d runs, seed %llu) ===\n",
+           cfg.build, cfg.ticks, BENCH_RUNS, cfg.seed);
+    printf("%-20s %10s %14s %12s %12s %14s\n",
+           "case", "ns/tick", "ticks/s", "cycles/tick", "transitions", "cycles/trans");
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        long long best_ns = -1;
+        unsigned long long best_cycles = 0;
+        long long transitions = 0;
+
+        for (int run = 0; run < BENCH_RUNS; run++) {
+            bench_reset(&ctx, cfg.seed);
+            long long t0 = monotonic_ns();
+            unsigned long long c0 = bench_cycles();
+            transitions = cases[c].run(&ctx, cfg.ticks);
+            unsigned long long c1 = bench_cycles();
+            long long t1 = monotonic_ns();
+            if (best_ns < 0 || t1 - t0 < best_ns) {
+                best_ns = t1 - t0;
+                best_cycles = c1 - c0;
+            }
+        }
+
+        double ns_per_tick = (double)best_ns / cfg.ticks;
+        double ticks_per_s = best_ns > 0 ? cfg.ticks * 1e9 / best_ns : 0;
+        double cycles_per_tick = best_cycles ? (double)best_cycles / cfg.ticks : -1;
+        double cycles_per_transition = best_cycles && transitions
+                                       ? (double)best_cycles / transitions : -1;
+
+        printf("%-20s %10.2f %14.0f %12.1f %12lld %14.1f\n",
+               cases[c].name, ns_per_tick, ticks_per_s, cycles_per_tick,
+               transitions, cycles_per_transition);
+        if (csv) {
+            fprintf(csv, "v1,%s,%s,%d,%llu,%.3f,%.0f,%.2f,%lld,%.2f\n",
+                    cfg.build, cases[c].name, cfg.ticks, cfg.seed, ns_per_tick,
+                    ticks_per_s, cycles_per_tick, transitions, cycles_per_transition);
+        }
+    }
+
+    if (csv) {
+        fclose(csv);
+    }
+    return 0;
+}
@@ -0,0 +1,280 @@
+/* ========== 벤치마크: Version 2 제어 경로 (CN1 + CN2) ========== */
+/*
+ * 고정 시드 센서 스트림으로 제어 경로 함수를 하나씩 반복 실행하여
+ * ns/tick, ticks/s, tick당 / 전이당 사이클을 측정합니다.
+ *
+ * 프로그램의 main은 -Dmain=rvc_main으로 이름을 바꿔 함께 링크하고,
+ * 로그 출력이 측정에 섞이지 않도록 RVC_LOG_LEVEL=0으로 빌드합니다.
+ * 분할 빌드(src2/)와 병합 빌드(2.c)를 모두 만드는 명령은 bench/bench.ps1 참고.
+ *
+ * 실행: bench2_split.exe --build split --ticks 1000000 --seed 1 --csv bench\results.csv
+ */
+
+#undef main     // 이 파일의 main만 실제 진입점
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "types.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if RVC_LOG_LEVEL != RVC_LOG_NONE
+#error "벤치마크는 -DRVC_LOG_LEVEL=0으로 빌드하세요 (trace 출력이 측정에 섞임)"
+#endif
+
+#define BENCH_STREAM 65536      // 센서 워드 스트림 길이 (2의 거듭제곱)
+#define BENCH_RUNS 5            // 반복 측정 후 가장 빠른 값 사용
+
+// 함수 선언
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+unsigned long long rng_next(RngState *rng);
+void sensor_interface(SensorData *sensors, RngState *rng);
+void cn1_motor_fsm(CN1_Context *cn1, SensorData *sensors, bool cleaner_trigger);
+void cn2_cleaner_fsm(CN2_Context *cn2, bool dust_detected, bool motor_moving);
+void control_logic(RVCSystem *sys);
+bool control_init(void);
+void actuator_interface(RVCSystem *sys);
+long long monotonic_ns(void);
+
+// 측정 설정 (명령행 옵션)
+typedef struct {
+    const char *build;          // 결과 표시용 빌드 이름 (split / amalgamated)
+    int ticks;
+    unsigned long long seed;
+    const char *csv_path;       // NULL: 표만 출력
+} BenchConfig;
+
+// 측정 대상: ticks번 실행하고 상태 전이 횟수를 반환
+typedef long long (*BenchCase)(RVCSystem *sys, int ticks);
+
+typedef struct {
+    const char *name;
+    BenchCase run;
+} BenchEntry;
+
+// 미리 만든 센서 워드 스트림 (sensor_interface와 같은 확률 모델, 측정 중 난수 생성 제외)
+SensorData bench_stream[BENCH_STREAM];
+// CN 단독 측정용 상호 신호 스트림 (비트 0: Cleaner_Trigger, 비트 1: Motor_Status)
+unsigned char bench_signals[BENCH_STREAM];
+
+// 사이클 카운터 (x86: TSC, 그 외: 0 → 사이클 열은 -1로 표시)
+unsigned long long bench_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// initialize_system과 같은 초기 상태 (시작 메시지 출력 없음)
+void bench_reset(RVCSystem *sys, unsigned long long seed) {
+    memset(sys, 0, sizeof(*sys));
+    rng_seed(&sys->rng, seed, 0);
+    sys->cn1.state = MOTOR_IDLE;
+    sys->cn1.command = CMD_STOP;
+    sys->cn2.state = CLEANER_OFF;
+    sys->cn2.command = CMD_OFF;
+}
+
+// 1.0 센서 인터페이스
+long long bench_sense(RVCSystem *sys, int ticks) {
+    for (int i = 0; i < ticks; i++) {
+        sensor_interface(&sys->sensors, &sys->rng);
+    }
+    return 0;
+}
+
+// 2.1 CN1 모터 FSM 단독 (고정 센서 + Cleaner_Trigger 스트림)
+long long bench_cn1(RVCSystem *sys, int ticks) {
+    long long transitions = 0;
+    for (int i = 0; i < ticks; i++) {
+        MotorState before = sys->cn1.state;
+        sys->sensors = bench_stream[i & (BENCH_STREAM - 1)];
+        cn1_motor_fsm(&sys->cn1, &sys->sensors, bench_signals[i & (BENCH_STREAM - 1)] & 1);
+        transitions += sys->cn1.state != before;
+    }
+    return transitions;
+}
+
+// 2.2 CN2 청소기 FSM 단독 (고정 먼지 + Motor_Status 스트림)
+long long bench_cn2(RVCSystem *sys, int ticks) {
+    long long transitions = 0;
+    for (int i = 0; i < ticks; i++) {
+        CleanerState before = sys->cn2.state;
+        int k = i & (BENCH_STREAM - 1);
+        cn2_cleaner_fsm(&sys->cn2, (bench_stream[k] & SENSOR_DUST) != 0,
+                        (bench_signals[k] >> 1) & 1);
+        transitions += sys->cn2.state != before;
+    }
+    return transitions;
+}
+
+// 2.0 제어 로직 (CN1 + CN2와 상호 신호, 고정 센서 스트림)
+long long bench_control(RVCSystem *sys, int ticks) {
+    long long transitions = 0;
+    for (int i = 0; i < ticks; i++) {
+        MotorState cn1_before = sys->cn1.state;
+        CleanerState cn2_before = sys->cn2.state;
+        sys->sensors = bench_stream[i & (BENCH_STREAM - 1)];
+        control_logic(sys);
+        transitions += (sys->cn1.state != cn1_before) + (sys->cn2.state != cn2_before);
+    }
+    return transitions;
+}
+
+// 회전 결정 (FR-3.2 좌회전 우선, FR-3.3 전방향 막힘)
+// decide_turn_priority는 CN1 전이 테이블의 Turning 행으로 합쳐졌으므로 매 tick Turning에서 시작
+long long bench_turn(RVCSystem *sys, int ticks) {
+    long long transitions = 0;
+    for (int i = 0; i < ticks; i++) {
+        sys->cn1.state = MOTOR_TURNING;
+        sys->cn1.state_duration = 1;    // 이번 tick에 회전 완료 가능
+        sys->sensors = bench_stream[i & (BENCH_STREAM - 1)];
+        cn1_motor_fsm(&sys->cn1, &sys->sensors, false);
+        transitions += sys->cn1.state != MOTOR_TURNING;
+    }
+    return transitions;
+}
+
+// 3.0 액추에이터 인터페이스
+long long bench_actuate(RVCSystem *sys, int ticks) {
+    for (int i = 0; i < ticks; i++) {
+        sys->cn1.command = (MotorCommand)(bench_stream[i & (BENCH_STREAM - 1)] % 5);
+        actuator_interface(sys);
+    }
+    return 0;
+}
+
+// 센서 → 제어 로직 → 액추에이터 전체 tick (main 루프와 같은 순서)
+long long bench_tick(RVCSystem *sys, int ticks) {
+    long long transitions = 0;
+    for (int i = 0; i < ticks; i++) {
+        MotorState cn1_before = sys->cn1.state;
+        CleanerState cn2_before = sys->cn2.state;
+        sys->tick_count = i;
+        sensor_interface(&sys->sensors, &sys->rng);
+        control_logic(sys);
+        actuator_interface(sys);
+        transitions += (sys->cn1.state != cn1_before) + (sys->cn2.state != cn2_before);
+    }
+    return transitions;
+}
+
+//   --build NAME  결과에 붙일 빌드 이름 (기본 split)
+//   --ticks N     측정 1회당 tick 수 (기본 1000000)
+//   --seed N      센서 스트림 시드 (기본 1)
+//   --csv FILE    결과를 CSV 행으로 추가 (실행 간 비교용)
+void bench_parse_args(int argc, char *argv[], BenchConfig *cfg) {
+    cfg->build = "split";
+    cfg->ticks = 1000000;
+    cfg->seed = 1;
+    cfg->csv_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--build") == 0 && i + 1 < argc) {
+            cfg->build = argv[++i];
+        } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            cfg->ticks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            cfg->seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            cfg->csv_path = argv[++i];
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    BenchConfig cfg;
+    RVCSystem sys;
+    RngState rng;
+    const BenchEntry cases[] = {
+        {"sensor_interface", bench_sense},
+        {"cn1_motor_fsm", bench_cn1},
+        {"cn2_cleaner_fsm", bench_cn2},
+        {"control_logic", bench_control},
+        {"turn_decision", bench_turn},
+        {"actuator_interface", bench_actuate},
+        {"tick", bench_tick},
+    };
+
+    bench_parse_args(argc, argv, &cfg);
+    if (cfg.ticks <= 0) {
+        fprintf(stderr, "--ticks must be positive\n");
+        return 1;
+    }
+    if (!control_init()) {
+        return 1;
+    }
+
+    rng_seed(&rng, cfg.seed, 1);    // 스트림 1: 로봇 0의 센서 열과 겹치지 않게
+    for (int i = 0; i < BENCH_STREAM; i++) {
+        sensor_interface(&bench_stream[i], &rng);
+        unsigned long long frame = rng_next(&rng);
+        bench_signals[i] = ((frame & 7) == 0)           // Cleaner_Trigger 12.5%
+                         | (((frame >> 8) & 1) << 1);   // Motor_Status 50%
+    }
+
+    FILE *csv = NULL;
+    if (cfg.csv_path) {
+        csv = fopen(cfg.csv_path, "a");
+        if (!csv) {
+            perror(cfg.csv_path);
+            return 1;
+        }
+        fseek(csv, 0, SEEK_END);
+        if (ftell(csv) == 0) {
+            fprintf(csv, "version,build,case,ticks,seed,ns_per_tick,ticks_per_s,"
+                         "cycles_per_tick,transitions,cycles_per_transition\n");
+        }
+    }
+
+    printf("=== RVC V2 benchmark (%s, %d ticks x %d runs, seed %llu) ===\n",
+           cfg.build, cfg.ticks, BENCH_RUNS, cfg.seed);
+    printf("%-20s %10s %14s %12s %12s %14s\n",
+           "case", "ns/tick", "ticks/s", "cycles/tick", "transitions", "cycles/trans");
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        long long best_ns = -1;
+        unsigned long long best_cycles = 0;
+        long long transitions = 0;
+
+        for (int run = 0; run < BENCH_RUNS; run++) {
+            bench_reset(&sys, cfg.seed);
+            long long t0 = monotonic_ns();
+            unsigned long long c0 = bench_cycles();
+            transitions = cases[c].run(&sys, cfg.ticks);
+            unsigned long long c1 = bench_cycles();
+            long long t1 = monotonic_ns();
+            if (best_ns < 0 || t1 - t0 < best_ns) {
+                best_ns = t1 - t0;
+                best_cycles = c1 - c0;
+            }
+        }
+
+        double ns_per_tick = (double)best_ns / cfg.ticks;
+        double ticks_per_s = best_ns > 0 ? cfg.ticks * 1e9 / best_ns : 0;
+        double cycles_per_tick = best_cycles ? (double)best_cycles / cfg.ticks : -1;
+        double cycles_per_transition = best_cycles && transitions
+                                       ? (double)best_cycles / transitions : -1;
+
+        printf("%-20s %10.2f %14.0f %12.1f %12lld %14.1f\n",
+               cases[c].name, ns_per_tick, ticks_per_s, cycles_per_tick,
+               transitions, cycles_per_transition);
+        if (csv) {
+            fprintf(csv, "v2,%s,%s,%d,%llu,%.3f,%.0f,%.2f,%lld,%.2f\n",
+                    cfg.build, cases[c].name, cfg.ticks, cfg.seed, ns_per_tick,
+                    ticks_per_s, cycles_per_tick, transitions, cycles_per_transition);
+        }
+    }
+
+    if (csv) {
+        fclose(csv);
+    }
+    return 0;
+}
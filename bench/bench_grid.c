@@ -0,0 +1,417 @@
+/* ========== 벤치마크: 격자 지도 저장 순서 (Morton 타일 vs 행 우선) ========== */
+/*
+ * env.c의 Morton 타일 지도와, 같은 내용을 행마다 64칸씩 묶은 행 우선 비트보드(이전 저장 방식,
+ * 이 파일 안의 참조 구현)에 같은 작업을 돌려 로봇-tick당 ns를 비교합니다.
+ *
+ * 작업: 지도 전체에 흩어 놓은 로봇 N대가 매 tick 앞/왼쪽/오른쪽 탐지 지점을 읽고
+ *       앞이 막히면 45° 회전, 아니면 30 mm 전진 (walk),
+ *       여기에 청소 범위 비트맵 갱신을 더한 것 (walk+coverage)
+ * 지도: 10 m × 10 m 방부터 창고 규모(150 m × 150 m)까지, 1 cm 해상도
+ * Morton 지도는 지도 파일로 저장한 뒤 mmap으로 연 것(mapfile.c)도 함께 측정하고,
+ * 측정 전에 파일을 페이지 캐시에서 내려 두어 로봇이 닿은 블록만 메모리에 올라오는지 확인합니다.
+ * 세 방식의 최종 로봇 위치와 청소한 칸 수가 같은지도 확인합니다.
+ *
+ * 실행: bench_grid.exe --robots 1024 --ticks 200 --seed 1 --csv bench\results.csv
+ */
+
+#undef main     // 이 파일의 main만 실제 진입점
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "types.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define BENCH_RUNS 3                // 반복 측정 후 가장 빠른 값 사용
+#define BENCH_CELL_MM 10
+#define BENCH_PROBE_MM 210          // 로봇 반지름 + 센서 거리 (env.c와 같음)
+#define BENCH_BODY_MM 170
+#define BENCH_STEP_MM 30
+
+// 함수 선언
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+unsigned long long rng_next(RngState *rng);
+long long monotonic_ns(void);
+bool grid_generate_room(GridMap *map, int room_mm, int cell_mm, unsigned long long seed);
+void grid_free(GridMap *map);
+int grid_occupied(const GridMap *map, int x, int y);
+void env_offsets(int out[ENV_HEADINGS][2], int mm, int cell_mm);
+bool coverage_init(CoverageMap *cov, const GridMap *map);
+void coverage_free(CoverageMap *cov);
+void coverage_update(CoverageMap *cov, const GridMap *map, int x, int y,
+                     bool cleaning, long long time_us);
+bool grid_save(const GridMap *map, const char *path);
+bool grid_map_file(GridMap *map, const char *path);
+long long grid_resident_bytes(const GridMap *map);
+
+// 측정 설정 (명령행 옵션)
+typedef struct {
+    int robots;
+    int ticks;
+    unsigned long long seed;
+    const char *csv_path;       // NULL: 표만 출력
+} BenchConfig;
+
+// 참조 구현: 행 우선 비트보드 (행마다 64칸씩 워드, 칸 조회는 워드 1개 load + shift)
+typedef struct {
+    int width;
+    int height;
+    int words_per_row;
+    unsigned long long *occupied;
+    unsigned long long *cleaned;    // 청소 범위 비트맵 (같은 배치)
+} RowMajorMap;
+
+// 벤치마크 로봇 자세: 칸 좌표 (저장 방식 비교만 하므로 운동학의 Q8 자세 대신 정수 칸 이동)
+typedef struct {
+    int x;
+    int y;
+    int heading;
+} BenchPose;
+
+// 로봇 묶음 (두 저장 방식에 같은 초기 상태로 사용)
+typedef struct {
+    BenchPose *pose;
+    int probe[ENV_HEADINGS][2];
+    int step[ENV_HEADINGS][2];
+    int body[ENV_HEADINGS][2];
+} BenchRobots;
+
+bool rm_from_grid(RowMajorMap *rm, const GridMap *map) {
+    rm->width = map->width;
+    rm->height = map->height;
+    rm->words_per_row = (map->width + 63) / 64;
+    rm->occupied = calloc((size_t)rm->words_per_row * rm->height, sizeof(unsigned long long));
+    rm->cleaned = calloc((size_t)rm->words_per_row * rm->height, sizeof(unsigned long long));
+    if (!rm->occupied || !rm->cleaned) {
+        return false;
+    }
+    for (int y = 0; y < map->height; y++) {
+        for (int x = 0; x < map->width; x++) {
+            rm->occupied[(size_t)y * rm->words_per_row + (x >> 6)]
+                |= (unsigned long long)grid_occupied(map, x, y) << (x & 63);
+        }
+    }
+    return true;
+}
+
+void rm_free(RowMajorMap *rm) {
+    free(rm->occupied);
+    free(rm->cleaned);
+    rm->occupied = NULL;
+    rm->cleaned = NULL;
+}
+
+int rm_occupied(const RowMajorMap *rm, int x, int y) {
+    if ((unsigned)x >= (unsigned)rm->width || (unsigned)y >= (unsigned)rm->height) {
+        return 1;
+    }
+    return (int)(rm->occupied[(size_t)y * rm->words_per_row + (x >> 6)] >> (x & 63)) & 1;
+}
+
+unsigned long long rm_span(int x0, int x1, int w) {
+    int lo = w * 64 > x0 ? w * 64 : x0;
+    int hi = w * 64 + 64 < x1 ? w * 64 + 64 : x1;
+    if (lo >= hi) {
+        return 0;
+    }
+    unsigned long long span = hi - lo == 64 ? ~0ULL : ((1ULL << (hi - lo)) - 1);
+    return span << (lo & 63);
+}
+
+// coverage_update와 같은 규칙을 행 우선 배치로 (footprint 행마다 워드 마스크)
+void rm_coverage_update(RowMajorMap *rm, CoverageMap *cov, int x, int y) {
+    int r = ENV_NOZZLE_MM / 2 / BENCH_CELL_MM;
+    int x0 = x - r < 0 ? 0 : x - r;
+    int x1 = x + r > rm->width ? rm->width : x + r;
+    int y0 = y - r < 0 ? 0 : y - r;
+    int y1 = y + r > rm->height ? rm->height : y + r;
+    int px0 = cov->prev_x - r, px1 = cov->prev_x + r;
+    int py0 = cov->prev_valid ? cov->prev_y - r : 0;
+    int py1 = cov->prev_valid ? cov->prev_y + r : 0;
+
+    cov->ticks++;
+    for (int row = y0; row < y1; row++) {
+        size_t base = (size_t)row * rm->words_per_row;
+        bool overlap = row >= py0 && row < py1;
+        for (int w = x0 >> 6; w <= (x1 - 1) >> 6; w++) {
+            unsigned long long m = rm_span(x0, x1, w) & ~rm->occupied[base + w];
+            if (overlap) {
+                m &= ~rm_span(px0, px1, w);
+            }
+            unsigned long long old = rm->cleaned[base + w];
+            int swept = __builtin_popcountll(m);
+            int recleaned = __builtin_popcountll(m & old);
+            cov->swept_cells += swept;
+            cov->recleaned_cells += recleaned;
+            cov->cleaned_cells += swept - recleaned;
+            rm->cleaned[base + w] = old | m;
+        }
+    }
+    cov->prev_x = x;
+    cov->prev_y = y;
+    cov->prev_valid = true;
+}
+
+// 로봇 1대 1 tick (env_sense + env_move와 같은 규칙, 회전 방향은 왼쪽이 막혔는지로 결정)
+// OCCUPIED(x, y)만 저장 방식마다 다름
+#define BENCH_ROBOT_STEP(p, robots, OCCUPIED)                                              \
+    do {                                                                                   \
+        const int *f = (robots)->probe[(p)->heading];                                      \
+        const int *l = (robots)->probe[((p)->heading + 6) & 7];                            \
+        const int *r = (robots)->probe[((p)->heading + 2) & 7];                            \
+        int front = OCCUPIED((p)->x + f[0], (p)->y + f[1]);                                \
+        int left = OCCUPIED((p)->x + l[0], (p)->y + l[1]);                                 \
+        int right = OCCUPIED((p)->x + r[0], (p)->y + r[1]);                                \
+        if (front) {                                                                       \
+            (p)->heading = ((p)->heading + (left && !right ? 1 : 7)) & 7;                  \
+        } else {                                                                           \
+            int nx = (p)->x + (robots)->step[(p)->heading][0];                             \
+            int ny = (p)->y + (robots)->step[(p)->heading][1];                             \
+            if (!OCCUPIED(nx + (robots)->body[(p)->heading][0],                            \
+                          ny + (robots)->body[(p)->heading][1])) {                         \
+                (p)->x = nx;                                                               \
+                (p)->y = ny;                                                               \
+            }                                                                              \
+        }                                                                                  \
+    } while (0)
+
+#define MORTON_OCCUPIED(x, y) grid_occupied(map, (x), (y))
+#define ROW_MAJOR_OCCUPIED(x, y) rm_occupied(rm, (x), (y))
+
+void bench_walk_morton(const GridMap *map, BenchRobots *robots, int n, int ticks,
+                       CoverageMap *cov) {
+    for (int t = 0; t < ticks; t++) {
+        for (int i = 0; i < n; i++) {
+            BenchPose *p = &robots->pose[i];
+            BENCH_ROBOT_STEP(p, robots, MORTON_OCCUPIED);
+            if (cov) {
+                coverage_update(cov, map, p->x, p->y, true, 0);
+            }
+        }
+    }
+}
+
+void bench_walk_row_major(RowMajorMap *rm, BenchRobots *robots, int n, int ticks,
+                          CoverageMap *cov) {
+    for (int t = 0; t < ticks; t++) {
+        for (int i = 0; i < n; i++) {
+            BenchPose *p = &robots->pose[i];
+            BENCH_ROBOT_STEP(p, robots, ROW_MAJOR_OCCUPIED);
+            if (cov) {
+                rm_coverage_update(rm, cov, p->x, p->y);
+            }
+        }
+    }
+}
+
+// 로봇을 지도 전체의 빈 칸에 흩어 놓음 (몸체가 장애물에 걸리지 않는 곳)
+void bench_place_robots(BenchPose *pose, int n, const GridMap *map, RngState *rng) {
+    int margin = BENCH_BODY_MM / BENCH_CELL_MM;
+    for (int i = 0; i < n; ) {
+        unsigned long long r = rng_next(rng);
+        int x = (int)((r & 0xFFFFFF) % (unsigned)map->width);
+        int y = (int)(((r >> 24) & 0xFFFFFF) % (unsigned)map->height);
+        if (grid_occupied(map, x - margin, y) || grid_occupied(map, x + margin, y) ||
+            grid_occupied(map, x, y - margin) || grid_occupied(map, x, y + margin)) {
+            continue;
+        }
+        pose[i].x = x;
+        pose[i].y = y;
+        pose[i].heading = (int)(r >> 56) & 7;
+        i++;
+    }
+}
+
+// 방금 쓴 지도 파일을 디스크에 내리고 페이지 캐시에서 제거 (mmap 측정이 빈 캐시에서 시작하도록)
+void bench_drop_cache(const char *path) {
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    if (fd >= 0) {
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+// 로봇 위치 검사합 (두 저장 방식의 결과 비교)
+unsigned long long bench_pose_sum(const BenchPose *pose, int n) {
+    unsigned long long sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum = sum * 31 + (unsigned long long)pose[i].x * 100003 + pose[i].y * 8 + pose[i].heading;
+    }
+    return sum;
+}
+
+//   --robots N    지도에 흩어 놓는 로봇 수 (기본 1024)
+//   --ticks N     측정 1회당 tick 수 (기본 200)
+//   --seed N      지도 / 로봇 배치 시드 (기본 1)
+//   --csv FILE    결과를 CSV 행으로 추가 (실행 간 비교용)
+void bench_parse_args(int argc, char *argv[], BenchConfig *cfg) {
+    cfg->robots = 1024;
+    cfg->ticks = 200;
+    cfg->seed = 1;
+    cfg->csv_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--robots") == 0 && i + 1 < argc) {
+            cfg->robots = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            cfg->ticks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            cfg->seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            cfg->csv_path = argv[++i];
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    BenchConfig cfg;
+    const int rooms_m[] = {10, 30, 100, 150};
+    const char *layouts[] = {"morton", "row-major", "mmap"};
+
+    bench_parse_args(argc, argv, &cfg);
+    if (cfg.robots <= 0 || cfg.ticks <= 0) {
+        fprintf(stderr, "--robots and --ticks must be positive\n");
+        return 1;
+    }
+
+    BenchRobots robots;
+    BenchPose *start = malloc((size_t)cfg.robots * sizeof(BenchPose));
+    robots.pose = malloc((size_t)cfg.robots * sizeof(BenchPose));
+    if (!start || !robots.pose) {
+        fprintf(stderr, "Robot allocation failed\n");
+        return 1;
+    }
+    env_offsets(robots.probe, BENCH_PROBE_MM, BENCH_CELL_MM);
+    env_offsets(robots.step, BENCH_STEP_MM, BENCH_CELL_MM);
+    env_offsets(robots.body, BENCH_BODY_MM, BENCH_CELL_MM);
+
+    FILE *csv = NULL;
+    if (cfg.csv_path) {
+        csv = fopen(cfg.csv_path, "a");
+        if (!csv) {
+            perror(cfg.csv_path);
+            return 1;
+        }
+        fseek(csv, 0, SEEK_END);
+        if (ftell(csv) == 0) {
+            fprintf(csv, "version,build,case,ticks,seed,ns_per_tick,ticks_per_s,"
+                         "cycles_per_tick,transitions,cycles_per_transition\n");
+        }
+    }
+
+    printf("=== Grid layout benchmark (%d robots, %d ticks x %d runs, seed %llu) ===\n",
+           cfg.robots, cfg.ticks, BENCH_RUNS, cfg.seed);
+    printf("%-10s %-10s %10s %12s %16s %20s %8s\n", "room", "layout", "map MB", "resident MB",
+           "walk ns/robot", "walk+cov ns/robot", "check");
+
+    for (size_t s = 0; s < sizeof(rooms_m) / sizeof(rooms_m[0]); s++) {
+        GridMap map, mapped;
+        RowMajorMap rm;
+        char path[64];
+        CoverageMap cov;
+        RngState rng;
+
+        if (!grid_generate_room(&map, rooms_m[s] * 1000, BENCH_CELL_MM, cfg.seed) ||
+            !rm_from_grid(&rm, &map) || !coverage_init(&cov, &map)) {
+            fprintf(stderr, "Map allocation failed (%d m)\n", rooms_m[s]);
+            return 1;
+        }
+        snprintf(path, sizeof(path), "bench_grid_%dm.map", rooms_m[s]);
+        if (!grid_save(&map, path)) {
+            return 1;
+        }
+        bench_drop_cache(path);
+        if (!grid_map_file(&mapped, path)) {
+            return 1;
+        }
+        rng_seed(&rng, cfg.seed, 2);
+        bench_place_robots(start, cfg.robots, &map, &rng);
+
+        double map_mb[3] = {
+            map.words * 8.0 / (1 << 20),
+            (double)rm.words_per_row * rm.height * 8 / (1 << 20),
+            mapped.mapping_size / 1048576.0,
+        };
+        unsigned long long pose_sum[3] = {0, 0, 0};
+        long long cleaned[3] = {0, 0, 0};
+        double ns[3][2];
+
+        for (int layout = 0; layout < 3; layout++) {
+            for (int with_cov = 0; with_cov < 2; with_cov++) {
+                long long best_ns = -1;
+                for (int run = 0; run < BENCH_RUNS; run++) {
+                    memcpy(robots.pose, start, (size_t)cfg.robots * sizeof(BenchPose));
+                    CoverageMap *c = NULL;
+                    if (with_cov) {
+                        memset(cov.cleaned, 0, (size_t)map.words * sizeof(unsigned long long));
+                        memset(rm.cleaned, 0, (size_t)rm.words_per_row * rm.height * sizeof(unsigned long long));
+                        cov.cleaned_cells = cov.swept_cells = cov.recleaned_cells = cov.ticks = 0;
+                        cov.prev_valid = false;
+                        c = &cov;
+                    }
+                    long long t0 = monotonic_ns();
+                    if (layout == 0) {
+                        bench_walk_morton(&map, &robots, cfg.robots, cfg.ticks, c);
+                    } else if (layout == 1) {
+                        bench_walk_row_major(&rm, &robots, cfg.robots, cfg.ticks, c);
+                    } else {
+                        bench_walk_morton(&mapped, &robots, cfg.robots, cfg.ticks, c);
+                    }
+                    long long t1 = monotonic_ns();
+                    if (best_ns < 0 || t1 - t0 < best_ns) {
+                        best_ns = t1 - t0;
+                    }
+                }
+                ns[layout][with_cov] = (double)best_ns / ((double)cfg.robots * cfg.ticks);
+                if (with_cov) {
+                    cleaned[layout] = cov.cleaned_cells;
+                } else {
+                    pose_sum[layout] = bench_pose_sum(robots.pose, cfg.robots);
+                }
+            }
+        }
+
+        // mmap: 로봇이 닿은 블록 + 헤더/오프셋 표만 페이지 캐시에 올라와 있어야 함
+        double resident_mb = grid_resident_bytes(&mapped) / 1048576.0;
+        bool same = pose_sum[0] == pose_sum[1] && cleaned[0] == cleaned[1] &&
+                    pose_sum[0] == pose_sum[2] && cleaned[0] == cleaned[2];
+        for (int layout = 0; layout < 3; layout++) {
+            char room[16], resident[16];
+            snprintf(room, sizeof(room), "%dx%d m", rooms_m[s], rooms_m[s]);
+            snprintf(resident, sizeof(resident), layout == 2 ? "%.1f" : "-", resident_mb);
+            printf("%-10s %-10s %10.1f %12s %16.2f %20.2f %8s\n", room, layouts[layout], map_mb[layout],
+                   resident, ns[layout][0], ns[layout][1], same ? "ok" : "MISMATCH");
+            for (int with_cov = 0; csv && with_cov < 2; with_cov++) {
+                fprintf(csv, "grid,%s,%s_%dm,%d,%llu,%.3f,%.0f,-1,%lld,-1\n",
+                        layouts[layout], with_cov ? "walk_coverage" : "walk", rooms_m[s],
+                        cfg.ticks * cfg.robots, cfg.seed, ns[layout][with_cov],
+                        1e9 / ns[layout][with_cov], cleaned[layout]);
+            }
+        }
+
+        coverage_free(&cov);
+        rm_free(&rm);
+        grid_free(&map);
+        grid_free(&mapped);
+        remove(path);
+    }
+
+    if (csv) {
+        fclose(csv);
+    }
+    free(start);
+    free(robots.pose);
+    return 0;
+}
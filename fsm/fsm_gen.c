@@ -0,0 +1,333 @@
+/* ========== FSM 전이 테이블 생성기 ========== */
+/*
+ * fsm_spec.h의 상태/규칙 선언을 펼쳐 (상태, 입력 워드, 타이머 만료) 전체 조합의
+ * 밀집 테이블을 C 소스로 출력하고, 같은 규칙을 분기 없는 식으로 펼친
+ * fleet용 전이 함수(fsm_lane.h)를 함께 출력합니다.
+ *
+ * 사용법:
+ *   gcc -o fsm_gen fsm/fsm_gen.c
+ *   ./fsm_gen v1 src/fsm_table.c src/fsm_lane.h     (Version 1 단일 FSM)
+ *   ./fsm_gen v2 src2/fsm_table.c src2/fsm_lane.h   (Version 2 CN1 + CN2)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_spec.h"
+
+typedef struct {
+    const char *name;
+    int limit;              // 타이머 한계 (0: 없음)
+    const char *motor;      // 기본 모터 명령
+    const char *cleaner;    // 기본 청소기 명령
+} StateSpec;
+
+typedef struct {
+    const char *from;
+    int mask;
+    int value;
+    const char *to;
+    const char *motor;
+    int reload;
+    const char *msg[2];
+} RuleSpec;
+
+typedef struct {
+    const char *prefix;     // 출력 심볼 접두사 (fsm_v1_table 등)
+    const char *tag;        // trace 메시지 머리말
+    int input_bits;         // 센서 입력 워드 비트 수 (IN_T 제외)
+    const StateSpec *states;
+    int state_count;
+    const RuleSpec *rules;
+    int rule_count;
+} FsmSpec;
+
+#define SPEC_STATE(name, limit, motor, cleaner) {#name, limit, #motor, #cleaner},
+#define SPEC_RULE(from, mask, value, to, motor, reload, msg1, msg2) \
+    {#from, mask, value, #to, #motor, reload, {msg1, msg2}},
+
+static const StateSpec v1_states[] = { FSM_V1_STATES(SPEC_STATE) };
+static const RuleSpec v1_rules[] = { FSM_V1_RULES(SPEC_RULE) };
+static const StateSpec cn1_states[] = { FSM_CN1_STATES(SPEC_STATE) };
+static const RuleSpec cn1_rules[] = { FSM_CN1_RULES(SPEC_RULE) };
+static const StateSpec cn2_states[] = { FSM_CN2_STATES(SPEC_STATE) };
+static const RuleSpec cn2_rules[] = { FSM_CN2_RULES(SPEC_RULE) };
+
+#define COUNT(a) ((int)(sizeof(a) / sizeof((a)[0])))
+
+static const FsmSpec v1_spec = {
+    "fsm_v1", "[FSM]", 4, v1_states, COUNT(v1_states), v1_rules, COUNT(v1_rules)
+};
+static const FsmSpec cn1_spec = {
+    "fsm_cn1", "[CN1]", 5, cn1_states, COUNT(cn1_states), cn1_rules, COUNT(cn1_rules)
+};
+static const FsmSpec cn2_spec = {
+    "fsm_cn2", "[CN2]", 5, cn2_states, COUNT(cn2_states), cn2_rules, COUNT(cn2_rules)
+};
+
+// 명령 이름을 C 식으로 변환 (KEEP → FSM_KEEP)
+static const char *command_name(const char *name) {
+    return strcmp(name, "KEEP") == 0 ? "FSM_KEEP" : name;
+}
+
+static int find_state(const FsmSpec *spec, const char *name) {
+    for (int s = 0; s < spec->state_count; s++) {
+        if (strcmp(spec->states[s].name, name) == 0) {
+            return s;
+        }
+    }
+    fprintf(stderr, "fsm_gen: %s: unknown state '%s'\n", spec->prefix, name);
+    exit(1);
+}
+
+// 메시지 번호 (0: 없음, 같은 문장은 같은 번호)
+static int message_index(const char **messages, int *count, const char *msg) {
+    if (!msg) {
+        return 0;
+    }
+    for (int m = 1; m < *count; m++) {
+        if (strcmp(messages[m], msg) == 0) {
+            return m;
+        }
+    }
+    messages[*count] = msg;
+    return (*count)++;
+}
+
+// (상태, 입력)에 처음으로 맞는 규칙 (없으면 NULL)
+static const RuleSpec *match_rule(const FsmSpec *spec, int state, int input) {
+    for (int r = 0; r < spec->rule_count; r++) {
+        const RuleSpec *rule = &spec->rules[r];
+        if (find_state(spec, rule->from) == state && (input & rule->mask) == rule->value) {
+            return rule;
+        }
+    }
+    return NULL;
+}
+
+static void emit_fsm(FILE *out, const FsmSpec *spec) {
+    const char *messages[64] = {NULL};
+    int message_count = 1;
+    int words = 1 << spec->input_bits;
+
+    // 규칙 검사: 목적 상태 존재 여부, 도달하지 않는 규칙
+    for (int r = 0; r < spec->rule_count; r++) {
+        const RuleSpec *rule = &spec->rules[r];
+        int from = find_state(spec, rule->from);
+        int used = 0;
+        find_state(spec, rule->to);
+        for (int input = 0; input < (words << 1) && !used; input++) {
+            int full = (input & (words - 1)) | ((input >> spec->input_bits) ? IN_T : 0);
+            used = match_rule(spec, from, full) == rule;
+        }
+        if (!used) {
+            fprintf(stderr, "fsm_gen: %s: rule %d (%s -> %s) is shadowed\n",
+                    spec->prefix, r, rule->from, rule->to);
+            exit(1);
+        }
+        for (int k = 0; k < 2; k++) {
+            message_index(messages, &message_count, rule->msg[k]);
+        }
+    }
+
+    fprintf(out, "// %s: 상태별 타이머 한계 (해당 상태 N tick째에 만료, 0: 없음)\n", spec->prefix);
+    fprintf(out, "const unsigned char %s_timer_limit[%d] = {\n", spec->prefix, spec->state_count);
+    for (int s = 0; s < spec->state_count; s++) {
+        fprintf(out, "    %d,  // %s\n", spec->states[s].limit, spec->states[s].name);
+    }
+    fprintf(out, "};\n\n");
+
+    // 로그가 꺼진 빌드(RVC_LOG_LEVEL < RVC_LOG_TRANSITION)에는 메시지 문자열을 넣지 않음
+    fprintf(out, "#if RVC_LOG_LEVEL >= RVC_LOG_TRANSITION\n");
+    fprintf(out, "const char *const %s_messages[%d] = {\n", spec->prefix, message_count);
+    fprintf(out, "    NULL,\n");
+    for (int m = 1; m < message_count; m++) {
+        fprintf(out, "    \"%s %s\",\n", spec->tag, messages[m]);
+    }
+    fprintf(out, "};\n");
+    fprintf(out, "#endif\n\n");
+
+    fprintf(out, "// [상태][입력 워드][타이머 만료] → {다음 상태, 모터, 청소기, 타이머, 메시지}\n");
+    fprintf(out, "const FsmEntry %s_table[%d][%d][2] = {\n",
+            spec->prefix, spec->state_count, words);
+    for (int s = 0; s < spec->state_count; s++) {
+        const StateSpec *state = &spec->states[s];
+        fprintf(out, "    {   // %s\n", state->name);
+        for (int w = 0; w < words; w++) {
+            fprintf(out, "        {");
+            for (int expired = 0; expired < 2; expired++) {
+                const RuleSpec *rule = match_rule(spec, s, w | (expired ? IN_T : 0));
+                const char *motor = state->motor;
+                if (rule && strcmp(rule->motor, "DEFAULT") != 0) {
+                    motor = rule->motor;
+                }
+                fprintf(out, "{%s, %s, %s, %d, {%d, %d}}%s",
+                        rule ? rule->to : state->name,
+                        command_name(motor), command_name(state->cleaner),
+                        rule ? rule->reload : 0,
+                        rule ? message_index(messages, &message_count, rule->msg[0]) : 0,
+                        rule ? message_index(messages, &message_count, rule->msg[1]) : 0,
+                        expired ? "" : ", ");
+            }
+            fprintf(out, "},  // 0x%02x\n", w);
+        }
+        fprintf(out, "    },\n");
+    }
+    fprintf(out, "};\n\n");
+}
+
+// 상태별 기본 명령의 합 식: Σ (상태 S면 -1) & 명령 (KEEP 상태는 이전 명령 prev)
+// 모든 상태가 KEEP이면 prev 그대로. prev를 쓰지 않으면 1을 돌려줌
+static int emit_default(FILE *out, const FsmSpec *spec, const char *field,
+                        int cleaner, const char *prev) {
+    int keeps = 0;
+    for (int s = 0; s < spec->state_count; s++) {
+        const StateSpec *state = &spec->states[s];
+        keeps += strcmp(cleaner ? state->cleaner : state->motor, "KEEP") == 0;
+    }
+    if (keeps == spec->state_count) {
+        fprintf(out, "    r.%s = %s;\n", field, prev);
+        return 0;
+    }
+    fprintf(out, "    r.%s =", field);
+    for (int s = 0; s < spec->state_count; s++) {
+        const StateSpec *state = &spec->states[s];
+        const char *command = cleaner ? state->cleaner : state->motor;
+        fprintf(out, "%s\n        (-(one >> %s & 1) & %s)", s ? " +" : "", state->name,
+                strcmp(command, "KEEP") == 0 ? prev : command);
+    }
+    fprintf(out, ";\n");
+    return keeps == 0;
+}
+
+// fleet SoA 루프용 전이 함수: 테이블 조회(gather)는 벡터화되지 않으므로
+// 같은 규칙을 "조건 마스크 & 변화량"의 합으로 펼쳐 루프 본문에 분기가 없도록 함
+// - 상태 검사는 one-hot 비트로 함 (state == S 비교가 반복되면 컴파일러가 상태별 분기로 바꿈)
+// - 상태마다 규칙 순서의 첫 번째 적용은 open(아직 맞은 규칙 없음) 플래그로 표현
+static void emit_lane(FILE *out, const FsmSpec *spec) {
+    fprintf(out, "// %s_table과 같은 전이를 로봇 1대분 식으로 계산 (fleet_step 루프 본문에 인라인)\n",
+            spec->prefix);
+    fprintf(out, "// duration: 이번 tick을 포함한 상태 지속 tick 수, motor/cleaner: 이전 명령\n");
+    fprintf(out, "static inline FsmLane %s_lane(int state, int word, int duration, "
+            "int motor, int cleaner) {\n", spec->prefix);
+    fprintf(out, "    int one = 1 << state;\n");
+    fprintf(out, "    FsmLane r;\n");
+    if (emit_default(out, spec, "motor", 0, "motor")) {
+        fprintf(out, "    (void)motor;\n");
+    }
+    if (emit_default(out, spec, "cleaner", 1, "cleaner")) {
+        fprintf(out, "    (void)cleaner;\n");
+    }
+
+    fprintf(out, "    int limit = 0");
+    for (int s = 0; s < spec->state_count; s++) {
+        if (spec->states[s].limit) {
+            fprintf(out, "\n        + (-(one >> %s & 1) & %d)", spec->states[s].name,
+                    spec->states[s].limit);
+        }
+    }
+    fprintf(out, ";\n");
+    fprintf(out, "    int in = word | (duration >= limit) << 5;    // IN_T: 상태 타이머 만료\n");
+    fprintf(out, "    int open, hit;\n");
+    fprintf(out, "    r.next = state;\n");
+    fprintf(out, "    r.reload = 0;\n");
+
+    // hit는 0 또는 -1(모든 비트 1) 마스크: 곱셈 대신 &로 선택 (정수 벡터 곱셈은 느림)
+    for (int s = 0; s < spec->state_count; s++) {
+        const StateSpec *from = &spec->states[s];
+        int left = 0;
+        for (int r = 0; r < spec->rule_count; r++) {
+            left += find_state(spec, spec->rules[r].from) == s;
+        }
+        if (left == 0) {
+            continue;
+        }
+        fprintf(out, "    open = one >> %s & 1;\n", from->name);
+        for (int r = 0; r < spec->rule_count; r++) {
+            const RuleSpec *rule = &spec->rules[r];
+            if (find_state(spec, rule->from) != s) {
+                continue;
+            }
+            fprintf(out, "    // -> %s\n", rule->to);
+            if (rule->mask) {
+                fprintf(out, "    hit = -(open & ((in & 0x%02x) == 0x%02x));\n",
+                        rule->mask, rule->value);
+            } else {
+                fprintf(out, "    hit = -open;\n");
+            }
+            if (--left > 0) {
+                fprintf(out, "    open &= ~hit;\n");
+            }
+            if (strcmp(rule->from, rule->to) != 0) {
+                fprintf(out, "    r.next += hit & (%s - %s);\n", rule->to, rule->from);
+            }
+            // 규칙이 맞으면 r.motor는 상태의 기본 명령이므로 규칙 명령과의 차이만 더함
+            const char *base = strcmp(from->motor, "KEEP") == 0 ? "motor" : from->motor;
+            const char *target = NULL;
+            if (strcmp(rule->motor, "KEEP") == 0) {
+                target = "motor";
+            } else if (strcmp(rule->motor, "DEFAULT") != 0) {
+                target = rule->motor;
+            }
+            if (target && strcmp(target, base) != 0) {
+                fprintf(out, "    r.motor += hit & (%s - %s);\n", target, base);
+            }
+            if (rule->reload) {
+                fprintf(out, "    r.reload += hit & %d;\n", rule->reload);
+            }
+        }
+    }
+    fprintf(out, "    return r;\n");
+    fprintf(out, "}\n\n");
+}
+
+static FILE *open_output(const char *path, const char *title) {
+    FILE *out = fopen(path, "w");
+    if (!out) {
+        perror(path);
+        exit(1);
+    }
+    fprintf(out, "/* ========== %s ========== */\n\n", title);
+    fprintf(out, "// 주의: 이 파일은 fsm/fsm_spec.h에서 fsm_gen으로 자동 생성한 것입니다.\n");
+    fprintf(out, "//       전이 규칙은 fsm/fsm_spec.h에서 수정하세요.\n");
+    return out;
+}
+
+static void close_output(FILE *out, const char *path) {
+    if (fclose(out) != 0) {
+        perror(path);
+        exit(1);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 4 || (strcmp(argv[1], "v1") != 0 && strcmp(argv[1], "v2") != 0)) {
+        fprintf(stderr, "usage: %s v1|v2 TABLE.c LANE.h\n", argv[0]);
+        return 1;
+    }
+    int v2 = strcmp(argv[1], "v2") == 0;
+
+    FILE *out = open_output(argv[2], "FSM 전이 테이블");
+    fprintf(out, "// 입력 워드 비트: 0=Front, 1=Left, 2=Right, 3=Dust%s\n\n",
+            v2 ? ", 4=CN1 Cleaner_Trigger / CN2 Motor_Status" : "");
+    fprintf(out, "#include <stdio.h>\n");
+    fprintf(out, "#include \"types.h\"\n\n");
+    if (v2) {
+        emit_fsm(out, &cn1_spec);
+        emit_fsm(out, &cn2_spec);
+    } else {
+        emit_fsm(out, &v1_spec);
+    }
+    close_output(out, argv[2]);
+
+    out = open_output(argv[3], "FSM 전이 함수 (fleet SoA 커널용)");
+    fprintf(out, "// fsm_table.c와 같은 규칙을 분기 없는 식으로 펼친 것 (fleet.c에서 include)\n\n");
+    if (v2) {
+        emit_lane(out, &cn1_spec);
+        emit_lane(out, &cn2_spec);
+    } else {
+        emit_lane(out, &v1_spec);
+    }
+    close_output(out, argv[3]);
+    return 0;
+}
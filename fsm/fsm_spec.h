@@ -0,0 +1,118 @@
+/* ========== FSM 전이 명세 (V1 / V2 공통 원본) ========== */
+/*
+ * fsm_gen이 이 파일을 읽어 src/fsm_table.c, src2/fsm_table.c를 생성합니다.
+ * 전이 규칙을 바꿀 때는 이 파일만 수정하고 테이블을 다시 생성하세요.
+ *
+ * STATE(이름, 타이머 한계, 기본 모터 명령, 기본 청소기 명령)
+ *   - 타이머 한계: 해당 상태에서 N tick째에 만료 (0: 타이머 없음)
+ *   - KEEP: 이전 명령 유지
+ * RULE(상태, 조건 마스크, 조건 값, 다음 상태, 모터 명령, 타이머 값, 메시지1, 메시지2)
+ *   - (입력 & 마스크) == 값 이면 적용. 같은 상태의 규칙은 위에서부터 첫 번째만 적용
+ *   - 맞는 규칙이 없으면 상태 유지 + 기본 명령
+ *   - DEFAULT: 상태의 기본 모터 명령 사용
+ *   - 타이머 값: 다음 상태 진입 시 카운트다운 타이머 값 (0: 없음)
+ */
+
+// 입력 비트
+#define IN_F 0x01   // SRS PDF p.2 "Front_Obs"
+#define IN_L 0x02   // SRS PDF p.2 "Left_Obs"
+#define IN_R 0x04   // SRS PDF p.2 "Right_Obs"
+#define IN_D 0x08   // SRS PDF p.2 "Dust_Exist"
+#define IN_X 0x10   // FSM별 추가 입력 (CN1: Cleaner_Trigger, CN2: Motor_Status)
+#define IN_T 0x20   // 상태 타이머 만료
+
+/* ---------- Version 1: 단일 FSM (SA PDF p.11-13) ---------- */
+
+#define FSM_V1_STATES(STATE) \
+    STATE(STATE_MOVING,        0, MOTOR_FORWARD,  CLEANER_ON) \
+    STATE(STATE_TURNING,       2, KEEP,           CLEANER_ON) \
+    STATE(STATE_BACKWARDING,   3, MOTOR_BACKWARD, CLEANER_ON) \
+    STATE(STATE_DUST_CLEANING, 5, MOTOR_STOP,     CLEANER_POWERUP) \
+    STATE(STATE_PAUSE,         3, MOTOR_STOP,     CLEANER_ON)
+
+#define FSM_V1_RULES(RULE) \
+    /* SRS PDF p.3 FR-5.1 "Dust_Exist 시 Boost 모드" */ \
+    RULE(STATE_MOVING, IN_D, IN_D, STATE_DUST_CLEANING, DEFAULT, 5, \
+         "MOVING -> DUST_CLEANING (dust detected)", 0) \
+    /* SA PDF p.13 "Moving → Turning (Front Obstacle)" */ \
+    RULE(STATE_MOVING, IN_F, IN_F, STATE_TURNING, DEFAULT, 0, \
+         "MOVING -> TURNING (front obstacle)", 0) \
+    /* SRS PDF p.3 FR-3.3 "좌/우 모두 불가 시 Backward" */ \
+    RULE(STATE_TURNING, IN_F | IN_L | IN_R, IN_F | IN_L | IN_R, STATE_BACKWARDING, KEEP, 3, \
+         "TURNING -> BACKWARDING (all blocked)", 0) \
+    /* SRS PDF p.3 FR-3.2 "좌/우 모두 가용 시 Left 우선" */ \
+    RULE(STATE_TURNING, IN_L | IN_T, IN_T, STATE_MOVING, MOTOR_TURN_LEFT, 0, \
+         "Turning LEFT (priority)", "TURNING -> MOVING (turn complete)") \
+    RULE(STATE_TURNING, IN_L, 0, STATE_TURNING, MOTOR_TURN_LEFT, 0, \
+         "Turning LEFT (priority)", 0) \
+    RULE(STATE_TURNING, IN_R | IN_T, IN_T, STATE_MOVING, MOTOR_TURN_RIGHT, 0, \
+         "Turning RIGHT", "TURNING -> MOVING (turn complete)") \
+    RULE(STATE_TURNING, IN_R, 0, STATE_TURNING, MOTOR_TURN_RIGHT, 0, \
+         "Turning RIGHT", 0) \
+    /* SA PDF p.11 "Pause: 일시 정지 (탈출 대기)" */ \
+    RULE(STATE_TURNING, 0, 0, STATE_PAUSE, KEEP, 0, \
+         "TURNING -> PAUSE (no turn available)", 0) \
+    RULE(STATE_BACKWARDING, IN_T, IN_T, STATE_TURNING, DEFAULT, 0, \
+         "BACKWARDING -> TURNING (escape)", 0) \
+    /* SRS PDF p.3 FR-5.2 "일정 시간/영역 청소 후 Normal 복귀" */ \
+    RULE(STATE_DUST_CLEANING, IN_T, IN_T, STATE_MOVING, DEFAULT, 0, \
+         "DUST_CLEANING -> MOVING (clean complete)", 0) \
+    /* SRS PDF p.3 FR-4.2 "Backward→Turn→Forward 시퀀스" */ \
+    RULE(STATE_PAUSE, IN_T, IN_T, STATE_BACKWARDING, DEFAULT, 3, \
+         "PAUSE -> BACKWARDING (deadlock escape)", 0)
+
+/* ---------- Version 2 CN1: 모터 FSM (SA PDF p.15), IN_X = Cleaner_Trigger ---------- */
+
+#define FSM_CN1_STATES(STATE) \
+    STATE(MOTOR_IDLE,        2, CMD_STOP,     KEEP) \
+    STATE(MOTOR_MOVING,      0, CMD_FORWARD,  KEEP) \
+    STATE(MOTOR_TURNING,     2, KEEP,         KEEP) \
+    STATE(MOTOR_BACKWARDING, 3, CMD_BACKWARD, KEEP) \
+    STATE(MOTOR_PAUSED,      5, CMD_STOP,     KEEP)
+
+#define FSM_CN1_RULES(RULE) \
+    RULE(MOTOR_IDLE, IN_T, IN_T, MOTOR_MOVING, DEFAULT, 0, \
+         "IDLE -> MOVING (start)", 0) \
+    /* SRS PDF p.3 FR-2.3 "Trigger 수신 시 Pause 상태로 전이" */ \
+    RULE(MOTOR_MOVING, IN_X, IN_X, MOTOR_PAUSED, DEFAULT, 0, \
+         "MOVING -> PAUSED (cleaner trigger)", 0) \
+    RULE(MOTOR_MOVING, IN_F, IN_F, MOTOR_TURNING, DEFAULT, 0, \
+         "MOVING -> TURNING (front obstacle)", 0) \
+    /* SA PDF p.15 "Turning → Backwarding (전방향 막힘)" */ \
+    RULE(MOTOR_TURNING, IN_F | IN_L | IN_R, IN_F | IN_L | IN_R, MOTOR_BACKWARDING, KEEP, 3, \
+         "TURNING -> BACKWARDING (all blocked)", 0) \
+    /* SRS PDF p.3 FR-3.2 "좌/우 모두 가용 시 Left 우선" */ \
+    RULE(MOTOR_TURNING, IN_L | IN_T, IN_T, MOTOR_MOVING, CMD_TURN_LEFT, 0, \
+         "Executing TURN_LEFT", "TURNING -> MOVING (turn complete)") \
+    RULE(MOTOR_TURNING, IN_L, 0, MOTOR_TURNING, CMD_TURN_LEFT, 0, \
+         "Executing TURN_LEFT", 0) \
+    RULE(MOTOR_TURNING, IN_R | IN_T, IN_T, MOTOR_MOVING, CMD_TURN_RIGHT, 0, \
+         "Executing TURN_RIGHT", "TURNING -> MOVING (turn complete)") \
+    RULE(MOTOR_TURNING, IN_R, 0, MOTOR_TURNING, CMD_TURN_RIGHT, 0, \
+         "Executing TURN_RIGHT", 0) \
+    RULE(MOTOR_TURNING, 0, 0, MOTOR_PAUSED, KEEP, 0, \
+         "TURNING -> PAUSED (no path)", 0) \
+    RULE(MOTOR_BACKWARDING, IN_T, IN_T, MOTOR_TURNING, DEFAULT, 0, \
+         "BACKWARDING -> TURNING (escape)", 0) \
+    /* SRS PDF p.5 "Pause: 안전 정지(Stop과 달리 Deadlock 회피)" */ \
+    RULE(MOTOR_PAUSED, IN_X, 0, MOTOR_MOVING, DEFAULT, 0, \
+         "PAUSED -> MOVING (resume)", 0) \
+    RULE(MOTOR_PAUSED, IN_T, IN_T, MOTOR_BACKWARDING, DEFAULT, 3, \
+         "PAUSED -> BACKWARDING (deadlock escape)", 0)
+
+/* ---------- Version 2 CN2: 청소기 FSM (SA PDF p.16), IN_X = Motor_Status ---------- */
+
+#define FSM_CN2_STATES(STATE) \
+    STATE(CLEANER_OFF,     0, KEEP, CMD_OFF) \
+    STATE(CLEANER_NORMAL,  0, KEEP, CMD_NORMAL) \
+    STATE(CLEANER_POWERUP, 5, KEEP, CMD_TURBO)
+
+#define FSM_CN2_RULES(RULE) \
+    RULE(CLEANER_OFF, 0, 0, CLEANER_NORMAL, DEFAULT, 0, \
+         "OFF -> NORMAL (start)", 0) \
+    /* SRS PDF p.3 FR-5.1 "Dust_Exist 시 Boost 또는 Spot" */ \
+    RULE(CLEANER_NORMAL, IN_D | IN_X, IN_D | IN_X, CLEANER_POWERUP, DEFAULT, 5, \
+         "NORMAL -> POWERUP (dust detected)", 0) \
+    /* SRS PDF p.3 FR-5.2 "일정 시간/영역 청소 후 Normal 복귀" */ \
+    RULE(CLEANER_POWERUP, IN_T, IN_T, CLEANER_NORMAL, DEFAULT, 0, \
+         "POWERUP -> NORMAL (clean complete)", 0)
@@ -1,6 +1,10 @@
 # 파일들을 하나로 합치는 스크립트
 # Git hook에서 사용
 
+# FSM 전이 테이블 생성 (fsm/fsm_spec.h → src/fsm_table.c, src/fsm_lane.h)
+gcc -o fsm_gen.exe fsm\fsm_gen.c
+.\fsm_gen.exe v1 src\fsm_table.c src\fsm_lane.h
+
 $header = @"
 /*
  * RVC 제어 소프트웨어 - Version 1: 단일 FSM
@@ -24,6 +28,7 @@ $header = @"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <time.h>
 
 "@
@@ -35,13 +40,23 @@ $typesContent = Get-Content "src\types.h" -Raw
 $typesContent = $typesContent -replace 'extern RVCContext rvc;', 'RVCContext rvc;'
 $typesContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
 
+$rngContent = Get-Content "src\rng.c" -Raw
+$rngContent = $rngContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$rngContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
 $sensorsContent = Get-Content "src\sensors.c" -Raw
 $sensorsContent = $sensorsContent -replace '(?m)^#include\s+"types.h"\s*$', ''
 $sensorsContent = $sensorsContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
 $sensorsContent = $sensorsContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
 $sensorsContent = $sensorsContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$sensorsContent = $sensorsContent -replace '(?s)// 함수 선언.*?unsigned long long rng_next\(RngState \*rng\);\s*\r?\n', ''
 $sensorsContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
 
+$tableContent = Get-Content "src\fsm_table.c" -Raw
+$tableContent = $tableContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$tableContent = $tableContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$tableContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
 $fsmContent = Get-Content "src\fsm.c" -Raw
 $fsmContent = $fsmContent -replace '(?m)^#include\s+"types.h"\s*$', ''
 $fsmContent = $fsmContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
@@ -52,11 +67,109 @@ $actuatorsContent = $actuatorsContent -replace '(?m)^#include\s+"types.h"\s*$',
 $actuatorsContent = $actuatorsContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
 $actuatorsContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
 
+$ioContent = Get-Content "src\io.c" -Raw
+$ioContent = $ioContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$ioContent = $ioContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$ioContent = $ioContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$ioContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$kinematicsContent = Get-Content "src\kinematics.c" -Raw
+$kinematicsContent = $kinematicsContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$kinematicsContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$envContent = Get-Content "src\env.c" -Raw
+$envContent = $envContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$envContent = $envContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$envContent = $envContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$envContent = $envContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$envContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$mapfileContent = Get-Content "src\mapfile.c" -Raw
+$mapfileContent = $mapfileContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$mapfileContent = $mapfileContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$mapfileContent = $mapfileContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$mapfileContent = $mapfileContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$mapfileContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$coverageContent = Get-Content "src\coverage.c" -Raw
+$coverageContent = $coverageContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$coverageContent = $coverageContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$coverageContent = $coverageContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$coverageContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$dustContent = Get-Content "src\dust.c" -Raw
+$dustContent = $dustContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$dustContent = $dustContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$dustContent = $dustContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$dustContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$clockContent = Get-Content "src\clock.c" -Raw
+$clockContent = $clockContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$clockContent = $clockContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$clockContent = $clockContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$clockContent = $clockContent -replace '(?m)^#include\s+<time.h>\s*$', ''
+$clockContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$latencyContent = Get-Content "src\latency.c" -Raw
+$latencyContent = $latencyContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$latencyContent = $latencyContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$latencyContent = $latencyContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$latencyContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$ticklessContent = Get-Content "src\tickless.c" -Raw
+$ticklessContent = $ticklessContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$ticklessContent = $ticklessContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$ticklessContent = $ticklessContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$ticklessContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$laneContent = Get-Content "src\fsm_lane.h" -Raw
+$laneContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$fleetContent = Get-Content "src\fleet.c" -Raw
+$fleetContent = $fleetContent -replace '(?m)^#include\s+"fsm_lane.h"\s*$', ''
+$fleetContent = $fleetContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$fleetContent = $fleetContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$fleetContent = $fleetContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$fleetContent = $fleetContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$fleetContent = $fleetContent -replace '(?s)// 함수 선언.*?unsigned long long rng_next\(RngState \*rng\);\s*\r?\n', ''
+$fleetContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$swarmContent = Get-Content "src\swarm.c" -Raw
+$swarmContent = $swarmContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$swarmContent = $swarmContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$swarmContent = $swarmContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$swarmContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$poolContent = Get-Content "src\pool.c" -Raw
+$poolContent = $poolContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$poolContent = $poolContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$poolContent = $poolContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$poolContent = $poolContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$poolContent = $poolContent -replace '(?s)// 함수 선언.*?void clock_tick_done\(VirtualClock \*clk\);\s*\r?\n', ''
+$poolContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$exploreContent = Get-Content "src\explore.c" -Raw
+$exploreContent = $exploreContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$exploreContent = $exploreContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$exploreContent = $exploreContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$exploreContent = $exploreContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$exploreContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$eventlogContent = Get-Content "src\eventlog.c" -Raw
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<time.h>\s*$', ''
+$eventlogContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
 $mainContent = Get-Content "src\main.c" -Raw
 $mainContent = $mainContent -replace '(?m)^#include\s+"types.h"\s*$', ''
 $mainContent = $mainContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
 $mainContent = $mainContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
 $mainContent = $mainContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$mainContent = $mainContent -replace '(?m)^#include\s+<string.h>\s*$', ''
 $mainContent = $mainContent -replace '(?m)^#include\s+<time.h>\s*$', ''
 $mainContent = $mainContent -replace '(?s)// 함수 선언.*?void actuator_interface\(RVCContext \*ctx\);\s*\r?\n', ''
 $mainContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
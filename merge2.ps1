@@ -1,6 +1,10 @@
 # 파일들을 하나로 합치는 스크립트 (Version 2)
 # Git hook에서 사용
 
+# FSM 전이 테이블 생성 (fsm/fsm_spec.h → src2/fsm_table.c, src2/fsm_lane.h)
+gcc -o fsm_gen.exe fsm\fsm_gen.c
+.\fsm_gen.exe v2 src2\fsm_table.c src2\fsm_lane.h
+
 $header = @"
 /*
  * RVC 제어 소프트웨어 - Version 2: 이중 FSM (CN1 + CN2)
@@ -23,6 +27,7 @@ $header = @"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <time.h>
 
 "@
@@ -34,13 +39,23 @@ $typesContent = Get-Content "src2\types.h" -Raw
 $typesContent = $typesContent -replace 'extern RVCSystem rvc;', 'RVCSystem rvc;'
 $typesContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
 
+$rngContent = Get-Content "src2\rng.c" -Raw
+$rngContent = $rngContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$rngContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
 $sensorsContent = Get-Content "src2\sensors.c" -Raw
 $sensorsContent = $sensorsContent -replace '(?m)^#include\s+"types.h"\s*$', ''
 $sensorsContent = $sensorsContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
 $sensorsContent = $sensorsContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
 $sensorsContent = $sensorsContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$sensorsContent = $sensorsContent -replace '(?s)// 함수 선언.*?unsigned long long rng_next\(RngState \*rng\);\s*\r?\n', ''
 $sensorsContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
 
+$tableContent = Get-Content "src2\fsm_table.c" -Raw
+$tableContent = $tableContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$tableContent = $tableContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$tableContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
 $cn1Content = Get-Content "src2\cn1_fsm.c" -Raw
 $cn1Content = $cn1Content -replace '(?m)^#include\s+"types.h"\s*$', ''
 $cn1Content = $cn1Content -replace '(?m)^#include\s+<stdio.h>\s*$', ''
@@ -51,9 +66,15 @@ $cn2Content = $cn2Content -replace '(?m)^#include\s+"types.h"\s*$', ''
 $cn2Content = $cn2Content -replace '(?m)^#include\s+<stdio.h>\s*$', ''
 $cn2Content | Out-File -FilePath $outputFile -Append -Encoding UTF8
 
+$busContent = Get-Content "src2\bus.c" -Raw
+$busContent = $busContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$busContent = $busContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$busContent = $busContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$busContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
 $controlContent = Get-Content "src2\control.c" -Raw
 $controlContent = $controlContent -replace '(?m)^#include\s+"types.h"\s*$', ''
-$controlContent = $controlContent -replace '(?s)// 함수 선언.*?void cn2_cleaner_fsm\(CN2_Context \*cn2, bool dust_detected, bool motor_moving\);\s*\r?\n', ''
+$controlContent = $controlContent -replace '(?s)// 함수 선언.*?void bus_run_tick\(ControlBus \*bus, RVCSystem \*sys\);\s*\r?\n', ''
 $controlContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
 
 $actuatorsContent = Get-Content "src2\actuators.c" -Raw
@@ -61,11 +82,116 @@ $actuatorsContent = $actuatorsContent -replace '(?m)^#include\s+"types.h"\s*$',
 $actuatorsContent = $actuatorsContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
 $actuatorsContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
 
+$ioContent = Get-Content "src2\io.c" -Raw
+$ioContent = $ioContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$ioContent = $ioContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$ioContent = $ioContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$ioContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$kinematicsContent = Get-Content "src2\kinematics.c" -Raw
+$kinematicsContent = $kinematicsContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$kinematicsContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$envContent = Get-Content "src2\env.c" -Raw
+$envContent = $envContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$envContent = $envContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$envContent = $envContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$envContent = $envContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$envContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$mapfileContent = Get-Content "src2\mapfile.c" -Raw
+$mapfileContent = $mapfileContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$mapfileContent = $mapfileContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$mapfileContent = $mapfileContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$mapfileContent = $mapfileContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$mapfileContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$coverageContent = Get-Content "src2\coverage.c" -Raw
+$coverageContent = $coverageContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$coverageContent = $coverageContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$coverageContent = $coverageContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$coverageContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$dustContent = Get-Content "src2\dust.c" -Raw
+$dustContent = $dustContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$dustContent = $dustContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$dustContent = $dustContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$dustContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$clockContent = Get-Content "src2\clock.c" -Raw
+$clockContent = $clockContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$clockContent = $clockContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$clockContent = $clockContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$clockContent = $clockContent -replace '(?m)^#include\s+<time.h>\s*$', ''
+$clockContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$latencyContent = Get-Content "src2\latency.c" -Raw
+$latencyContent = $latencyContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$latencyContent = $latencyContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$latencyContent = $latencyContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$latencyContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$ticklessContent = Get-Content "src2\tickless.c" -Raw
+$ticklessContent = $ticklessContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$ticklessContent = $ticklessContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$ticklessContent = $ticklessContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$ticklessContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$laneContent = Get-Content "src2\fsm_lane.h" -Raw
+$laneContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$fleetContent = Get-Content "src2\fleet.c" -Raw
+$fleetContent = $fleetContent -replace '(?m)^#include\s+"fsm_lane.h"\s*$', ''
+$fleetContent = $fleetContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$fleetContent = $fleetContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$fleetContent = $fleetContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$fleetContent = $fleetContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$fleetContent = $fleetContent -replace '(?s)// 함수 선언.*?unsigned long long rng_next\(RngState \*rng\);\s*\r?\n', ''
+$fleetContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$swarmContent = Get-Content "src2\swarm.c" -Raw
+$swarmContent = $swarmContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$swarmContent = $swarmContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$swarmContent = $swarmContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$swarmContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$poolContent = Get-Content "src2\pool.c" -Raw
+$poolContent = $poolContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$poolContent = $poolContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$poolContent = $poolContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$poolContent = $poolContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$poolContent = $poolContent -replace '(?s)// 함수 선언.*?void clock_tick_done\(VirtualClock \*clk\);\s*\r?\n', ''
+$poolContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$exploreContent = Get-Content "src2\explore.c" -Raw
+$exploreContent = $exploreContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$exploreContent = $exploreContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$exploreContent = $exploreContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$exploreContent = $exploreContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$exploreContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$pipelineContent = Get-Content "src2\pipeline.c" -Raw
+$pipelineContent = $pipelineContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$pipelineContent = $pipelineContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$pipelineContent = $pipelineContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$pipelineContent = $pipelineContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$pipelineContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
+$eventlogContent = Get-Content "src2\eventlog.c" -Raw
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+"types.h"\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<string.h>\s*$', ''
+$eventlogContent = $eventlogContent -replace '(?m)^#include\s+<time.h>\s*$', ''
+$eventlogContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
+
 $mainContent = Get-Content "src2\main.c" -Raw
 $mainContent = $mainContent -replace '(?m)^#include\s+"types.h"\s*$', ''
 $mainContent = $mainContent -replace '(?m)^#include\s+<stdio.h>\s*$', ''
 $mainContent = $mainContent -replace '(?m)^#include\s+<stdlib.h>\s*$', ''
 $mainContent = $mainContent -replace '(?m)^#include\s+<stdbool.h>\s*$', ''
+$mainContent = $mainContent -replace '(?m)^#include\s+<string.h>\s*$', ''
 $mainContent = $mainContent -replace '(?m)^#include\s+<time.h>\s*$', ''
 $mainContent = $mainContent -replace '(?s)// 함수 선언.*?void actuator_interface\(RVCSystem \*sys\);\s*\r?\n', ''
 $mainContent | Out-File -FilePath $outputFile -Append -Encoding UTF8
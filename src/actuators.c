@@ -3,10 +3,12 @@
 #include <stdio.h>
 #include "types.h"
 
-// 모터 제어 (SA PDF p.7 "3.0 Actuator Interface")
-// SA PDF p.22-23 Process Spec 3.0
+// 함수 선언
+void evlog_emit(int node, int from, int to, int reason, int value, int value2);
+
+// 모터 명령 이름 (이벤트 로그 텍스트 변환용)
 // SRS PDF p.2 "Motor: Motor_Cmd -> {Forward, TurnLeft...}"
-void motor_control(MotorCommand cmd) {
+const char *motor_command_name(int cmd) {
     const char *direction;
     switch (cmd) {
         case MOTOR_FORWARD:   direction = "MOVE_FORWARD"; break;
@@ -16,12 +18,12 @@ void motor_control(MotorCommand cmd) {
         case MOTOR_STOP:      direction = "STOP"; break;
         default:              direction = "UNKNOWN"; break;
     }
-    printf("  [MOTOR] %s\n", direction);
+    return direction;
 }
 
-// 청소기 제어 (SA PDF p.22-23 Process Spec 3.0 "Actuator Interface")
+// 청소기 명령 이름 (이벤트 로그 텍스트 변환용)
 // SRS PDF p.2 "Cleaner: Clean_Cmd -> {Off, Normal, Boost}"
-void cleaner_control(CleanerCommand cmd) {
+const char *cleaner_command_name(int cmd) {
     const char *clean_cmd;
     switch (cmd) {
         case CLEANER_OFF:     clean_cmd = "VACUUM_OFF"; break;
@@ -29,11 +31,59 @@ void cleaner_control(CleanerCommand cmd) {
         case CLEANER_POWERUP: clean_cmd = "VACUUM_TURBO"; break;
         default:              clean_cmd = "UNKNOWN"; break;
     }
-    printf("  [CLEANER] %s\n", clean_cmd);
+    return clean_cmd;
+}
+
+// 일괄 쓰기 1회 (SA PDF p.7 "3.0 Actuator Interface")
+// 바뀐 액추에이터의 명령을 I/O 백엔드에 한 번에 쓰고 trace에 기록
+void actuator_write(unsigned int changed, const int cmd[ACTUATOR_COUNT]) {
+    io_backend->write_actuators(changed, cmd);
+#if RVC_LOG_LEVEL >= RVC_LOG_ACTUATOR
+    evlog_emit(LOG_NODE_OUTPUT, changed, cmd[ACTUATOR_MOTOR], cmd[ACTUATOR_CLEANER], 0, 0);
+#endif
 }
 
+// 출력 단계: 마지막으로 내보낸 명령과 비교하여 바뀐 명령만 모아 tick당 최대 1회 쓰기
+void actuator_commit(ActuatorOutput *out, const int cmd[ACTUATOR_COUNT]) {
+    unsigned int changed = 0;
+    for (int a = 0; a < ACTUATOR_COUNT; a++) {
+        if (!out->committed || cmd[a] != out->last[a]) {
+            changed |= 1u << a;
+            out->last[a] = cmd[a];
+            out->emitted[a]++;
+        } else {
+            out->suppressed[a]++;
+        }
+    }
+    out->committed = true;
+    if (changed) {
+        out->writes++;
+        actuator_write(changed, cmd);
+    }
+}
+
+// 액추에이터 인터페이스 (SA PDF p.22-23 Process Spec 3.0)
 void actuator_interface(RVCContext *ctx) {
-    motor_control(ctx->motor_cmd);
-    cleaner_control(ctx->cleaner_cmd);
+    int cmd[ACTUATOR_COUNT];
+    cmd[ACTUATOR_MOTOR] = ctx->motor_cmd;
+    cmd[ACTUATOR_CLEANER] = ctx->cleaner_cmd;
+    actuator_commit(&ctx->output, cmd);
 }
 
+// 조용한 구간 n tick의 출력 (tickless, tick별 출력이 없는 로그 수준)
+// 구간 안에서는 명령이 바뀌지 않으므로 첫 tick만 비교하고 나머지는 생략으로 집계
+void actuator_skip(RVCContext *ctx, int ticks) {
+    actuator_interface(ctx);
+    for (int a = 0; a < ACTUATOR_COUNT; a++) {
+        ctx->output.suppressed[a] += ticks - 1;
+    }
+}
+
+void actuator_report(const ActuatorOutput *out) {
+    long long ticks = out->emitted[ACTUATOR_MOTOR] + out->suppressed[ACTUATOR_MOTOR];
+    printf("Actuator output: %lld writes in %lld ticks (motor %lld emitted / %lld suppressed, "
+           "cleaner %lld emitted / %lld suppressed)\n",
+           out->writes, ticks,
+           out->emitted[ACTUATOR_MOTOR], out->suppressed[ACTUATOR_MOTOR],
+           out->emitted[ACTUATOR_CLEANER], out->suppressed[ACTUATOR_CLEANER]);
+}
@@ -0,0 +1,342 @@
+/* ========== 격자 환경 (점유 비트보드 + 로봇 자세) ========== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "types.h"
+
+#define ENV_ROOM_MM 10000           // 생성하는 방 한 변 기본값 (10 m × 10 m, --room-m)
+#define ENV_CELL_MM 10              // 격자 해상도 (1 cm)
+#define ENV_WALL_MM 50              // 벽 두께
+#define ENV_FURNITURE 12            // 방 안에 놓는 가구(직사각형 장애물) 수
+#define ENV_FURNITURE_MIN_MM 300
+#define ENV_FURNITURE_MAX_MM 1000
+#define ENV_MAP_STREAM 0xE11        // 지도 생성 난수 스트림 (로봇 센서 스트림과 겹치지 않게)
+
+// 함수 선언
+unsigned long long rng_next(RngState *rng);
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+bool coverage_init(CoverageMap *cov, const GridMap *map);
+void coverage_free(CoverageMap *cov);
+void coverage_update(CoverageMap *cov, const GridMap *map, int x, int y,
+                     bool cleaning, long long time_us);
+void coverage_report(const CoverageMap *cov, const GridMap *map);
+bool dust_init(DustField *dust, const GridMap *map);
+void dust_free(DustField *dust);
+bool dust_scatter(DustField *dust, const GridMap *map, unsigned long long seed);
+int dust_at(const DustField *dust, int x, int y);
+void dust_clean(DustField *dust, const GridMap *map, int x, int y, int pickup);
+void dust_report(const DustField *dust);
+bool grid_save(const GridMap *map, const char *path);
+bool grid_map_file(GridMap *map, const char *path);
+void grid_unmap_file(GridMap *map);
+void grid_free(GridMap *map);
+void kin_init(KinModel *kin, int step_mm, int unit_mm);
+RobotPose kin_next(const KinModel *kin, RobotPose p, int motor);
+
+// 방향별 단위 벡터 (y는 아래로 증가, 방향 번호가 늘면 시계 방향)
+const int env_dir[ENV_HEADINGS][2] = {
+    {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}
+};
+
+// 5비트 타일 좌표 → Morton 번호의 짝수 비트 (x는 그대로, y는 1비트 올려 OR)
+const unsigned short grid_morton[1 << GRID_BLOCK_BITS] = {
+    0, 1, 4, 5, 16, 17, 20, 21,
+    64, 65, 68, 69, 80, 81, 84, 85,
+    256, 257, 260, 261, 272, 273, 276, 277,
+    320, 321, 324, 325, 336, 337, 340, 341,
+};
+
+// 메모리 지도: 블록을 연속 배열에 두고 블록 오프셋 표는 블록 번호 × 8 KB
+bool grid_init(GridMap *map, int width, int height, int cell_mm) {
+    int block_cells = 1 << (GRID_BLOCK_BITS + GRID_TILE_BITS);
+    map->width = width;
+    map->height = height;
+    map->cell_mm = cell_mm;
+    map->blocks_x = (width + block_cells - 1) / block_cells;
+    map->blocks_y = (height + block_cells - 1) / block_cells;
+    map->words = (long long)map->blocks_x * map->blocks_y * GRID_BLOCK_WORDS;
+    map->occupied = calloc((size_t)map->words, sizeof(unsigned long long));
+    map->mapping = NULL;
+    map->mapping_size = 0;
+    map->free_cells = (long long)width * height;
+
+    long long blocks = (long long)map->blocks_x * map->blocks_y;
+    unsigned long long *offsets = malloc((size_t)blocks * sizeof(unsigned long long));
+    for (long long b = 0; offsets && b < blocks; b++) {
+        offsets[b] = (unsigned long long)b * GRID_BLOCK_WORDS * sizeof(unsigned long long);
+    }
+    map->tile_base = (const unsigned char *)map->occupied;
+    map->block_offset = offsets;
+    if (!map->occupied || !offsets) {
+        grid_free(map);
+        return false;
+    }
+    return true;
+}
+
+void grid_free(GridMap *map) {
+    if (map->mapping) {
+        grid_unmap_file(map);
+    } else {
+        free(map->occupied);
+        free((void *)map->block_offset);
+    }
+    map->occupied = NULL;
+    map->tile_base = NULL;
+    map->block_offset = NULL;
+}
+
+// (x, y) 칸이 든 타일 워드: 블록 번호 + 블록 안 Morton 번호
+size_t grid_word(const GridMap *map, int x, int y) {
+    int tx = x >> GRID_TILE_BITS, ty = y >> GRID_TILE_BITS;
+    size_t block = (size_t)(ty >> GRID_BLOCK_BITS) * map->blocks_x + (tx >> GRID_BLOCK_BITS);
+    return block << (2 * GRID_BLOCK_BITS)
+         | grid_morton[tx & ((1 << GRID_BLOCK_BITS) - 1)]
+         | (size_t)grid_morton[ty & ((1 << GRID_BLOCK_BITS) - 1)] << 1;
+}
+
+// grid_word 번호의 타일 워드 (블록 오프셋 표 → 블록 안 워드)
+unsigned long long grid_tile(const GridMap *map, size_t word) {
+    const unsigned long long *block = (const unsigned long long *)
+        (map->tile_base + map->block_offset[word / GRID_BLOCK_WORDS]);
+    return block[word & (GRID_BLOCK_WORDS - 1)];
+}
+
+// 칸 조회: 지도 밖은 장애물 (블록 오프셋 + 워드 load, 분기 1개)
+int grid_occupied(const GridMap *map, int x, int y) {
+    if ((unsigned)x >= (unsigned)map->width || (unsigned)y >= (unsigned)map->height) {
+        return 1;
+    }
+    return (int)(grid_tile(map, grid_word(map, x, y)) >> (((y & 7) << 3) | (x & 7))) & 1;
+}
+
+// 타일 열 tx에서 [x0, x1)에 드는 열 비트를 8행 모두에 복제한 마스크 (겹치지 않으면 0)
+unsigned long long grid_tile_cols(int tx, int x0, int x1) {
+    int ox = tx << GRID_TILE_BITS;
+    int lo = (x0 > ox ? x0 : ox) - ox, hi = (x1 < ox + 8 ? x1 : ox + 8) - ox;
+    if (lo >= hi) {
+        return 0;
+    }
+    return (((1ULL << (hi - lo)) - 1) << lo) * 0x0101010101010101ULL;
+}
+
+// 타일 행 ty에서 [y0, y1)에 드는 행 전체의 마스크 (겹치지 않으면 0)
+unsigned long long grid_tile_rows(int ty, int y0, int y1) {
+    int oy = ty << GRID_TILE_BITS;
+    int top = (y0 > oy ? y0 : oy) - oy, bottom = (y1 < oy + 8 ? y1 : oy + 8) - oy;
+    if (top >= bottom) {
+        return 0;
+    }
+    return bottom - top == 8 ? ~0ULL : ((1ULL << 8 * (bottom - top)) - 1) << 8 * top;
+}
+
+// [x0, x1) × [y0, y1) 직사각형을 장애물로 채움 (지도 밖은 잘라냄, 타일마다 워드 마스크 1회)
+void grid_fill_rect(GridMap *map, int x0, int y0, int x1, int y1) {
+    x0 = x0 < 0 ? 0 : x0;
+    y0 = y0 < 0 ? 0 : y0;
+    x1 = x1 > map->width ? map->width : x1;
+    y1 = y1 > map->height ? map->height : y1;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    for (int ty = y0 >> GRID_TILE_BITS; ty <= (y1 - 1) >> GRID_TILE_BITS; ty++) {
+        for (int tx = x0 >> GRID_TILE_BITS; tx <= (x1 - 1) >> GRID_TILE_BITS; tx++) {
+            map->occupied[grid_word(map, tx << GRID_TILE_BITS, ty << GRID_TILE_BITS)]
+                |= grid_tile_cols(tx, x0, x1) & grid_tile_rows(ty, y0, y1);
+        }
+    }
+}
+
+// 빈 칸 수 갱신: 워드마다 popcount (지도 바깥 여분 비트는 항상 0)
+void grid_count_free(GridMap *map) {
+    long long occupied = 0;
+    for (long long i = 0; i < map->words; i++) {
+        occupied += __builtin_popcountll(map->occupied[i]);
+    }
+    map->free_cells = (long long)map->width * map->height - occupied;
+}
+
+// 방 생성: 테두리 벽 + 무작위 가구, 시작 위치(중앙) 주변은 비워 둠
+bool grid_generate_room(GridMap *map, int room_mm, int cell_mm, unsigned long long seed) {
+    int cells = room_mm / cell_mm;
+    int wall = ENV_WALL_MM / cell_mm;
+    int clear = 2 * ENV_ROBOT_RADIUS_MM / cell_mm;
+    RngState rng;
+
+    if (!grid_init(map, cells, cells, cell_mm)) {
+        return false;
+    }
+    grid_fill_rect(map, 0, 0, cells, wall);
+    grid_fill_rect(map, 0, cells - wall, cells, cells);
+    grid_fill_rect(map, 0, 0, wall, cells);
+    grid_fill_rect(map, cells - wall, 0, cells, cells);
+
+    rng_seed(&rng, seed, ENV_MAP_STREAM);
+    int span = (ENV_FURNITURE_MAX_MM - ENV_FURNITURE_MIN_MM) / cell_mm;
+    for (int placed = 0; placed < ENV_FURNITURE; ) {
+        unsigned long long r = rng_next(&rng);
+        int w = ENV_FURNITURE_MIN_MM / cell_mm + (int)(r % (span + 1));
+        int h = ENV_FURNITURE_MIN_MM / cell_mm + (int)((r >> 16) % (span + 1));
+        int x = (int)((r >> 32) % (unsigned)(cells - w));
+        int y = (int)((r >> 48) % (unsigned)(cells - h));
+        if (x < cells / 2 + clear && x + w > cells / 2 - clear &&
+            y < cells / 2 + clear && y + h > cells / 2 - clear) {
+            continue;   // 시작 위치와 겹침
+        }
+        grid_fill_rect(map, x, y, x + w, y + h);
+        placed++;
+    }
+    grid_count_free(map);
+    return true;
+}
+
+// 방향별 오프셋 (mm → 칸), 대각선은 1/√2 (181/256)
+void env_offsets(int out[ENV_HEADINGS][2], int mm, int cell_mm) {
+    int d = mm / cell_mm;
+    int diag = (d * 181 + 128) / 256;
+    for (int h = 0; h < ENV_HEADINGS; h++) {
+        int len = (h & 1) ? diag : d;
+        out[h][0] = env_dir[h][0] * len;
+        out[h][1] = env_dir[h][1] * len;
+    }
+}
+
+// 지도 위 로봇 1대 준비 (방 중앙, +x 방향)
+void env_world_init(GridWorld *world) {
+    const GridMap *map = &world->map;
+    world->pose.x = map->width / 2 << KIN_FRAC_BITS;
+    world->pose.y = map->height / 2 << KIN_FRAC_BITS;
+    world->pose.heading = 0;
+    world->motor = MOTOR_STOP;
+    world->cleaner = CLEANER_OFF;
+    world->moves = 0;
+    world->bumps = 0;
+    env_offsets(world->probe, ENV_ROBOT_RADIUS_MM + ENV_SENSOR_RANGE_MM, map->cell_mm);
+    kin_init(&world->kin, ENV_STEP_MM, map->cell_mm);
+    env_offsets(world->body, ENV_ROBOT_RADIUS_MM, map->cell_mm);
+}
+
+// 장애물 센서: 앞 / 왼쪽(-90°) / 오른쪽(+90°) 탐지 지점 3곳의 비트 조회
+SensorData env_sense(const GridWorld *world) {
+    const RobotPose *p = &world->pose;
+    int x = p->x >> KIN_FRAC_BITS, y = p->y >> KIN_FRAC_BITS;
+    const int *f = world->probe[p->heading];
+    const int *l = world->probe[(p->heading + 6) & 7];
+    const int *r = world->probe[(p->heading + 2) & 7];
+    return (SensorData)(grid_occupied(&world->map, x + f[0], y + f[1]) * SENSOR_FRONT
+                      | grid_occupied(&world->map, x + l[0], y + l[1]) * SENSOR_LEFT
+                      | grid_occupied(&world->map, x + r[0], y + r[1]) * SENSOR_RIGHT);
+}
+
+// 래치된 모터 명령으로 1 tick 진행 (자세 계산은 kin_next)
+// 전진/후진: 이동 후 몸체 끝이 장애물이면 제자리 (범퍼 접촉), 회전: 45° (SRS PDF p.3 FR-3.2)
+void env_move(GridWorld *world) {
+    RobotPose *p = &world->pose;
+    RobotPose next = kin_next(&world->kin, *p, world->motor);
+    if (world->motor == MOTOR_FORWARD || world->motor == MOTOR_BACKWARD) {
+        int sign = world->motor == MOTOR_FORWARD ? 1 : -1;
+        if (grid_occupied(&world->map, (next.x >> KIN_FRAC_BITS) + sign * world->body[p->heading][0],
+                          (next.y >> KIN_FRAC_BITS) + sign * world->body[p->heading][1])) {
+            world->bumps++;
+            return;
+        }
+        world->moves++;
+    }
+    *p = next;
+}
+
+// ---------- grid I/O 백엔드: 격자 세계에서 센서 유도, 모터 명령으로 로봇 이동 ----------
+
+GridWorld env_world;
+
+void io_grid_release(void) {
+    dust_free(&env_world.dust);
+    coverage_free(&env_world.coverage);
+    grid_free(&env_world.map);
+}
+
+// 격자 세계 지도 (main의 --map / --save-map / --room-m)
+EnvOptions env_options = {NULL, NULL, ENV_ROOM_MM};
+
+// 지도 파일이 있으면 mmap으로 열고 (타일은 로봇이 닿는 곳만 페이지 인), 없으면 시드로 방 생성
+bool io_grid_load_map(GridMap *map, unsigned long long seed) {
+    if (env_options.map_path) {
+        return grid_map_file(map, env_options.map_path);
+    }
+    if (!grid_generate_room(map, env_options.room_mm, ENV_CELL_MM, seed)) {
+        fprintf(stderr, "Grid world allocation failed\n");
+        return false;
+    }
+    return !env_options.save_path || grid_save(map, env_options.save_path);
+}
+
+bool io_grid_open(unsigned long long seed) {
+    if (!io_grid_load_map(&env_world.map, seed)) {
+        io_grid_release();
+        return false;
+    }
+    if (!coverage_init(&env_world.coverage, &env_world.map) ||
+        !dust_init(&env_world.dust, &env_world.map) ||
+        !dust_scatter(&env_world.dust, &env_world.map, seed)) {
+        fprintf(stderr, "Grid world allocation failed\n");
+        io_grid_release();
+        return false;
+    }
+    env_world_init(&env_world);
+    return true;
+}
+
+// tick 시작: 지난 tick까지 래치된 명령으로 이동한 뒤 장애물 센서와 먼지 센서(발밑 밀도)를 읽음
+// 그 뒤 래치된 청소 명령이 켜져 있으면 그 자리의 청소 범위와 먼지를 갱신 (센서는 치우기 전 값)
+bool io_grid_read(SensorData *sensors, RngState *rng) {
+    GridWorld *world = &env_world;
+    const RobotPose *p = &world->pose;
+    (void)rng;
+    env_move(world);
+    int x = p->x >> KIN_FRAC_BITS, y = p->y >> KIN_FRAC_BITS;
+    SensorData dust = (dust_at(&world->dust, x, y) >= ENV_DUST_SENSE) * SENSOR_DUST;
+    world->dust.detections += dust != 0;
+    *sensors = env_sense(world) | dust;
+
+    bool cleaning = world->cleaner == CLEANER_ON || world->cleaner == CLEANER_POWERUP;
+    coverage_update(&world->coverage, &world->map, x, y, cleaning, rvc.tick_time_us);
+    if (cleaning) {
+        dust_clean(&world->dust, &world->map, x, y,
+                   world->cleaner == CLEANER_POWERUP ? ENV_DUST_PICKUP_TURBO : ENV_DUST_PICKUP_NORMAL);
+    }
+    return true;
+}
+
+void io_grid_write(unsigned int changed, const int cmd[ACTUATOR_COUNT]) {
+    if (changed & (1u << ACTUATOR_MOTOR)) {
+        env_world.motor = cmd[ACTUATOR_MOTOR];
+    }
+    if (changed & (1u << ACTUATOR_CLEANER)) {
+        env_world.cleaner = cmd[ACTUATOR_CLEANER];
+    }
+}
+
+void io_grid_close(void) {
+    const GridMap *map = &env_world.map;
+    if (!map->block_offset) {
+        return;
+    }
+    printf("Grid world: %d x %d cells (%d mm), %.1f%% free, robot at (%lld, %lld) mm heading %d deg, "
+           "moved %lld ticks, bumped %lld\n",
+           map->width, map->height, map->cell_mm,
+           100.0 * map->free_cells / ((double)map->width * map->height),
+           (long long)env_world.pose.x * map->cell_mm >> KIN_FRAC_BITS,
+           (long long)env_world.pose.y * map->cell_mm >> KIN_FRAC_BITS,
+           env_world.pose.heading * 45, env_world.moves, env_world.bumps);
+    if (map->mapping) {
+        printf("Map file: %s, %.1f MB mapped\n", env_options.map_path, map->mapping_size / 1048576.0);
+    }
+    coverage_report(&env_world.coverage, map);
+    dust_report(&env_world.dust);
+    io_grid_release();
+}
+
+const IoBackend io_grid = {
+    "grid", io_grid_open, io_grid_read, io_grid_write, io_grid_close
+};
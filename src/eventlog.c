@@ -0,0 +1,349 @@
+/* ========== 이벤트 로그 (lock-free 바이너리 링 버퍼) ========== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "types.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sched.h>
+#endif
+
+// 스레드별 링 크기 (2의 거듭제곱, 레코드 24바이트 → 24 MB)
+// 텍스트 drain은 생산자보다 몇 배 느리므로 (레코드당 fprintf) 링이 수십만 tick의 밀린 레코드를 담아야
+// 생산자가 FSM 경로에서 기다리지 않음. 큰 할당은 mmap이라 실제로 쓴 페이지만 메모리를 차지
+#define LOG_RING_RECORDS (1 << 20)
+#define LOG_MAX_RINGS 256
+#define LOG_FILE_MAGIC "RVC1LOG2"   // 바이너리 로그 파일 머리말 (8바이트, 버전별로 다름, 끝자리는 레코드 형식 개정: 2 = 64비트 순번)
+
+// 함수 선언
+const char *motor_command_name(int cmd);
+const char *cleaner_command_name(int cmd);
+void render_status(const LogRecord *rec, FILE *out);
+
+// 레코드 1개를 오늘과 같은 텍스트로 출력 (drain 스레드와 오프라인 디코더가 공유)
+void evlog_render(const LogRecord *rec, FILE *out) {
+    switch (rec->node) {
+#if RVC_LOG_LEVEL >= RVC_LOG_TRANSITION
+        case LOG_NODE_FSM:
+            fprintf(out, "%s\n", fsm_v1_messages[rec->reason]);
+            break;
+#endif
+        case LOG_NODE_MOTOR:
+            fprintf(out, "  [MOTOR] %s\n", motor_command_name(rec->to));
+            break;
+        case LOG_NODE_CLEANER:
+            fprintf(out, "  [CLEANER] %s\n", cleaner_command_name(rec->to));
+            break;
+        case LOG_NODE_STATUS:
+        case LOG_NODE_SKIP:
+            render_status(rec, out);
+            break;
+        case LOG_NODE_SCHED:
+            fprintf(out, "[SCHED] jitter=%d us, work=%d us\n", rec->value, rec->value2);
+            break;
+        case LOG_NODE_OUTPUT:
+            if (rec->from & (1u << ACTUATOR_MOTOR)) {
+                fprintf(out, "  [MOTOR] %s\n", motor_command_name(rec->to));
+            }
+            if (rec->from & (1u << ACTUATOR_CLEANER)) {
+                fprintf(out, "  [CLEANER] %s\n", cleaner_command_name(rec->reason));
+            }
+            break;
+    }
+}
+
+#ifndef _WIN32
+
+// 스레드 하나가 쓰고(생산자) drain 스레드가 읽는(소비자) 단일 생산자/단일 소비자 링
+// head/tail을 캐시 라인으로 분리하고 생산자는 head 사본을 둬서 공유 라인 읽기를 줄임
+typedef struct {
+    _Alignas(64) atomic_uint head;  // 소비자가 읽은 위치
+    _Alignas(64) atomic_uint tail;  // 생산자가 쓴 위치
+    unsigned int cached_head;       // 생산자가 마지막으로 본 head
+    unsigned int full_waits;        // 링이 가득 차 기다린 횟수
+    LogRecord records[LOG_RING_RECORDS];
+} LogRing;
+
+typedef struct {
+    LogRing *rings[LOG_MAX_RINGS];
+    atomic_int ring_count;
+    atomic_bool stop;
+    unsigned long long next_seq;    // drain 스레드가 다음에 출력할 순번
+    // 다음에 발급할 순번: 생산자마다 fetch_add하는 유일한 공유 쓰기라 캐시 라인을 따로 둠
+    // (drain 스레드가 읽는 ring_count / next_seq와 같은 라인이면 기록마다 라인을 빼앗김)
+    _Alignas(64) atomic_ullong seq;
+    pthread_mutex_t attach_lock;    // 링 등록 (스레드당 한 번)
+    pthread_t drainer;
+    bool running;
+} LogRings;
+
+LogRings evlog_rings = { .attach_lock = PTHREAD_MUTEX_INITIALIZER };
+_Thread_local LogRing *evlog_ring;
+
+#endif
+
+// 출력 대상과 통계
+typedef struct {
+    FILE *out;                  // NULL: stdout
+    bool binary;                // true: 레코드를 그대로 파일에 저장
+    const char *path;
+    unsigned long long written;
+    unsigned long long dropped;
+    unsigned long long full_waits;  // 링이 가득 차 생산자가 기다린 횟수 (모든 링 합계)
+    unsigned long long seq;     // 동기 출력용 순번 (drain 스레드 없을 때)
+    bool muted;                 // true: 기록하지 않음 (상태 공간 탐색 중)
+} EventLog;
+
+EventLog evlog;
+_Thread_local int evlog_tick;   // 이 스레드가 처리 중인 tick
+
+// 레코드 1개를 출력 대상에 기록
+void evlog_write(const LogRecord *rec) {
+    FILE *out = evlog.out ? evlog.out : stdout;
+    if (evlog.binary) {
+        fwrite(rec, sizeof(*rec), 1, out);
+    } else {
+        evlog_render(rec, out);
+    }
+    evlog.written++;
+}
+
+void evlog_set_tick(int tick) {
+    evlog_tick = tick;
+}
+
+#ifndef _WIN32
+
+// 호출 스레드의 링을 만들어 등록 (실패 시 NULL)
+LogRing *evlog_attach(void) {
+    size_t size = (sizeof(LogRing) + 63) / 64 * 64;  // aligned_alloc 크기는 정렬의 배수
+    LogRing *ring = aligned_alloc(64, size);
+    if (!ring) {
+        return NULL;
+    }
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    ring->cached_head = 0;
+    ring->full_waits = 0;
+
+    pthread_mutex_lock(&evlog_rings.attach_lock);
+    int n = atomic_load(&evlog_rings.ring_count);
+    if (n < LOG_MAX_RINGS) {
+        evlog_rings.rings[n] = ring;
+        atomic_store_explicit(&evlog_rings.ring_count, n + 1, memory_order_release);
+    } else {
+        free(ring);
+        ring = NULL;
+    }
+    pthread_mutex_unlock(&evlog_rings.attach_lock);
+    evlog_ring = ring;
+    return ring;
+}
+
+// 모든 링에서 순번 순서대로 출력 가능한 레코드를 출력하고 개수를 반환
+// 링마다 순번이 증가하므로 다음 순번은 항상 어느 링의 맨 앞에 있음
+// (아직 게시 전이면 다음 호출에서 출력)
+int evlog_drain(void) {
+    int count = atomic_load_explicit(&evlog_rings.ring_count, memory_order_acquire);
+    int drained = 0;
+    bool progress = true;
+
+    while (progress) {
+        progress = false;
+        for (int r = 0; r < count; r++) {
+            LogRing *ring = evlog_rings.rings[r];
+            unsigned int head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+            unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+            while (head != tail &&
+                   ring->records[head & (LOG_RING_RECORDS - 1)].seq == evlog_rings.next_seq) {
+                evlog_write(&ring->records[head & (LOG_RING_RECORDS - 1)]);
+                head++;
+                evlog_rings.next_seq++;
+                drained++;
+                progress = true;
+            }
+            atomic_store_explicit(&ring->head, head, memory_order_release);
+        }
+    }
+    return drained;
+}
+
+// drain 스레드: 링을 비우고, 비어 있으면 잠깐 쉼
+// 종료 요청 후에는 발급된 모든 순번을 출력할 때까지 계속
+void *evlog_drain_main(void *arg) {
+    (void)arg;
+    struct timespec nap = {0, 200000};  // 200 us
+
+    for (;;) {
+        if (evlog_drain() > 0) {
+            continue;
+        }
+        if (atomic_load(&evlog_rings.stop) &&
+            evlog_rings.next_seq == atomic_load(&evlog_rings.seq)) {
+            break;
+        }
+        nanosleep(&nap, NULL);
+    }
+    return NULL;
+}
+
+#endif
+
+// 이벤트 로그 시작
+// path == NULL: drain 스레드가 오늘과 같은 텍스트를 stdout에 출력
+// path != NULL: 바이너리 레코드를 파일에 저장 (--decode로 텍스트 변환)
+bool evlog_start(const char *path) {
+    if (path) {
+        evlog.out = fopen(path, "wb");
+        if (!evlog.out) {
+            perror(path);
+            return false;
+        }
+        fwrite(LOG_FILE_MAGIC, 1, 8, evlog.out);
+        evlog.binary = true;
+        evlog.path = path;
+    }
+#if !defined(_WIN32) && RVC_LOG_LEVEL > RVC_LOG_NONE
+    // 로그 없는 빌드는 기록하는 곳이 없으므로 drain 스레드도 만들지 않음
+    atomic_store(&evlog_rings.stop, false);
+    evlog_rings.running =
+        pthread_create(&evlog_rings.drainer, NULL, evlog_drain_main, NULL) == 0;
+#endif
+    return true;
+}
+
+// 이벤트 기록 (제어 경로에서 호출, printf 대신)
+// 링에 고정 크기 레코드를 복사하고 tail을 게시하는 것이 전부 (잠금/포맷 없음)
+void evlog_emit(int node, int from, int to, int reason, int value, int value2) {
+    LogRecord rec;
+    if (evlog.muted) {
+        return;
+    }
+    rec.tick = evlog_tick;
+    rec.value = value;
+    rec.value2 = value2;
+    rec.node = (unsigned char)node;
+    rec.from = (unsigned char)from;
+    rec.to = (unsigned char)to;
+    rec.reason = (unsigned char)reason;
+
+#ifndef _WIN32
+    if (evlog_rings.running) {
+        LogRing *ring = evlog_ring ? evlog_ring : evlog_attach();
+        if (!ring) {
+            evlog.dropped++;  // 링 할당 실패: 순번을 받기 전에 버림
+            return;
+        }
+        rec.seq = atomic_fetch_add_explicit(&evlog_rings.seq, 1, memory_order_relaxed);
+
+        unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        while (tail - ring->cached_head >= LOG_RING_RECORDS) {
+            // 링이 가득 참: 레코드를 버리면 순번이 끊기므로 drain 스레드를 기다림
+            ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+            if (tail - ring->cached_head >= LOG_RING_RECORDS) {
+                ring->full_waits++;
+                sched_yield();
+            }
+        }
+        ring->records[tail & (LOG_RING_RECORDS - 1)] = rec;
+        atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+        return;
+    }
+#endif
+
+    // drain 스레드 없음 (_WIN32 또는 생성 실패): 바로 출력
+    rec.seq = evlog.seq++;
+    evlog_write(&rec);
+}
+
+// 기록 중지/재개 (--explore는 같은 FSM 함수를 수많은 구성에 실행하므로 전이 메시지를 끔)
+void evlog_mute(bool muted) {
+    evlog.muted = muted;
+}
+
+// 이벤트 로그 종료: 남은 레코드를 모두 출력하고 drain 스레드와 링 정리
+void evlog_stop(void) {
+#ifndef _WIN32
+    if (evlog_rings.running) {
+        atomic_store(&evlog_rings.stop, true);
+        pthread_join(evlog_rings.drainer, NULL);
+        evlog_rings.running = false;
+
+        int count = atomic_load(&evlog_rings.ring_count);
+        for (int r = 0; r < count; r++) {
+            evlog.full_waits += evlog_rings.rings[r]->full_waits;
+            free(evlog_rings.rings[r]);
+        }
+        atomic_store(&evlog_rings.ring_count, 0);
+        evlog_ring = NULL;
+    }
+#endif
+    fflush(stdout);
+    if (evlog.binary) {
+        fclose(evlog.out);
+        evlog.out = NULL;
+        evlog.binary = false;
+        printf("Event log: %llu records -> %s\n", evlog.written, evlog.path);
+    }
+    if (evlog.full_waits > 0) {
+        // drain 스레드가 링 하나 분량 이상 밀림: 그동안 생산자가 기다림 (레코드는 버리지 않음)
+        printf("Event log: ring full %llu times (producer waited for the drain thread)\n",
+               evlog.full_waits);
+    }
+    if (evlog.dropped > 0) {
+        fprintf(stderr, "Event log: %llu records dropped\n", evlog.dropped);
+    }
+}
+
+int evlog_compare_seq(const void *a, const void *b) {
+    unsigned long long x = ((const LogRecord *)a)->seq;
+    unsigned long long y = ((const LogRecord *)b)->seq;
+    return (x > y) - (x < y);
+}
+
+// 오프라인 디코더: 바이너리 로그를 순번 순서로 정렬하여 텍스트로 출력
+int evlog_decode(const char *path) {
+    char magic[8];
+    FILE *in = fopen(path, "rb");
+    if (!in) {
+        perror(path);
+        return 1;
+    }
+    if (fread(magic, 1, 8, in) != 8 || memcmp(magic, LOG_FILE_MAGIC, 8) != 0) {
+        fprintf(stderr, "%s: not a " LOG_FILE_MAGIC " event log\n", path);
+        fclose(in);
+        return 1;
+    }
+
+    size_t capacity = 4096, count = 0;
+    LogRecord *records = malloc(capacity * sizeof(LogRecord));
+    while (records && fread(&records[count], sizeof(LogRecord), 1, in) == 1) {
+        if (++count == capacity) {
+            LogRecord *grown = realloc(records, capacity * 2 * sizeof(LogRecord));
+            if (!grown) {
+                free(records);
+                records = NULL;
+                break;
+            }
+            records = grown;
+            capacity *= 2;
+        }
+    }
+    fclose(in);
+    if (!records) {
+        fprintf(stderr, "%s: out of memory\n", path);
+        return 1;
+    }
+
+    qsort(records, count, sizeof(LogRecord), evlog_compare_seq);
+    for (size_t i = 0; i < count; i++) {
+        evlog_render(&records[i], stdout);
+    }
+    free(records);
+    return 0;
+}
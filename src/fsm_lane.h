@@ -0,0 +1,85 @@
+/* ========== FSM 전이 함수 (fleet SoA 커널용) ========== */
+
+// 주의: 이 파일은 fsm/fsm_spec.h에서 fsm_gen으로 자동 생성한 것입니다.
+//       전이 규칙은 fsm/fsm_spec.h에서 수정하세요.
+// fsm_table.c와 같은 규칙을 분기 없는 식으로 펼친 것 (fleet.c에서 include)
+
+// fsm_v1_table과 같은 전이를 로봇 1대분 식으로 계산 (fleet_step 루프 본문에 인라인)
+// duration: 이번 tick을 포함한 상태 지속 tick 수, motor/cleaner: 이전 명령
+static inline FsmLane fsm_v1_lane(int state, int word, int duration, int motor, int cleaner) {
+    int one = 1 << state;
+    FsmLane r;
+    r.motor =
+        (-(one >> STATE_MOVING & 1) & MOTOR_FORWARD) +
+        (-(one >> STATE_TURNING & 1) & motor) +
+        (-(one >> STATE_BACKWARDING & 1) & MOTOR_BACKWARD) +
+        (-(one >> STATE_DUST_CLEANING & 1) & MOTOR_STOP) +
+        (-(one >> STATE_PAUSE & 1) & MOTOR_STOP);
+    r.cleaner =
+        (-(one >> STATE_MOVING & 1) & CLEANER_ON) +
+        (-(one >> STATE_TURNING & 1) & CLEANER_ON) +
+        (-(one >> STATE_BACKWARDING & 1) & CLEANER_ON) +
+        (-(one >> STATE_DUST_CLEANING & 1) & CLEANER_POWERUP) +
+        (-(one >> STATE_PAUSE & 1) & CLEANER_ON);
+    (void)cleaner;
+    int limit = 0
+        + (-(one >> STATE_TURNING & 1) & 2)
+        + (-(one >> STATE_BACKWARDING & 1) & 3)
+        + (-(one >> STATE_DUST_CLEANING & 1) & 5)
+        + (-(one >> STATE_PAUSE & 1) & 3);
+    int in = word | (duration >= limit) << 5;    // IN_T: 상태 타이머 만료
+    int open, hit;
+    r.next = state;
+    r.reload = 0;
+    open = one >> STATE_MOVING & 1;
+    // -> STATE_DUST_CLEANING
+    hit = -(open & ((in & 0x08) == 0x08));
+    open &= ~hit;
+    r.next += hit & (STATE_DUST_CLEANING - STATE_MOVING);
+    r.reload += hit & 5;
+    // -> STATE_TURNING
+    hit = -(open & ((in & 0x01) == 0x01));
+    r.next += hit & (STATE_TURNING - STATE_MOVING);
+    open = one >> STATE_TURNING & 1;
+    // -> STATE_BACKWARDING
+    hit = -(open & ((in & 0x07) == 0x07));
+    open &= ~hit;
+    r.next += hit & (STATE_BACKWARDING - STATE_TURNING);
+    r.reload += hit & 3;
+    // -> STATE_MOVING
+    hit = -(open & ((in & 0x22) == 0x20));
+    open &= ~hit;
+    r.next += hit & (STATE_MOVING - STATE_TURNING);
+    r.motor += hit & (MOTOR_TURN_LEFT - motor);
+    // -> STATE_TURNING
+    hit = -(open & ((in & 0x02) == 0x00));
+    open &= ~hit;
+    r.motor += hit & (MOTOR_TURN_LEFT - motor);
+    // -> STATE_MOVING
+    hit = -(open & ((in & 0x24) == 0x20));
+    open &= ~hit;
+    r.next += hit & (STATE_MOVING - STATE_TURNING);
+    r.motor += hit & (MOTOR_TURN_RIGHT - motor);
+    // -> STATE_TURNING
+    hit = -(open & ((in & 0x04) == 0x00));
+    open &= ~hit;
+    r.motor += hit & (MOTOR_TURN_RIGHT - motor);
+    // -> STATE_PAUSE
+    hit = -open;
+    r.next += hit & (STATE_PAUSE - STATE_TURNING);
+    open = one >> STATE_BACKWARDING & 1;
+    // -> STATE_TURNING
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (STATE_TURNING - STATE_BACKWARDING);
+    open = one >> STATE_DUST_CLEANING & 1;
+    // -> STATE_MOVING
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (STATE_MOVING - STATE_DUST_CLEANING);
+    open = one >> STATE_PAUSE & 1;
+    // -> STATE_BACKWARDING
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (STATE_BACKWARDING - STATE_PAUSE);
+    r.reload += hit & 3;
+    return r;
+}
+
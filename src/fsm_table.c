@@ -0,0 +1,128 @@
+/* ========== FSM 전이 테이블 ========== */
+
+// 주의: 이 파일은 fsm/fsm_spec.h에서 fsm_gen으로 자동 생성한 것입니다.
+//       전이 규칙은 fsm/fsm_spec.h에서 수정하세요.
+// 입력 워드 비트: 0=Front, 1=Left, 2=Right, 3=Dust
+
+#include <stdio.h>
+#include "types.h"
+
+// fsm_v1: 상태별 타이머 한계 (해당 상태 N tick째에 만료, 0: 없음)
+const unsigned char fsm_v1_timer_limit[5] = {
+    0,  // STATE_MOVING
+    2,  // STATE_TURNING
+    3,  // STATE_BACKWARDING
+    5,  // STATE_DUST_CLEANING
+    3,  // STATE_PAUSE
+};
+
+#if RVC_LOG_LEVEL >= RVC_LOG_TRANSITION
+const char *const fsm_v1_messages[11] = {
+    NULL,
+    "[FSM] MOVING -> DUST_CLEANING (dust detected)",
+    "[FSM] MOVING -> TURNING (front obstacle)",
+    "[FSM] TURNING -> BACKWARDING (all blocked)",
+    "[FSM] Turning LEFT (priority)",
+    "[FSM] TURNING -> MOVING (turn complete)",
+    "[FSM] Turning RIGHT",
+    "[FSM] TURNING -> PAUSE (no turn available)",
+    "[FSM] BACKWARDING -> TURNING (escape)",
+    "[FSM] DUST_CLEANING -> MOVING (clean complete)",
+    "[FSM] PAUSE -> BACKWARDING (deadlock escape)",
+};
+#endif
+
+// [상태][입력 워드][타이머 만료] → {다음 상태, 모터, 청소기, 타이머, 메시지}
+const FsmEntry fsm_v1_table[5][16][2] = {
+    {   // STATE_MOVING
+        {{STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}, {STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}},  // 0x00
+        {{STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}, {STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}},  // 0x01
+        {{STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}, {STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}},  // 0x02
+        {{STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}, {STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}},  // 0x03
+        {{STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}, {STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}},  // 0x04
+        {{STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}, {STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}},  // 0x05
+        {{STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}, {STATE_MOVING, MOTOR_FORWARD, CLEANER_ON, 0, {0, 0}}},  // 0x06
+        {{STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}, {STATE_TURNING, MOTOR_FORWARD, CLEANER_ON, 0, {2, 0}}},  // 0x07
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x08
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x09
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0a
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0b
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0c
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0d
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0e
+        {{STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}, {STATE_DUST_CLEANING, MOTOR_FORWARD, CLEANER_ON, 5, {1, 0}}},  // 0x0f
+    },
+    {   // STATE_TURNING
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x00
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x01
+        {{STATE_TURNING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 0}}, {STATE_MOVING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 5}}},  // 0x02
+        {{STATE_TURNING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 0}}, {STATE_MOVING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 5}}},  // 0x03
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x04
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x05
+        {{STATE_PAUSE, FSM_KEEP, CLEANER_ON, 0, {7, 0}}, {STATE_PAUSE, FSM_KEEP, CLEANER_ON, 0, {7, 0}}},  // 0x06
+        {{STATE_BACKWARDING, FSM_KEEP, CLEANER_ON, 3, {3, 0}}, {STATE_BACKWARDING, FSM_KEEP, CLEANER_ON, 3, {3, 0}}},  // 0x07
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x08
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x09
+        {{STATE_TURNING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 0}}, {STATE_MOVING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 5}}},  // 0x0a
+        {{STATE_TURNING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 0}}, {STATE_MOVING, MOTOR_TURN_RIGHT, CLEANER_ON, 0, {6, 5}}},  // 0x0b
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x0c
+        {{STATE_TURNING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 0}}, {STATE_MOVING, MOTOR_TURN_LEFT, CLEANER_ON, 0, {4, 5}}},  // 0x0d
+        {{STATE_PAUSE, FSM_KEEP, CLEANER_ON, 0, {7, 0}}, {STATE_PAUSE, FSM_KEEP, CLEANER_ON, 0, {7, 0}}},  // 0x0e
+        {{STATE_BACKWARDING, FSM_KEEP, CLEANER_ON, 3, {3, 0}}, {STATE_BACKWARDING, FSM_KEEP, CLEANER_ON, 3, {3, 0}}},  // 0x0f
+    },
+    {   // STATE_BACKWARDING
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x00
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x01
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x02
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x03
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x04
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x05
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x06
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x07
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x08
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x09
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0a
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0b
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0c
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0d
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0e
+        {{STATE_BACKWARDING, MOTOR_BACKWARD, CLEANER_ON, 0, {0, 0}}, {STATE_TURNING, MOTOR_BACKWARD, CLEANER_ON, 0, {8, 0}}},  // 0x0f
+    },
+    {   // STATE_DUST_CLEANING
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x00
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x01
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x02
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x03
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x04
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x05
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x06
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x07
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x08
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x09
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0a
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0b
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0c
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0d
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0e
+        {{STATE_DUST_CLEANING, MOTOR_STOP, CLEANER_POWERUP, 0, {0, 0}}, {STATE_MOVING, MOTOR_STOP, CLEANER_POWERUP, 0, {9, 0}}},  // 0x0f
+    },
+    {   // STATE_PAUSE
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x00
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x01
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x02
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x03
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x04
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x05
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x06
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x07
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x08
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x09
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0a
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0b
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0c
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0d
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0e
+        {{STATE_PAUSE, MOTOR_STOP, CLEANER_ON, 0, {0, 0}}, {STATE_BACKWARDING, MOTOR_STOP, CLEANER_ON, 3, {10, 0}}},  // 0x0f
+    },
+};
+
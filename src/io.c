@@ -0,0 +1,279 @@
+/* ========== I/O 백엔드 (센서 입력 / 액추에이터 출력의 하드웨어 경계) ========== */
+
+#include <stdio.h>
+#include <string.h>
+#include "types.h"
+
+#ifndef _WIN32
+#include <stdatomic.h>
+#include <sched.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif
+
+#define IO_RING_SLOTS 256       // 링 크기 (2의 거듭제곱, 시뮬레이터는 최대 이만큼 앞서 센서 프레임을 채움)
+#define IO_CHECK_SPINS 1024     // 링에서 기다리는 동안 상대 프로세스가 살아 있는지 확인하는 간격 (양보 횟수)
+
+// 함수 선언
+void sensor_interface(SensorData *sensors, RngState *rng);
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+
+// ---------- local: 프로세스 안의 센서 모델 (기본) ----------
+
+bool io_local_open(unsigned long long seed) {
+    (void)seed;
+    return true;
+}
+
+bool io_local_read(SensorData *sensors, RngState *rng) {
+    sensor_interface(sensors, rng);
+    return true;
+}
+
+void io_local_write(unsigned int changed, const int cmd[ACTUATOR_COUNT]) {
+    (void)changed;
+    (void)cmd;
+}
+
+void io_local_close(void) {
+}
+
+const IoBackend io_local = {
+    "local", io_local_open, io_local_read, io_local_write, io_local_close
+};
+
+#ifndef _WIN32
+
+// ---------- shm: POSIX 공유 메모리 링 + 하드웨어 시뮬레이터 프로세스 ----------
+
+// 액추에이터 명령 1건 (actuator_write의 일괄 쓰기 1회)
+typedef struct {
+    unsigned int changed;       // 바뀐 액추에이터 비트
+    int cmd[ACTUATOR_COUNT];
+} IoCommand;
+
+// 제어기와 시뮬레이터가 함께 매핑하는 영역
+// 링마다 생산자 하나/소비자 하나, head/tail을 캐시 라인으로 분리 → 빠른 경로는 원자적 load/store뿐
+typedef struct {
+    _Alignas(64) atomic_uint sensor_head;   // 제어기가 읽은 센서 프레임 수
+    _Alignas(64) atomic_uint sensor_tail;   // 시뮬레이터가 쓴 센서 프레임 수
+    _Alignas(64) atomic_uint cmd_head;      // 시뮬레이터가 적용한 명령 수
+    _Alignas(64) atomic_uint cmd_tail;      // 제어기가 쓴 명령 수
+    _Alignas(64) atomic_bool stop;          // 제어기 → 시뮬레이터: 남은 명령 적용 후 종료
+    int motor;                  // 시뮬레이터의 액추에이터 레지스터 (마지막 적용 명령)
+    int cleaner;
+    unsigned int idle_waits;    // 시뮬레이터: 센서 링이 가득 차고 새 명령이 없어 쉰 횟수
+    SensorData sensors[IO_RING_SLOTS];
+    IoCommand cmds[IO_RING_SLOTS];
+} IoShared;
+
+typedef struct {
+    IoShared *shared;
+    pid_t simulator;
+    bool lost;                  // 시뮬레이터가 먼저 종료됨 (이미 회수, 이후 읽기/쓰기는 실패)
+    unsigned int sensor_waits;  // 제어기: 센서 프레임이 아직 없어 기다린 횟수
+    unsigned int cmd_waits;     // 제어기: 명령 링이 가득 차 기다린 횟수
+} IoShm;
+
+IoShm io_shm;
+
+// 하드웨어 시뮬레이터 (fork한 자식 프로세스)
+// 센서: local 백엔드와 같은 스트림(시드, 스트림 0)으로 프레임을 만들어 링을 채움 → 같은 trace
+// 액추에이터: 명령을 레지스터에 적용
+// 제어기가 stop 없이 죽으면 (부모가 바뀜) 기다리지 않고 종료
+void io_simulator_main(IoShared *sh, unsigned long long seed, pid_t parent) {
+    RngState rng;
+    rng_seed(&rng, seed, 0);
+    unsigned int tail = 0, head = 0;
+    int idle_spins = 0;
+
+    for (;;) {
+        bool idle = true;
+        // 센서 링: 빈 칸이 있으면 다음 프레임
+        if (tail - atomic_load_explicit(&sh->sensor_head, memory_order_acquire) < IO_RING_SLOTS) {
+            sensor_interface(&sh->sensors[tail & (IO_RING_SLOTS - 1)], &rng);
+            atomic_store_explicit(&sh->sensor_tail, ++tail, memory_order_release);
+            idle = false;
+        }
+        // 명령 링: 도착한 명령 적용
+        while (head != atomic_load_explicit(&sh->cmd_tail, memory_order_acquire)) {
+            const IoCommand *c = &sh->cmds[head & (IO_RING_SLOTS - 1)];
+            if (c->changed & (1u << ACTUATOR_MOTOR)) {
+                sh->motor = c->cmd[ACTUATOR_MOTOR];
+            }
+            if (c->changed & (1u << ACTUATOR_CLEANER)) {
+                sh->cleaner = c->cmd[ACTUATOR_CLEANER];
+            }
+            atomic_store_explicit(&sh->cmd_head, ++head, memory_order_release);
+            idle = false;
+        }
+        if (idle) {
+            // stop은 명령 링을 모두 비운 뒤에만 확인 (제어기가 마지막 명령을 쓴 뒤 stop을 세움)
+            if (atomic_load_explicit(&sh->stop, memory_order_acquire) &&
+                head == atomic_load_explicit(&sh->cmd_tail, memory_order_acquire)) {
+                break;
+            }
+            sh->idle_waits++;
+            // 잠깐은 양보만 하고, 오래 쉬면 잠듦 (실시간 모드에서 주기 내내 CPU를 쓰지 않게)
+            if (++idle_spins < 1000) {
+                sched_yield();
+            } else {
+                if (getppid() != parent) {
+                    break;
+                }
+                usleep(50);
+            }
+        } else {
+            idle_spins = 0;
+        }
+    }
+}
+
+// 공유 메모리를 만들고 시뮬레이터 프로세스 시작
+// 이름은 fork 직후 지움: 두 프로세스는 매핑으로 계속 공유하고, 비정상 종료해도 /dev/shm에 남지 않음
+bool io_shm_open(unsigned long long seed) {
+    char name[64];
+    snprintf(name, sizeof(name), "/rvc-io-%d", (int)getpid());
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        perror("shm_open");
+        return false;
+    }
+    if (ftruncate(fd, sizeof(IoShared)) != 0) {
+        perror("ftruncate");
+        close(fd);
+        shm_unlink(name);
+        return false;
+    }
+    IoShared *sh = mmap(NULL, sizeof(IoShared), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (sh == MAP_FAILED) {
+        perror("mmap");
+        shm_unlink(name);
+        return false;
+    }
+    memset(sh, 0, sizeof(*sh));     // ftruncate로 0이지만 원자 변수는 명시적으로 초기화
+    atomic_init(&sh->sensor_head, 0);
+    atomic_init(&sh->sensor_tail, 0);
+    atomic_init(&sh->cmd_head, 0);
+    atomic_init(&sh->cmd_tail, 0);
+    atomic_init(&sh->stop, false);
+
+    fflush(NULL);   // 자식이 부모의 출력 버퍼를 물려받지 않도록
+    pid_t parent = getpid();
+    pid_t pid = fork();
+    if (pid == 0) {
+        io_simulator_main(sh, seed, parent);
+        _exit(0);
+    }
+    shm_unlink(name);
+    if (pid < 0) {
+        perror("fork");
+        munmap(sh, sizeof(IoShared));
+        return false;
+    }
+    io_shm.shared = sh;
+    io_shm.simulator = pid;
+    io_shm.lost = false;
+    return true;
+}
+
+// 링에서 IO_CHECK_SPINS번 양보할 때마다 호출: 시뮬레이터가 이미 종료했으면 회수하고 false
+// (죽은 시뮬레이터는 링을 다시 움직이지 않으므로 계속 기다리면 제어기가 멈춤)
+bool io_shm_alive(void) {
+    if (!io_shm.lost && waitpid(io_shm.simulator, NULL, WNOHANG) != 0) {
+        fprintf(stderr, "I/O backend: shm simulator (pid %d) exited; stopping\n",
+                (int)io_shm.simulator);
+        io_shm.lost = true;
+    }
+    return !io_shm.lost;
+}
+
+// 센서 프레임 읽기: 링 칸에서 바로 읽음 (복사 없음, 시스템 호출 없음)
+// 프레임이 아직 없을 때만 양보하며 기다림, 시뮬레이터가 종료했으면 false
+bool io_shm_read(SensorData *sensors, RngState *rng) {
+    IoShared *sh = io_shm.shared;
+    unsigned int head = atomic_load_explicit(&sh->sensor_head, memory_order_relaxed);
+    unsigned int spins = 0;
+    (void)rng;
+    while (atomic_load_explicit(&sh->sensor_tail, memory_order_acquire) == head) {
+        if (io_shm.lost || (++spins % IO_CHECK_SPINS == 0 && !io_shm_alive())) {
+            return false;
+        }
+        io_shm.sensor_waits++;
+        sched_yield();
+    }
+    *sensors = sh->sensors[head & (IO_RING_SLOTS - 1)];
+    atomic_store_explicit(&sh->sensor_head, head + 1, memory_order_release);
+    return true;
+}
+
+// 명령 게시: 링 칸에 쓰고 tail 갱신 (시스템 호출 없음)
+// 시뮬레이터가 종료했으면 버림 (다음 센서 읽기가 실패해 제어 루프가 멈춤)
+void io_shm_write(unsigned int changed, const int cmd[ACTUATOR_COUNT]) {
+    IoShared *sh = io_shm.shared;
+    unsigned int tail = atomic_load_explicit(&sh->cmd_tail, memory_order_relaxed);
+    unsigned int spins = 0;
+    while (tail - atomic_load_explicit(&sh->cmd_head, memory_order_acquire) >= IO_RING_SLOTS) {
+        if (io_shm.lost || (++spins % IO_CHECK_SPINS == 0 && !io_shm_alive())) {
+            return;
+        }
+        io_shm.cmd_waits++;
+        sched_yield();
+    }
+    IoCommand *c = &sh->cmds[tail & (IO_RING_SLOTS - 1)];
+    c->changed = changed;
+    for (int a = 0; a < ACTUATOR_COUNT; a++) {
+        c->cmd[a] = cmd[a];
+    }
+    atomic_store_explicit(&sh->cmd_tail, tail + 1, memory_order_release);
+}
+
+// 시뮬레이터 종료 대기 후 통계 출력, 공유 메모리 해제
+void io_shm_close(void) {
+    IoShared *sh = io_shm.shared;
+    if (!sh) {
+        return;
+    }
+    atomic_store_explicit(&sh->stop, true, memory_order_release);
+    if (!io_shm.lost) {
+        waitpid(io_shm.simulator, NULL, 0);
+    }
+    printf("I/O backend: shm, %u sensor frames read, %u commands applied "
+           "(motor=%d, cleaner=%d), controller waits: sensor %u, command %u, simulator idle %u\n",
+           atomic_load(&sh->sensor_head), atomic_load(&sh->cmd_head),
+           sh->motor, sh->cleaner, io_shm.sensor_waits, io_shm.cmd_waits, sh->idle_waits);
+    munmap(sh, sizeof(IoShared));
+    io_shm.shared = NULL;
+}
+
+const IoBackend io_shm_backend = {
+    "shm", io_shm_open, io_shm_read, io_shm_write, io_shm_close
+};
+
+#endif
+
+// 현재 백엔드 (main의 --io로 선택, 벤치마크 등 그 외에는 local)
+const IoBackend *io_backend = &io_local;
+
+// 이름으로 백엔드 선택, 없는 이름이면 false
+bool io_select(const char *name) {
+    if (strcmp(name, io_local.name) == 0) {
+        io_backend = &io_local;
+        return true;
+    }
+    if (strcmp(name, io_grid.name) == 0) {
+        io_backend = &io_grid;
+        return true;
+    }
+#ifndef _WIN32
+    if (strcmp(name, io_shm_backend.name) == 0) {
+        io_backend = &io_shm_backend;
+        return true;
+    }
+#endif
+    fprintf(stderr, "Unknown I/O backend: %s\n", name);
+    return false;
+}
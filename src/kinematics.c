@@ -0,0 +1,73 @@
+/* ========== 운동학 (모터 명령 → 자세, 고정소수점) ========== */
+/*
+ * 자세는 Q8 (1/256 단위) 정수, 방향은 45° 단위 8방향 (SRS PDF p.3 FR-3.2 "45° 회전")
+ * 방향별 이동량은 Q15 cos/sin 표로 kin_init에서 한 번만 계산하고, 매 tick 갱신은 덧셈뿐
+ * 부동소수점을 쓰지 않으므로 컴파일러/플랫폼과 무관하게 같은 궤적
+ */
+
+#include "types.h"
+
+#define KIN_Q15 15
+
+// 방향별 cos/sin (Q15, 0: +x, 1씩 시계 방향, y는 아래로 증가), 23170 = round(2^15 / √2)
+const int kin_cos[ENV_HEADINGS] = {32768, 23170, 0, -23170, -32768, -23170, 0, 23170};
+const int kin_sin[ENV_HEADINGS] = {0, 23170, 32768, 23170, 0, -23170, -32768, -23170};
+
+// d × c (Q15) 반올림, 부호와 크기를 나눠 계산 → 반대 방향 이동량이 정확히 부호만 다름
+int kin_scale(long long d, int c) {
+    int len = (int)((d * (c < 0 ? -c : c) + (1 << (KIN_Q15 - 1))) >> KIN_Q15);
+    return c < 0 ? -len : len;
+}
+
+// 모델 준비: tick당 step_mm 이동, 자세 단위는 unit_mm의 1/256
+void kin_init(KinModel *kin, int step_mm, int unit_mm) {
+    long long d = ((long long)step_mm << KIN_FRAC_BITS) / unit_mm;
+    for (int h = 0; h < ENV_HEADINGS; h++) {
+        kin->step[h][0] = kin_scale(d, kin_cos[h]);
+        kin->step[h][1] = kin_scale(d, kin_sin[h]);
+    }
+    kin->unit_mm = unit_mm;
+}
+
+// 모터 명령 1 tick 적용 (충돌 검사 없음): 전진/후진은 이동량 ±, 회전은 45°, 정지는 그대로
+RobotPose kin_next(const KinModel *kin, RobotPose p, int motor) {
+    switch (motor) {
+        case MOTOR_FORWARD:
+            p.x += kin->step[p.heading][0];
+            p.y += kin->step[p.heading][1];
+            break;
+        case MOTOR_BACKWARD:
+            p.x -= kin->step[p.heading][0];
+            p.y -= kin->step[p.heading][1];
+            break;
+        case MOTOR_TURN_LEFT:  p.heading = (p.heading + 7) & 7; break;
+        case MOTOR_TURN_RIGHT: p.heading = (p.heading + 1) & 7; break;
+        default:             break;
+    }
+    return p;
+}
+
+// [begin, end) 구간 로봇들에 이번 tick 모터 명령 적용 (kin_next와 같은 결과)
+// 방향 부호는 비교 연산으로, 길이는 직선/대각선 두 값의 선택으로 구해 표 조회(gather) 없이 벡터화
+void kin_fleet_step(RVCFleet *fleet, int begin, int end) {
+    const unsigned char *command = fleet->motor_cmd;
+    unsigned int *pose_x = fleet->pose_x;
+    unsigned int *pose_y = fleet->pose_y;
+    unsigned char *heading = fleet->heading;
+    int straight = fleet->kin.step[0][0];
+    int diagonal = fleet->kin.step[1][0];
+
+    #pragma GCC ivdep
+    for (int i = begin; i < end; i++) {
+        int c = command[i];
+        int h = heading[i];
+        int move = (c == MOTOR_FORWARD) - (c == MOTOR_BACKWARD);
+        int turn = (c == MOTOR_TURN_RIGHT) - (c == MOTOR_TURN_LEFT);
+        int dir_x = (((h + 1) & 7) < 3) - (((h + 5) & 7) < 3);
+        int dir_y = (((h + 7) & 7) < 3) - (((h + 3) & 7) < 3);
+        int len = straight + (h & 1) * (diagonal - straight);
+        pose_x[i] += (unsigned int)(move * dir_x * len);
+        pose_y[i] += (unsigned int)(move * dir_y * len);
+        heading[i] = (unsigned char)((h + turn) & 7);
+    }
+}
@@ -0,0 +1,246 @@
+/* ========== Fleet 스레드 풀 (work-stealing) ========== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "types.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#endif
+
+#define POOL_CHUNK_ROBOTS 4096  // 한 번에 가져가는 로봇 수 (벡터 폭의 배수)
+#define POOL_MAX_THREADS 256
+
+// 함수 선언
+void fleet_sense(RVCFleet *fleet, int begin, int end);
+void fleet_step(RVCFleet *fleet, int begin, int end);
+void kin_fleet_step(RVCFleet *fleet, int begin, int end);
+void swarm_sense(RVCFleet *fleet, int begin, int end);
+void swarm_move(RVCFleet *fleet, int begin, int end);
+void swarm_update(RVCFleet *fleet, long long time_us);
+long long monotonic_us(void);
+long long clock_advance(VirtualClock *clk, int tick);
+void clock_tick_done(VirtualClock *clk);
+
+// 사용 가능한 코어 수
+int pool_cpu_count(void) {
+#ifndef _WIN32
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#else
+    return 1;
+#endif
+}
+
+// chunk 하나 처리: 센서 → FSM → 운동학
+// 로봇별 상태와 난수가 서로 독립이라 어느 스레드가 처리해도 결과가 같음
+// 공유 격자 세계에서는 다른 로봇을 tick 시작 위치(공간 해시 스냅숏)로만 보므로 마찬가지
+void pool_run_chunk(RVCFleet *fleet, int chunk) {
+    int begin = chunk * POOL_CHUNK_ROBOTS;
+    int end = begin + POOL_CHUNK_ROBOTS;
+    if (end > fleet->count) {
+        end = fleet->count;
+    }
+    if (swarm_world.enabled) {
+        swarm_sense(fleet, begin, end);
+        fleet_step(fleet, begin, end);
+        swarm_move(fleet, begin, end);
+        return;
+    }
+    fleet_sense(fleet, begin, end);
+    fleet_step(fleet, begin, end);
+    kin_fleet_step(fleet, begin, end);
+}
+
+#ifndef _WIN32
+
+// 워커별 chunk 구간 [chunk_begin, chunk_end)
+// next_chunk는 소유자와 훔치는 쪽이 함께 fetch_add 하므로 같은 chunk를 두 번 처리하지 않음
+// 워커마다 캐시 라인을 따로 써서 false sharing 방지
+typedef struct {
+    _Alignas(64) atomic_int next_chunk;
+    int chunk_begin;
+    int chunk_end;
+    int stolen;
+} PoolWorker;
+
+typedef struct {
+    RVCFleet *fleet;
+    VirtualClock *clk;
+    int ticks;
+    int threads;
+    PoolWorker *workers;
+    pthread_barrier_t barrier;
+    pthread_mutex_t gate_lock;  // 워커는 시작 신호까지 대기 → 생성된 워커 수로 barrier를 만든 뒤 출발
+    pthread_cond_t gate;
+    bool open;
+    long long step_us;
+} FleetPool;
+
+typedef struct {
+    FleetPool *pool;
+    int id;
+} PoolThreadArg;
+
+// 워커 루프: tick마다 barrier로 시작/끝을 맞춰 tick 간 순서를 결정적으로 유지
+void pool_worker_loop(FleetPool *pool, int id) {
+    PoolWorker *self = &pool->workers[id];
+    long long t0 = 0;
+    int chunk;
+
+    for (int t = 0; t < pool->ticks; t++) {
+        if (id == 0) {
+            clock_advance(pool->clk, t);
+            t0 = monotonic_us();
+        }
+        pthread_barrier_wait(&pool->barrier);  // tick 시작
+
+        // 1. 자기 구간을 앞에서부터 소비
+        while ((chunk = atomic_fetch_add(&self->next_chunk, 1)) < self->chunk_end) {
+            pool_run_chunk(pool->fleet, chunk);
+        }
+        // 2. 다 끝나면 다른 워커의 남은 chunk를 훔침
+        for (int k = 1; k < pool->threads; k++) {
+            PoolWorker *victim = &pool->workers[(id + k) % pool->threads];
+            while ((chunk = atomic_fetch_add(&victim->next_chunk, 1)) < victim->chunk_end) {
+                pool_run_chunk(pool->fleet, chunk);
+                self->stolen++;
+            }
+        }
+
+        pthread_barrier_wait(&pool->barrier);  // tick 끝: 모든 로봇 처리 완료
+        // 다음 tick 시작 barrier 전이므로 아무도 이 구간을 훔치지 않음
+        atomic_store(&self->next_chunk, self->chunk_begin);
+
+        if (id == 0) {
+            if (swarm_world.enabled) {
+                swarm_update(pool->fleet, pool->clk->now_us);   // 다른 워커는 다음 tick 시작 barrier에서 기다림
+            }
+            pool->fleet->ticks++;           // 다음 tick 시작 barrier 뒤에 워커가 읽음
+            pool->step_us += monotonic_us() - t0;
+            clock_tick_done(pool->clk);
+        }
+    }
+}
+
+void *pool_thread_main(void *arg) {
+    PoolThreadArg *a = arg;
+    FleetPool *pool = a->pool;
+    pthread_mutex_lock(&pool->gate_lock);
+    while (!pool->open) {
+        pthread_cond_wait(&pool->gate, &pool->gate_lock);
+    }
+    pthread_mutex_unlock(&pool->gate_lock);
+    pool_worker_loop(pool, a->id);
+    return NULL;
+}
+
+// chunk를 워커 수로 균등 분할 (초기 소유 구간)
+void pool_split(FleetPool *pool, int chunks) {
+    for (int w = 0; w < pool->threads; w++) {
+        pool->workers[w].chunk_begin = (int)((long long)chunks * w / pool->threads);
+        pool->workers[w].chunk_end = (int)((long long)chunks * (w + 1) / pool->threads);
+        pool->workers[w].stolen = 0;
+        atomic_init(&pool->workers[w].next_chunk, pool->workers[w].chunk_begin);
+    }
+}
+
+#endif
+
+// Fleet을 threads개 워커로 ticks만큼 실행
+// threads <= 0이면 모든 코어 사용, 반환값은 tick 처리(센서+FSM)에 걸린 시간(us)
+long long pool_run_fleet(RVCFleet *fleet, VirtualClock *clk, int ticks,
+                         int *threads, int *stolen) {
+    int chunks = (fleet->count + POOL_CHUNK_ROBOTS - 1) / POOL_CHUNK_ROBOTS;
+    int n = *threads > 0 ? *threads : pool_cpu_count();
+    if (n > POOL_MAX_THREADS) {
+        n = POOL_MAX_THREADS;
+    }
+    if (n > chunks) {
+        n = chunks > 0 ? chunks : 1;
+    }
+    *threads = n;
+    *stolen = 0;
+
+#ifndef _WIN32
+    PoolWorker *workers = n > 1 ? aligned_alloc(64, sizeof(PoolWorker) * n) : NULL;
+    if (workers) {
+        FleetPool pool;
+        pthread_t tids[POOL_MAX_THREADS];
+        PoolThreadArg args[POOL_MAX_THREADS];
+
+        pool.fleet = fleet;
+        pool.clk = clk;
+        pool.ticks = ticks;
+        pool.threads = n;
+        pool.step_us = 0;
+        pool.workers = workers;
+        pool.open = false;
+        pthread_mutex_init(&pool.gate_lock, NULL);
+        pthread_cond_init(&pool.gate, NULL);
+
+        // 워커 0은 호출 스레드가 직접 수행, 생성에 실패하면 거기까지 만든 워커로 실행
+        int started = 1;
+        for (int w = 1; w < n; w++) {
+            args[w].pool = &pool;
+            args[w].id = w;
+            if (pthread_create(&tids[w], NULL, pool_thread_main, &args[w]) != 0) {
+                fprintf(stderr, "Fleet pool: started %d of %d worker threads\n", started, n);
+                break;
+            }
+            started++;
+        }
+        pool.threads = started;
+        pool_split(&pool, chunks);
+        // barrier를 만들 수 없으면 워커는 tick 없이 끝나고 아래 단일 스레드 경로로 실행
+        bool ok = pthread_barrier_init(&pool.barrier, NULL, started) == 0;
+        if (!ok) {
+            pool.ticks = 0;
+        }
+        pthread_mutex_lock(&pool.gate_lock);
+        pool.open = true;
+        pthread_cond_broadcast(&pool.gate);
+        pthread_mutex_unlock(&pool.gate_lock);
+
+        if (ok) {
+            pool_worker_loop(&pool, 0);
+        }
+        for (int w = 1; w < started; w++) {
+            pthread_join(tids[w], NULL);
+        }
+        pthread_mutex_destroy(&pool.gate_lock);
+        pthread_cond_destroy(&pool.gate);
+        if (ok) {
+            for (int w = 0; w < started; w++) {
+                *stolen += pool.workers[w].stolen;
+            }
+            pthread_barrier_destroy(&pool.barrier);
+            free(pool.workers);
+            *threads = started;
+            return pool.step_us;
+        }
+        free(pool.workers);
+    }
+    *threads = 1;  // 워커 할당이나 barrier 생성 실패 시 단일 스레드로 실행
+#endif
+
+    // 단일 스레드 (또는 _WIN32): 같은 chunk 순서로 실행
+    long long step_us = 0;
+    for (int t = 0; t < ticks; t++) {
+        clock_advance(clk, t);
+        long long t0 = monotonic_us();
+        for (int c = 0; c < chunks; c++) {
+            pool_run_chunk(fleet, c);
+        }
+        if (swarm_world.enabled) {
+            swarm_update(fleet, clk->now_us);
+        }
+        fleet->ticks++;
+        step_us += monotonic_us() - t0;
+        clock_tick_done(clk);
+    }
+    return step_us;
+}
@@ -5,33 +5,37 @@
 #include <stdbool.h>
 #include "types.h"
 
-// 실제 하드웨어 센서가 없어 제어 로직 테스트를 위해 랜덤 값 사용
+// 함수 선언
+unsigned long long rng_next(RngState *rng);
+
+// 실제 하드웨어 센서가 없어 제어 로직 테스트를 위해 난수 사용
 // 20% 확률로 장애물 감지
 // 실제 구현 시에는 하드웨어 센서 핀에서 값을 읽어야 함
-void read_front_sensor(bool *value) {
+// 센서 프레임(64비트 난수 1개)을 16비트씩 잘라 각 센서가 자기 구간을 사용
+// 감지 시 해당 센서 비트(SENSOR_FRONT 등), 아니면 0을 반환
+SensorData read_front_sensor(unsigned long long frame) {
     // 시뮬레이션: 랜덤 장애물 감지
-    *value = (rand() % 10) < 2; 
+    return ((frame & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_FRONT;
 }
 
-void read_left_sensor(bool *value) {
-    *value = (rand() % 10) < 2;
+SensorData read_left_sensor(unsigned long long frame) {
+    return (((frame >> 16) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_LEFT;
 }
 
-void read_right_sensor(bool *value) {
-    *value = (rand() % 10) < 2;
+SensorData read_right_sensor(unsigned long long frame) {
+    return (((frame >> 32) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_RIGHT;
 }
 
-void read_dust_sensor(bool *value) {
-    *value = (rand() % 10) < 1;  // 10% 확률
+SensorData read_dust_sensor(unsigned long long frame) {
+    return (((frame >> 48) & 0xFFFF) < SENSOR_DUST_THRESHOLD) * SENSOR_DUST;  // 10% 확률
 }
 
 // 센서 인터페이스 (SA PDF p.7 DFD Level 1 "1.0 Sensor Interface & Preprocessing")
 // SA PDF p.18-19 Process Spec 1.0
 // SRS PDF p.2 FR-1.1 "Raw 센서값을 필터링"
-void sensor_interface(SensorData *sensors) {
-    read_front_sensor(&sensors->front);
-    read_left_sensor(&sensors->left);
-    read_right_sensor(&sensors->right);
-    read_dust_sensor(&sensors->dust);
+void sensor_interface(SensorData *sensors, RngState *rng) {
+    unsigned long long frame = rng_next(rng);  // tick당 난수 1회
+    // 센서별 비트를 OR 하여 4비트 워드로 묶음
+    *sensors = read_front_sensor(frame) | read_left_sensor(frame)
+             | read_right_sensor(frame) | read_dust_sensor(frame);
 }
-
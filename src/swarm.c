@@ -0,0 +1,352 @@
+/* ========== 공유 격자 세계 (fleet 다수 로봇 + 공간 해시) ========== */
+/*
+ * --robots N --io grid: N대가 한 지도에서 움직이며 벽/가구와 다른 로봇을 front/left/right로 감지
+ * tick 안에서는 공간 해시의 스냅숏(tick 시작 위치)만 읽고 자기 자세만 쓰므로 chunk를 어느 스레드가
+ * 처리해도 결과가 같고, tick이 끝나면 한 스레드가 버킷을 옮긴 로봇만 다시 연결
+ * 같은 tick에 두 로봇이 같은 자리로 들어가는 것은 막지 못함 (겹침은 최대 1 tick 이동량)
+ * 먼지와 청소 범위도 grid 백엔드와 같은 DustField / CoverageMap을 모든 로봇이 공유
+ * tick 안에서는 읽기만 하고 치우는 것은 tick 끝 swarm_update가 로봇 번호 순서로 하므로 스레드 수와 무관
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "types.h"
+
+#define SWARM_REACH_MM 380          // 다른 로봇이 닿는 중심 거리: 감지 (탐지 지점 210 + 반지름 170), 이동 (30 + 170 + 170)
+#define SWARM_PLACE_STREAM 0x5A3    // 시작 위치 난수 스트림
+#define SWARM_PLACE_TRIES 100000    // 로봇 한 대를 놓을 자리를 찾는 최대 시도 수
+#define SWARM_BLOCKED 8             // swarm_neighbors: 이동하면 다른 로봇과 겹침
+
+// 함수 선언
+unsigned long long rng_next(RngState *rng);
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+bool io_grid_load_map(GridMap *map, unsigned long long seed);
+void grid_free(GridMap *map);
+int grid_occupied(const GridMap *map, int x, int y);
+void env_offsets(int out[ENV_HEADINGS][2], int mm, int cell_mm);
+void kin_init(KinModel *kin, int step_mm, int unit_mm);
+bool coverage_init(CoverageMap *cov, const GridMap *map);
+void coverage_free(CoverageMap *cov);
+void coverage_sweep(CoverageMap *cov, const GridMap *map, int x, int y,
+                    int px, int py, bool prev_valid);
+void coverage_tick(CoverageMap *cov, const GridMap *map, long long time_us);
+void coverage_report(const CoverageMap *cov, const GridMap *map);
+bool dust_init(DustField *dust, const GridMap *map);
+void dust_free(DustField *dust);
+bool dust_scatter(DustField *dust, const GridMap *map, unsigned long long seed);
+int dust_at(const DustField *dust, int x, int y);
+void dust_clean(DustField *dust, const GridMap *map, int x, int y, int pickup);
+void dust_report(const DustField *dust);
+RobotPose kin_next(const KinModel *kin, RobotPose p, int motor);
+void swarm_free(SwarmWorld *world);
+
+SwarmWorld swarm_world;
+
+// 버킷 좌표 → 표 칸: 표를 2^(bits/2) × 2^(bits - bits/2) 버킷 격자로 보고 지도를 그 크기로 접음
+// x로 이웃한 버킷은 이웃한 칸이라 2×2 조회의 머리 노드가 대개 캐시 라인 2개에 모임
+// 표 한 바퀴만큼 떨어진 버킷은 같은 칸을 쓰지만 거리 검사로 걸러짐
+int swarm_slot(const SpatialHash *hash, int bx, int by) {
+    int wbits = hash->bits / 2;
+    return ((by & ((1 << (hash->bits - wbits)) - 1)) << wbits) | (bx & ((1 << wbits) - 1));
+}
+
+// 로봇 r을 (x, y) 칸의 버킷 리스트 앞에 연결
+void swarm_link(SpatialHash *hash, int r, int x, int y) {
+    SwarmNode *nodes = hash->nodes;
+    int slot = swarm_slot(hash, x / hash->bucket_cells, y / hash->bucket_cells);
+    int head = hash->robots + slot;
+    nodes[r].x = x;
+    nodes[r].y = y;
+    hash->slot[r] = slot;
+    nodes[r].next = nodes[head].next;
+    nodes[r].prev = head;
+    nodes[nodes[head].next].prev = r;
+    nodes[head].next = r;
+}
+
+void swarm_unlink(SpatialHash *hash, int r) {
+    SwarmNode *nodes = hash->nodes;
+    nodes[nodes[r].prev].next = nodes[r].next;
+    nodes[nodes[r].next].prev = nodes[r].prev;
+    nodes[r].next = nodes[r].prev = r;
+}
+
+// 로봇 r의 위치 갱신: 같은 표 칸이면 좌표만 쓰고, 칸이 바뀌면 O(1)로 옮겨 연결
+void swarm_relocate(SpatialHash *hash, int r, int x, int y) {
+    int slot = swarm_slot(hash, x / hash->bucket_cells, y / hash->bucket_cells);
+    if (slot == hash->slot[r]) {
+        hash->nodes[r].x = x;
+        hash->nodes[r].y = y;
+        return;
+    }
+    swarm_unlink(hash, r);
+    swarm_link(hash, r, x, y);
+    hash->relinks++;
+}
+
+// 표 할당: 칸 수는 로봇 수의 2배 이상인 2의 거듭제곱, 모든 노드는 빈 리스트로 시작
+// 버킷 한 변은 닿는 거리의 2배 → 로봇에 가까운 쪽 2×2 버킷만 보면 됨
+bool swarm_hash_init(SpatialHash *hash, int robots, int cell_mm) {
+    hash->robots = robots;
+    hash->bits = 6;
+    while ((1 << hash->bits) < 2 * robots && hash->bits < 30) {
+        hash->bits++;
+    }
+    hash->bucket_cells = 2 * (SWARM_REACH_MM / cell_mm + 1);
+    hash->relinks = 0;
+    int nodes = robots + (1 << hash->bits);
+    hash->nodes = malloc(sizeof(SwarmNode) * nodes);
+    hash->slot = calloc(robots > 0 ? robots : 1, sizeof(int));
+    if (!hash->nodes || !hash->slot) {
+        return false;
+    }
+    for (int n = 0; n < nodes; n++) {
+        hash->nodes[n].next = hash->nodes[n].prev = n;
+    }
+    return true;
+}
+
+// self 주변 로봇 조회 (tick 시작 스냅숏, self에서 닿는 거리 안의 로봇은 모두 [x - 버킷/2, x + 버킷/2]의 2×2 버킷에 있음)
+// 비트 k: 탐지 지점 probes[k]가 다른 로봇 몸체 안, SWARM_BLOCKED: 중심을 (nx, ny)로 옮기면 다른 로봇 몸체와 겹침
+// 이미 겹친 로봇(같은 tick에 함께 들어온 경우)에서는 멀어지는 이동만 허용
+int swarm_neighbors(const SwarmWorld *world, int self, const int probes[][2], int n, int nx, int ny) {
+    const SpatialHash *hash = &world->hash;
+    const SwarmNode *nodes = hash->nodes;
+    int x = nodes[self].x, y = nodes[self].y;
+    int half = hash->bucket_cells / 2;
+    int bx = (x - half) / hash->bucket_cells;
+    int by = (y - half) / hash->bucket_cells;
+    int body_sq = 4 * world->radius_sq;
+    int hits = 0;
+    for (int dy = 0; dy <= 1; dy++) {
+        for (int dx = 0; dx <= 1; dx++) {
+            int head = hash->robots + swarm_slot(hash, bx + dx, by + dy);
+            for (int j = nodes[head].next; j != head; j = nodes[j].next) {
+                if (j == self) {
+                    continue;
+                }
+                for (int k = 0; k < n; k++) {
+                    int ex = probes[k][0] - nodes[j].x, ey = probes[k][1] - nodes[j].y;
+                    hits |= (ex * ex + ey * ey < world->radius_sq) << k;
+                }
+                int mx = nx - nodes[j].x, my = ny - nodes[j].y;
+                int ox = x - nodes[j].x, oy = y - nodes[j].y;
+                int d = mx * mx + my * my;
+                hits |= (d < body_sq && d <= ox * ox + oy * oy) * SWARM_BLOCKED;
+            }
+        }
+    }
+    return hits;
+}
+
+// 시작 위치: 몸체가 벽/가구에 걸리지 않고 다른 로봇과 겹치지 않는 빈 칸에 무작위로 놓음
+bool swarm_place(SwarmWorld *world, RVCFleet *fleet, unsigned long long seed) {
+    const GridMap *map = &world->map;
+    int radius = ENV_ROBOT_RADIUS_MM / map->cell_mm;
+    RngState rng;
+    rng_seed(&rng, seed, SWARM_PLACE_STREAM);
+    for (int i = 0; i < fleet->count; i++) {
+        int tries = 0;
+        for (;;) {
+            if (++tries > SWARM_PLACE_TRIES) {
+                fprintf(stderr, "No room for %d robots in a %d x %d m map (placed %d)\n",
+                        fleet->count, map->width * map->cell_mm / 1000,
+                        map->height * map->cell_mm / 1000, i);
+                return false;
+            }
+            unsigned long long r = rng_next(&rng);
+            int x = (int)((r & 0xFFFFFF) % (unsigned)map->width);
+            int y = (int)(((r >> 24) & 0xFFFFFF) % (unsigned)map->height);
+            if (grid_occupied(map, x, y) ||
+                grid_occupied(map, x - radius, y) || grid_occupied(map, x + radius, y) ||
+                grid_occupied(map, x, y - radius) || grid_occupied(map, x, y + radius)) {
+                continue;
+            }
+            swarm_link(&world->hash, i, x, y);
+            if (swarm_neighbors(world, i, NULL, 0, x, y)) {
+                swarm_unlink(&world->hash, i);
+                continue;
+            }
+            world->home_x[i] = (unsigned int)x << KIN_FRAC_BITS;
+            world->home_y[i] = (unsigned int)y << KIN_FRAC_BITS;
+            fleet->heading[i] = (unsigned char)((r >> 56) & 7);
+            break;
+        }
+    }
+    return true;
+}
+
+// fleet을 격자 세계에 놓음: 지도와 먼지는 grid 백엔드와 같은 방법으로 준비 (--map / --save-map / --room-m)
+// fleet 자세 단위를 지도 칸으로 바꿔 칸 번호를 시프트 하나로 구함
+bool swarm_init(SwarmWorld *world, RVCFleet *fleet, unsigned long long seed) {
+    int n = fleet->count > 0 ? fleet->count : 1;
+    world->enabled = false;
+    if (!io_grid_load_map(&world->map, seed)) {
+        return false;
+    }
+    const GridMap *map = &world->map;
+    int radius = ENV_ROBOT_RADIUS_MM / map->cell_mm;
+    world->radius_sq = radius * radius;
+    env_offsets(world->probe, ENV_ROBOT_RADIUS_MM + ENV_SENSOR_RANGE_MM, map->cell_mm);
+    env_offsets(world->body, ENV_ROBOT_RADIUS_MM, map->cell_mm);
+    kin_init(&fleet->kin, ENV_STEP_MM, map->cell_mm);
+    world->home_x = calloc(n, sizeof(unsigned int));
+    world->home_y = calloc(n, sizeof(unsigned int));
+    world->bumps = calloc(n, sizeof(unsigned int));
+    world->contacts = calloc(n, sizeof(unsigned int));
+    world->ahead = calloc(n, sizeof(unsigned char));
+    world->prev_x = calloc(n, sizeof(int));
+    world->prev_y = calloc(n, sizeof(int));
+    world->prev_valid = calloc(n, sizeof(unsigned char));
+    bool field = coverage_init(&world->coverage, map) && dust_init(&world->dust, map) &&
+                 dust_scatter(&world->dust, map, seed);
+    if (!swarm_hash_init(&world->hash, fleet->count, map->cell_mm) ||
+        !world->home_x || !world->home_y || !world->bumps || !world->contacts ||
+        !world->ahead || !world->prev_x || !world->prev_y || !world->prev_valid || !field) {
+        fprintf(stderr, "Swarm allocation failed (%d robots)\n", fleet->count);
+        swarm_free(world);
+        return false;
+    }
+    if (!swarm_place(world, fleet, seed)) {
+        swarm_free(world);
+        return false;
+    }
+    world->enabled = true;
+    return true;
+}
+
+void swarm_free(SwarmWorld *world) {
+    free(world->hash.nodes);
+    free(world->hash.slot);
+    free(world->home_x);
+    free(world->home_y);
+    free(world->bumps);
+    free(world->contacts);
+    free(world->ahead);
+    free(world->prev_x);
+    free(world->prev_y);
+    free(world->prev_valid);
+    dust_free(&world->dust);
+    coverage_free(&world->coverage);
+    grid_free(&world->map);
+    world->enabled = false;
+}
+
+// 센서 입력: 앞/왼쪽/오른쪽 탐지 지점이 벽/가구 칸이거나 다른 로봇 몸체 안이면 감지
+// 전진하면 다른 로봇과 겹치는 경우도 front (비스듬히 다가온 로봇은 탐지 지점 사이로 들어올 수 있음)
+// 먼지는 로봇 중심 칸의 공유 먼지 밀도 (grid 백엔드와 같은 문턱, tick 안에서는 아무도 치우지 않음)
+void swarm_sense(RVCFleet *fleet, int begin, int end) {
+    SwarmWorld *world = &swarm_world;
+    const SwarmNode *nodes = world->hash.nodes;
+    for (int i = begin; i < end; i++) {
+        int x = nodes[i].x, y = nodes[i].y;
+        int h = fleet->heading[i];
+        const int *f = world->probe[h];
+        const int *l = world->probe[(h + 6) & 7];
+        const int *r = world->probe[(h + 2) & 7];
+        const int probes[3][2] = {
+            {x + f[0], y + f[1]}, {x + l[0], y + l[1]}, {x + r[0], y + r[1]}
+        };
+        int ax = (int)(world->home_x[i] + fleet->pose_x[i]) + fleet->kin.step[h][0];
+        int ay = (int)(world->home_y[i] + fleet->pose_y[i]) + fleet->kin.step[h][1];
+        int robots = swarm_neighbors(world, i, probes, 3, ax >> KIN_FRAC_BITS, ay >> KIN_FRAC_BITS);
+        world->ahead[i] = (robots & SWARM_BLOCKED) != 0;
+        fleet->sensors[i] = (unsigned char)(
+            (grid_occupied(&world->map, probes[0][0], probes[0][1]) | (robots & 1) | world->ahead[i]) * SENSOR_FRONT
+            | (grid_occupied(&world->map, probes[1][0], probes[1][1]) | ((robots >> 1) & 1)) * SENSOR_LEFT
+            | (grid_occupied(&world->map, probes[2][0], probes[2][1]) | ((robots >> 2) & 1)) * SENSOR_RIGHT
+            | (dust_at(&world->dust, x, y) >= ENV_DUST_SENSE) * SENSOR_DUST);
+    }
+}
+
+// 이번 tick 모터 명령 적용 (kin_next)
+// 전진/후진 후 몸체 끝이 벽/가구 칸이거나 몸체가 다른 로봇과 겹치면 제자리 (전진은 swarm_sense의 판정 사용)
+void swarm_move(RVCFleet *fleet, int begin, int end) {
+    SwarmWorld *world = &swarm_world;
+    for (int i = begin; i < end; i++) {
+        int c = fleet->motor_cmd[i];
+        RobotPose p = {
+            (int)(world->home_x[i] + fleet->pose_x[i]),
+            (int)(world->home_y[i] + fleet->pose_y[i]),
+            fleet->heading[i]
+        };
+        RobotPose next = kin_next(&fleet->kin, p, c);
+        if (c == MOTOR_FORWARD || c == MOTOR_BACKWARD) {
+            int sign = c == MOTOR_FORWARD ? 1 : -1;
+            int cx = next.x >> KIN_FRAC_BITS, cy = next.y >> KIN_FRAC_BITS;
+            if (grid_occupied(&world->map, cx + sign * world->body[p.heading][0],
+                              cy + sign * world->body[p.heading][1])) {
+                world->bumps[i]++;
+                continue;
+            }
+            if (c == MOTOR_FORWARD ? world->ahead[i]
+                                 : (swarm_neighbors(world, i, NULL, 0, cx, cy) & SWARM_BLOCKED) != 0) {
+                world->contacts[i]++;
+                continue;
+            }
+        }
+        fleet->pose_x[i] += (unsigned int)(next.x - p.x);
+        fleet->pose_y[i] += (unsigned int)(next.y - p.y);
+        fleet->heading[i] = (unsigned char)next.heading;
+    }
+}
+
+// tick 끝 (모든 chunk 처리 후, 한 스레드): 청소 중인 로봇마다 센서를 읽은 칸(tick 시작 위치)의
+// 청소 범위와 먼지를 로봇 번호 순서로 갱신 (grid 백엔드처럼 센서는 치우기 전 값)
+// 그다음 스냅숏을 새 위치로 갱신, 버킷을 옮긴 로봇만 다시 연결
+void swarm_update(RVCFleet *fleet, long long time_us) {
+    SwarmWorld *world = &swarm_world;
+    const SwarmNode *nodes = world->hash.nodes;
+    for (int i = 0; i < fleet->count; i++) {
+        int x = nodes[i].x, y = nodes[i].y;
+        int c = fleet->cleaner_cmd[i];
+        bool cleaning = c == CLEANER_ON || c == CLEANER_POWERUP;
+        world->dust.detections += (fleet->sensors[i] & SENSOR_DUST) != 0;
+        if (cleaning) {
+            coverage_sweep(&world->coverage, &world->map, x, y,
+                           world->prev_x[i], world->prev_y[i], world->prev_valid[i]);
+            dust_clean(&world->dust, &world->map, x, y,
+                       c == CLEANER_POWERUP ? ENV_DUST_PICKUP_TURBO : ENV_DUST_PICKUP_NORMAL);
+            world->prev_x[i] = x;
+            world->prev_y[i] = y;
+        }
+        world->prev_valid[i] = cleaning;
+    }
+    coverage_tick(&world->coverage, &world->map, time_us);
+    for (int i = 0; i < fleet->count; i++) {
+        swarm_relocate(&world->hash, i,
+                       (int)(world->home_x[i] + fleet->pose_x[i]) >> KIN_FRAC_BITS,
+                       (int)(world->home_y[i] + fleet->pose_y[i]) >> KIN_FRAC_BITS);
+    }
+}
+
+void swarm_report(const RVCFleet *fleet, int ticks) {
+    const SwarmWorld *world = &swarm_world;
+    const SpatialHash *hash = &world->hash;
+    const GridMap *map = &world->map;
+    long long bumps = 0, contacts = 0;
+    for (int i = 0; i < fleet->count; i++) {
+        bumps += world->bumps[i];
+        contacts += world->contacts[i];
+    }
+    int slots = 1 << hash->bits, used = 0, longest = 0;
+    for (int s = 0; s < slots; s++) {
+        int head = hash->robots + s, len = 0;
+        for (int j = hash->nodes[head].next; j != head; j = hash->nodes[j].next) {
+            len++;
+        }
+        used += len > 0;
+        longest = len > longest ? len : longest;
+    }
+    double robot_ticks = (double)fleet->count * ticks;
+    printf("Swarm: %d robots in a %d x %d cell map (%d mm, %.1f%% free), blocked by walls %lld, "
+           "by robots %lld robot-ticks\n",
+           fleet->count, map->width, map->height, map->cell_mm,
+           100.0 * map->free_cells / ((double)map->width * map->height), bumps, contacts);
+    printf("Spatial hash: %d slots (%d in use, longest list %d), %d mm buckets, "
+           "%.4f relinks/robot-tick\n",
+           slots, used, longest, hash->bucket_cells * map->cell_mm,
+           robot_ticks > 0 ? hash->relinks / robot_ticks : 0.0);
+    coverage_report(&world->coverage, map);
+    dust_report(&world->dust);
+}
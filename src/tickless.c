@@ -0,0 +1,193 @@
+/* ========== Tickless 실행 (이벤트 사이 구간 건너뛰기) ========== */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <limits.h>
+#include "types.h"
+
+// 함수 선언
+void rng_skip(RngState *rng, unsigned long long n);
+void sensor_interface(SensorData *sensors, RngState *rng);
+void print_status(RVCContext *ctx);
+void actuator_interface(RVCContext *ctx);
+void actuator_skip(RVCContext *ctx, int ticks);
+void evlog_emit(int node, int from, int to, int reason, int value, int value2);
+void evlog_set_tick(int tick);
+void clock_skip(VirtualClock *clk, int ticks);
+
+// 전이 테이블 한 행에서 상태가 "조용한"지 검사
+// 타이머가 만료되지 않은 동안 어떤 센서 워드가 와도 상태 유지, 메시지 없음, 같은 명령이면 조용함
+// (타이머 없는 상태는 만료 플래그가 항상 1이므로 두 열을 모두 검사)
+bool tickless_quiet_row(const FsmEntry (*row)[2], int state, int words, bool timed) {
+    const FsmEntry *first = &row[0][0];
+    for (int w = 0; w < words; w++) {
+        for (int expired = 0; expired < (timed ? 1 : 2); expired++) {
+            const FsmEntry *e = &row[w][expired];
+            if (e->next != state || e->msg[0] || e->reload ||
+                e->motor != first->motor || e->cleaner != first->cleaner) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// 엔진 초기화: 상태별 조용함 여부를 생성된 전이 테이블에서 미리 계산
+void tickless_init(TicklessEngine *eng, bool summary) {
+    eng->count = 0;
+    eng->summary = summary;
+    for (int n = 0; n < TICKLESS_MAX_EVENTS; n++) {
+        eng->pos[n] = -1;
+        eng->key[n] = -1;
+    }
+    eng->stepped = 0;
+    eng->skipped = 0;
+    for (int s = 0; s < 5; s++) {
+        eng->quiet[s] = tickless_quiet_row(fsm_v1_table[s], s, 16, fsm_v1_timer_limit[s] > 0);
+    }
+}
+
+// 이벤트 큐 (tick 기준 최소 힙, 노드당 항목 하나)
+// 항목은 실행 사이에도 유지되고, 상태가 바뀐 노드의 항목만 제자리에서 tick을 고침
+void tickless_place(TicklessEngine *eng, int i, TicklessEvent ev) {
+    eng->heap[i] = ev;
+    eng->pos[ev.node] = i;
+}
+
+void tickless_sift(TicklessEngine *eng, int i) {
+    TicklessEvent ev = eng->heap[i];
+    while (i > 0 && eng->heap[(i - 1) / 2].tick > ev.tick) {
+        tickless_place(eng, i, eng->heap[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= eng->count) {
+            break;
+        }
+        if (child + 1 < eng->count && eng->heap[child + 1].tick < eng->heap[child].tick) {
+            child++;
+        }
+        if (eng->heap[child].tick >= ev.tick) {
+            break;
+        }
+        tickless_place(eng, i, eng->heap[child]);
+        i = child;
+    }
+    tickless_place(eng, i, ev);
+}
+
+// 노드의 이벤트를 절대 tick으로 예약 (이미 있으면 옮김)
+void tickless_schedule(TicklessEngine *eng, int node, long long tick) {
+    int i = eng->pos[node];
+    if (i < 0) {
+        i = eng->count++;
+    }
+    eng->heap[i].tick = tick;
+    eng->heap[i].node = node;
+    tickless_sift(eng, i);
+}
+
+// 노드의 예약이 아직 유효한지: 예약할 때의 상태 키가 그대로이고 예약 tick이 지나지 않음
+// (상태가 그대로면 지속 시간은 실행하든 건너뛰든 tick마다 1씩 늘어 만료 tick이 같음)
+bool tickless_valid(const TicklessEngine *eng, int node, int key, int tick) {
+    return eng->pos[node] >= 0 && eng->key[node] == key &&
+           eng->heap[eng->pos[node]].tick >= tick;
+}
+
+// 다음 이벤트까지 tick 수(1: 이번 tick) → 절대 tick
+long long tickless_at(int tick, long long wait) {
+    return wait == LLONG_MAX ? LLONG_MAX : tick + wait - 1;
+}
+
+// FSM의 다음 이벤트까지 tick 수 (1: 이번 tick에 전이 가능, LLONG_MAX: 없음)
+// 조용한 상태는 상태 타이머가 만료되는 tick (state_duration + n >= 한계)까지 변화 없음
+long long v1_next_event(const TicklessEngine *eng, const RVCContext *ctx) {
+    if (!eng->quiet[ctx->state]) {
+        return 1;   // Moving / Turning: 매 tick 센서에 따라 전이
+    }
+    int limit = fsm_v1_timer_limit[ctx->state];
+    if (limit == 0) {
+        return LLONG_MAX;
+    }
+    return limit - ctx->state_duration > 1 ? limit - ctx->state_duration : 1;
+}
+
+// 조용한 구간 n tick을 fsm_executor 없이 진행
+// 상태 유지 → 지속 시간과 카운트다운 타이머만 n만큼 변하고 명령은 상태 기본값
+void v1_quiet_advance(RVCContext *ctx, int ticks) {
+    const FsmEntry *e = &fsm_v1_table[ctx->state][0][0];
+    ctx->state_duration += ticks;
+    ctx->backward_timer -= ticks * (ctx->state == STATE_BACKWARDING);
+    ctx->dust_clean_timer -= ticks * (ctx->state == STATE_DUST_CLEANING);
+    if (e->motor != FSM_KEEP) {
+        ctx->motor_cmd = e->motor;
+    }
+    ctx->cleaner_cmd = e->cleaner;
+}
+
+// 건너뛴 구간의 센서 워드와 상태 표시 (상태는 이미 구간 끝으로 진행됨)
+// 센서 난수는 카운터 기반이라 구간 첫 tick의 난수 상태(frames)에서 바로 마지막 프레임을 만들 수 있음
+// 상태 표시(RVC_LOG_STATUS)는 tick 단위 실행과 같은 tick별 레코드: 프레임을 차례로 다시 만들고
+// 지속 시간은 tick마다 1씩 늘림 (출력 자체가 tick 수에 비례), --tickless-summary면 구간 요약 1개
+void v1_skip_status(const TicklessEngine *eng, RVCContext *ctx, RngState frames, int tick, int skip) {
+#if RVC_LOG_LEVEL >= RVC_LOG_STATUS
+    if (!eng->summary) {
+        ctx->state_duration -= skip;
+        for (int k = 0; k < skip; k++) {
+            evlog_set_tick(tick + k);
+            sensor_interface(&ctx->sensors, &frames);
+            ctx->state_duration++;
+            print_status(ctx);
+        }
+        return;
+    }
+    evlog_emit(LOG_NODE_SKIP, ctx->state, 0, 0, skip, 0);
+#else
+    (void)eng;
+    (void)tick;
+#endif
+    rng_skip(&frames, (unsigned long long)(skip - 1));
+    sensor_interface(&ctx->sensors, &frames);
+}
+
+// tick부터 다음 이벤트 직전까지 건너뛰고 건너뛴 tick 수를 반환 (0: 이번 tick을 실행)
+// 건너뛴 구간은 상태와 명령이 그대로이므로 tick별로 재생하지 않고 한 번에 진행:
+// 명령 변화는 첫 tick에만 있을 수 있어 액추에이터 출력은 tick 단위 실행과 같고,
+// 상태 표시도 tick 단위 실행과 같음 (v1_skip_status)
+int tickless_skip(TicklessEngine *eng, RVCContext *ctx, VirtualClock *clk,
+                  int tick, int end_tick) {
+    if (!tickless_valid(eng, 0, ctx->state, tick)) {
+        eng->key[0] = ctx->state;
+        tickless_schedule(eng, 0, tickless_at(tick, v1_next_event(eng, ctx)));
+    }
+    long long skip = eng->heap[0].tick - tick;
+    if (skip > end_tick - tick) {
+        skip = end_tick - tick;
+    }
+    if (skip <= 0) {
+        eng->stepped++;
+        return 0;
+    }
+
+    ctx->tick_count = tick;
+    evlog_set_tick(tick);
+    RngState frames = ctx->rng;     // 구간 첫 tick의 센서 난수
+    rng_skip(&ctx->rng, (unsigned long long)skip);
+    v1_quiet_advance(ctx, (int)skip);
+    actuator_skip(ctx, (int)skip);
+    clock_skip(clk, (int)skip);
+    v1_skip_status(eng, ctx, frames, tick, (int)skip);
+    ctx->tick_count = tick + (int)skip - 1;
+    eng->skipped += skip;
+    if (tick + skip < end_tick) {
+        eng->stepped++;     // 건너뛴 뒤 이어서 실행할 이벤트 tick
+    }
+    return (int)skip;
+}
+
+void tickless_report(const TicklessEngine *eng) {
+    long long total = eng->stepped + eng->skipped;
+    printf("Tickless: %lld ticks stepped, %lld skipped (%.1f%%)\n",
+           eng->stepped, eng->skipped, total > 0 ? 100.0 * eng->skipped / total : 0.0);
+}
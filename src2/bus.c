@@ -0,0 +1,167 @@
+/* ========== 제어 버스 (N개 제어 노드 간 신호) ========== */
+
+#include <stdio.h>
+#include <string.h>
+#include "types.h"
+
+// 함수 선언
+long long monotonic_ns(void);
+void latency_add(LatencyHistogram *hist, long long ns);
+void latency_print_row(FILE *out, const char *name, const LatencyHistogram *hist);
+
+void bus_init(ControlBus *bus) {
+    memset(bus, 0, sizeof(*bus));
+}
+
+// 노드 등록, 반환값은 노드 번호 (-1: 한계 초과)
+int bus_add_node(ControlBus *bus, const char *name, BusNodeStep step) {
+    if (bus->node_count >= BUS_MAX_NODES) {
+        fprintf(stderr, "Control bus: too many nodes (%s)\n", name);
+        return -1;
+    }
+    BusNode *node = &bus->nodes[bus->node_count];
+    node->name = name;
+    node->step = step;
+    return bus->node_count++;
+}
+
+const char *bus_type_name(BusSignalType type) {
+    return type == BUS_BOOL ? "bool" : "int";
+}
+
+// 신호 등록, 반환값은 신호 번호 (-1: 한계 초과)
+int bus_add_signal(ControlBus *bus, const char *name, BusSignalType type) {
+    if (bus->signal_count >= BUS_MAX_SIGNALS) {
+        fprintf(stderr, "Control bus: too many signals (%s)\n", name);
+        return -1;
+    }
+    BusSignal *sig = &bus->signals[bus->signal_count];
+    sig->name = name;
+    sig->type = type;
+    sig->producer = -1;
+    return bus->signal_count++;
+}
+
+// 생산 노드 선언 (신호마다 하나, 생산 노드가 쓰는 형식이 등록된 형식과 같아야 함)
+bool bus_produce(ControlBus *bus, int node, int signal, BusSignalType type) {
+    if (bus->signals[signal].type != type) {
+        fprintf(stderr, "Control bus: %s writes %s as %s, registered as %s\n",
+                bus->nodes[node].name, bus->signals[signal].name,
+                bus_type_name(type), bus_type_name(bus->signals[signal].type));
+        return false;
+    }
+    if (bus->signals[signal].producer >= 0) {
+        fprintf(stderr, "Control bus: %s already produced by %s\n",
+                bus->signals[signal].name, bus->nodes[bus->signals[signal].producer].name);
+        return false;
+    }
+    bus->signals[signal].producer = node;
+    bus->nodes[node].writes |= 1u << signal;
+    return true;
+}
+
+// 소비 선언: 같은 tick 값을 읽는 경우만 실행 순서에 영향
+void bus_consume(ControlBus *bus, int node, int signal, BusDelivery delivery) {
+    bus->nodes[node].reads |= 1u << signal;
+    if (delivery == BUS_SAME_TICK) {
+        bus->nodes[node].reads_now |= 1u << signal;
+    }
+}
+
+// 등록 완료: 생산 노드 검사 후 같은 tick 의존 관계로 실행 순서 결정 (위상 정렬)
+// 의존이 없는 노드끼리는 등록 순서 유지, 순환 의존이면 false
+bool bus_finalize(ControlBus *bus) {
+    unsigned int placed = 0;
+    for (int s = 0; s < bus->signal_count; s++) {
+        if (bus->signals[s].producer < 0) {
+            fprintf(stderr, "Control bus: signal %s has no producer\n", bus->signals[s].name);
+            return false;
+        }
+    }
+    for (int k = 0; k < bus->node_count; k++) {
+        int next = -1;
+        for (int n = 0; n < bus->node_count && next < 0; n++) {
+            if (placed & (1u << n)) {
+                continue;
+            }
+            // 같은 tick에 읽는 신호의 생산 노드가 모두 배치되었으면 실행 가능
+            bool ready = true;
+            for (int s = 0; s < bus->signal_count; s++) {
+                if ((bus->nodes[n].reads_now & (1u << s)) &&
+                    !(placed & (1u << bus->signals[s].producer))) {
+                    ready = false;
+                }
+            }
+            if (ready) {
+                next = n;
+            }
+        }
+        if (next < 0) {
+            fprintf(stderr, "Control bus: same-tick dependency cycle\n");
+            return false;
+        }
+        bus->order[k] = next;
+        placed |= 1u << next;
+    }
+    return true;
+}
+
+// 지연 측정 중 1 tick: 노드 실행 전후로 소비/생산 신호의 시각 기록
+// 읽기/쓰기 함수에는 측정 분기를 두지 않음 → 측정하지 않는 실행(fleet, 벤치)의 비용 그대로
+void bus_run_tick_measured(ControlBus *bus, RVCSystem *sys) {
+    for (int k = 0; k < bus->node_count; k++) {
+        BusNode *node = &bus->nodes[bus->order[k]];
+        long long now = monotonic_ns();
+        for (int s = 0; s < bus->signal_count; s++) {
+            BusSignal *sig = &bus->signals[s];
+            // 같은 tick에 읽으면 이번 tick 쓰기, 아니면 지난 tick 쓰기 (0: 쓴 적 없음)
+            long long written = sig->written_ns[(node->reads_now >> s) & 1];
+            if ((node->reads & (1u << s)) && written > 0) {
+                latency_add(&sig->latency, now - written);
+            }
+        }
+        node->step(sys);
+        now = monotonic_ns();
+        for (int s = 0; s < bus->signal_count; s++) {
+            if (node->writes & (1u << s)) {
+                bus->signals[s].written_ns[1] = now;
+            }
+        }
+    }
+    // 이번 tick 쓰기 → 게시
+    for (int s = 0; s < bus->signal_count; s++) {
+        bus->signals[s].written_ns[0] = bus->signals[s].written_ns[1];
+    }
+    sys->bus.front ^= 1;
+}
+
+// 제어 노드 1 tick: 정해진 순서로 노드 실행 후 버퍼 교체로 게시
+// 노드별 비용은 자기 step 호출뿐이므로 노드를 추가해도 다른 노드의 tick 비용은 그대로
+void bus_run_tick(ControlBus *bus, RVCSystem *sys) {
+    if (bus->measure) {
+        bus_run_tick_measured(bus, sys);
+        return;
+    }
+    for (int k = 0; k < bus->node_count; k++) {
+        bus->nodes[bus->order[k]].step(sys);
+    }
+    sys->bus.front ^= 1;
+}
+
+// 신호별 전달 지연 (쓰기 → 읽기, BUS_NEXT_TICK은 한 tick 간격 포함)
+void bus_report(const ControlBus *bus, FILE *out) {
+    bool any = false;
+    for (int s = 0; s < bus->signal_count; s++) {
+        any |= bus->signals[s].latency.samples > 0;
+    }
+    if (!any) {
+        return;
+    }
+    fprintf(out, "[LATENCY] %-16s %10s %9s %9s %9s %9s (ns, write -> read)\n",
+            "bus signal", "samples", "p50", "p99", "p99.9", "max");
+    for (int s = 0; s < bus->signal_count; s++) {
+        if (bus->signals[s].latency.samples > 0) {
+            latency_print_row(out, bus->signals[s].name, &bus->signals[s].latency);
+        }
+    }
+}
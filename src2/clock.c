@@ -0,0 +1,174 @@
+/* ========== 가상 시계 (Tick 타이밍) ========== */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <time.h>
+#include "types.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#endif
+
+// 함수 선언
+void evlog_emit(int node, int from, int to, int reason, int value, int value2);
+
+// 단조 시계 현재 값 (us)
+long long monotonic_us(void) {
+#ifndef _WIN32
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+#else
+    return (long long)clock() * 1000000LL / CLOCKS_PER_SEC;
+#endif
+}
+
+// 단조 시계 현재 값 (ns, tick 단계별 지연 측정용)
+long long monotonic_ns(void) {
+#ifndef _WIN32
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#else
+    return (long long)clock() * (1000000000LL / CLOCKS_PER_SEC);
+#endif
+}
+
+// 절대 시각(단조 시계)까지 대기
+// 상대 대기(usleep)와 달리 처리 시간만큼 주기가 밀리지 않음
+void sleep_until_us(long long deadline_us) {
+#ifndef _WIN32
+    struct timespec ts;
+    ts.tv_sec = deadline_us / 1000000LL;
+    ts.tv_nsec = (deadline_us % 1000000LL) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+        // 시그널로 깨어나면 같은 데드라인으로 다시 대기
+    }
+#else
+    (void)deadline_us;
+#endif
+}
+
+// 가상 시계 초기화
+// REALTIME: 제어 주기마다 절대 데드라인까지 대기 (SRS PDF p.3-4 "P-1 제어주기: 50–100 ms")
+// FAST: 대기 없이 진행하고 tick 시각은 tick 번호 × 주기로 합성
+void clock_init(VirtualClock *clk, ClockMode mode, long long period_us) {
+    clk->mode = mode;
+    clk->period_us = period_us;
+    clk->start_us = monotonic_us();
+    clk->anchored = false;
+    clk->now_us = 0;
+    clk->deadline_us = clk->start_us;
+    clk->tick_start_us = clk->start_us;
+    clk->jitter_us = 0;
+    clk->jitter_sum_us = 0;
+    clk->jitter_max_us = 0;
+    clk->work_us = 0;
+    clk->work_max_us = 0;
+    clk->missed_deadlines = 0;
+    clk->ticks_done = 0;
+}
+
+// 해당 tick의 시작 시각까지 진행하고 그 시각을 반환
+long long clock_advance(VirtualClock *clk, int tick) {
+    if (clk->mode == CLOCK_MODE_FAST) {
+        clk->now_us = (long long)tick * clk->period_us;
+        return clk->now_us;
+    }
+
+    // 데드라인은 시작 시각 기준 절대 격자 (start + tick × period)
+    // → 처리 시간이나 대기 오차가 다음 주기로 누적되지 않음
+    // 격자는 첫 tick이 시작하는 순간에 잡음: clock_init 시각에 잡으면 첫 tick이 항상 늦은 것으로 셈
+    long long now = monotonic_us();
+    if (!clk->anchored) {
+        clk->start_us = now - (long long)tick * clk->period_us;
+        clk->anchored = true;
+    }
+    clk->deadline_us = clk->start_us + (long long)tick * clk->period_us;
+
+    if (now > clk->deadline_us) {
+        // 이전 tick 처리가 이번 데드라인을 넘김 (overrun)
+        clk->missed_deadlines++;
+    } else {
+        sleep_until_us(clk->deadline_us);
+        now = monotonic_us();
+    }
+
+    clk->tick_start_us = now;
+    clk->jitter_us = now - clk->deadline_us;
+    clk->jitter_sum_us += clk->jitter_us;
+    if (clk->jitter_us > clk->jitter_max_us) {
+        clk->jitter_max_us = clk->jitter_us;
+    }
+    clk->now_us = now - clk->start_us;
+    return clk->now_us;
+}
+
+// tick 처리(센서 → 제어 → 액추에이터) 완료 기록
+void clock_tick_done(VirtualClock *clk) {
+    clk->ticks_done++;
+    if (clk->mode == CLOCK_MODE_FAST) {
+        return;
+    }
+
+    clk->work_us = monotonic_us() - clk->tick_start_us;
+    if (clk->work_us > clk->work_max_us) {
+        clk->work_max_us = clk->work_us;
+    }
+}
+
+// tick별 jitter / 처리 시간 레코드 (--sched-trace, 실시간 모드, 상태 표시 뒤에 호출)
+// 벽시계에 따라 달라지는 값이라 기본 trace에는 넣지 않음 (같은 시드면 같은 trace)
+void clock_trace(const VirtualClock *clk) {
+#if RVC_LOG_LEVEL >= RVC_LOG_STATUS
+    if (clk->mode == CLOCK_MODE_REALTIME) {
+        evlog_emit(LOG_NODE_SCHED, 0, 0, 0, (int)clk->jitter_us, (int)clk->work_us);
+    }
+#else
+    (void)clk;
+#endif
+}
+
+// 처리 없이 지나간 tick 기록 (tickless 실행, FAST 모드 전용)
+void clock_skip(VirtualClock *clk, int ticks) {
+    clk->ticks_done += ticks;
+}
+
+// 시작 이후 실제 경과 시간 (us)
+long long clock_elapsed_us(VirtualClock *clk) {
+    return monotonic_us() - clk->start_us;
+}
+
+// 스케줄링 결과 보고 (SRS PDF p.3-4 "P-1", "P-2")
+void clock_report(VirtualClock *clk) {
+    long long wall_us = clock_elapsed_us(clk);
+    // 시뮬레이션 시각은 마지막 tick의 시작 시각 (tick 0이 t=0, N tick이면 (N-1) × 주기)
+    long long simulated_us = clk->ticks_done > 0 ? (long long)(clk->ticks_done - 1) * clk->period_us : 0;
+
+    printf("Ticks: %d, simulated: %lld ms, wall: %lld ms",
+           clk->ticks_done, simulated_us / 1000, wall_us / 1000);
+    if (wall_us > 0) {
+        printf(" (%.0f ticks/s)", clk->ticks_done * 1e6 / wall_us);
+    }
+    printf("\n");
+
+    if (clk->mode == CLOCK_MODE_FAST || clk->ticks_done == 0) {
+        return;
+    }
+
+    // 최악 반응시간: 직후 샘플링을 놓친 이벤트가 다음 tick에서 처리되는 경우
+    // = 주기 + 최대 시작 지연 + 최대 처리 시간
+    long long reaction_us = clk->period_us + clk->jitter_max_us + clk->work_max_us;
+    bool p1_ok = clk->period_us >= 50000 && clk->period_us <= 100000
+                 && clk->missed_deadlines == 0;
+    bool p2_ok = reaction_us <= 150000;
+
+    printf("[SCHED] period=%lld ms, missed deadlines=%d\n",
+           clk->period_us / 1000, clk->missed_deadlines);
+    printf("[SCHED] jitter avg=%lld us, max=%lld us, worst work=%lld us\n",
+           clk->jitter_sum_us / clk->ticks_done, clk->jitter_max_us,
+           clk->work_max_us);
+    printf("[SCHED] P-1 control period 50-100 ms: %s\n", p1_ok ? "OK" : "VIOLATED");
+    printf("[SCHED] P-2 worst reaction %lld ms <= 150 ms: %s\n",
+           reaction_us / 1000, p2_ok ? "OK" : "VIOLATED");
+}
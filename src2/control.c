@@ -1,26 +1,66 @@
 /* ========== 제어 로직 조율 ========== */
 
+#include <stdio.h>
 #include "types.h"
 
 // 함수 선언
 void cn1_motor_fsm(CN1_Context *cn1, SensorData *sensors, bool cleaner_trigger);
 void cn2_cleaner_fsm(CN2_Context *cn2, bool dust_detected, bool motor_moving);
+void bus_init(ControlBus *bus);
+int bus_add_node(ControlBus *bus, const char *name, BusNodeStep step);
+int bus_add_signal(ControlBus *bus, const char *name, BusSignalType type);
+bool bus_produce(ControlBus *bus, int node, int signal, BusSignalType type);
+void bus_consume(ControlBus *bus, int node, int signal, BusDelivery delivery);
+bool bus_finalize(ControlBus *bus);
+void bus_run_tick(ControlBus *bus, RVCSystem *sys);
 
-// 제어 로직 (SA PDF p.8 "CN 간 상호작용")
-// SRS PDF p.3 FR-2.2 "상호 인터페이스는 Cleaner_Trigger와 Motor_Status"
-void control_logic(RVCSystem *sys) {
-    // 청소기 트리거 신호 결정
-    sys->cleaner_trigger = (sys->cn2.state == CLEANER_POWERUP);
+// V2 제어 버스와 신호 번호 (control_init에서 등록)
+ControlBus control_bus;
+int signal_cleaner_trigger;     // SA PDF p.8 "CN2 → CN1: Cleaner_Trigger"
+int signal_motor_status;        // SRS PDF p.4 DD "Motor_Status"
+
+// CN1 노드 (SA PDF p.24-25 Process 2.1)
+void cn1_node(RVCSystem *sys) {
     // SA PDF p.16 "Normal → Power-Up → Paused Trigger to CN1"
-    
-    // 모터 상태 결정
-    sys->motor_status_moving = (sys->cn1.state == MOTOR_MOVING);
-    // SRS PDF p.4 DD "Motor_Status"
-    
-    // CN1 (모터 FSM) 실행 (SA PDF p.24-25 Process 2.1)
+    sys->cleaner_trigger = bus_read(sys, signal_cleaner_trigger);
     cn1_motor_fsm(&sys->cn1, &sys->sensors, sys->cleaner_trigger);
-    
-    // CN2 (청소기 FSM) 실행 (SA PDF p.26-27 Process 2.2)
-    cn2_cleaner_fsm(&sys->cn2, sys->sensors.dust, sys->motor_status_moving);
+    bus_write(sys, signal_motor_status, sys->cn1.state == MOTOR_MOVING);
 }
 
+// CN2 노드 (SA PDF p.26-27 Process 2.2)
+void cn2_node(RVCSystem *sys) {
+    sys->motor_status_moving = bus_read(sys, signal_motor_status);
+    cn2_cleaner_fsm(&sys->cn2, (sys->sensors & SENSOR_DUST) != 0, sys->motor_status_moving);
+    bus_write(sys, signal_cleaner_trigger, sys->cn2.state == CLEANER_POWERUP);
+}
+
+// 제어 노드와 신호 등록 (SA PDF p.8 "CN 간 상호작용")
+// SRS PDF p.3 FR-2.2 "상호 인터페이스는 Cleaner_Trigger와 Motor_Status"
+// 두 신호 모두 다음 tick 전달 → CN1/CN2는 서로의 지난 tick 상태만 보므로 실행 순서와 무관
+// 노드 추가: bus_add_node + 신호 생산/소비 선언 (같은 tick에 읽으면 BUS_SAME_TICK)
+bool control_init(void) {
+    ControlBus *bus = &control_bus;
+    bus_init(bus);
+    int cn1 = bus_add_node(bus, "CN1", cn1_node);
+    int cn2 = bus_add_node(bus, "CN2", cn2_node);
+    signal_cleaner_trigger = bus_add_signal(bus, "Cleaner_Trigger", BUS_BOOL);
+    signal_motor_status = bus_add_signal(bus, "Motor_Status", BUS_BOOL);
+    if (cn1 < 0 || cn2 < 0 || signal_cleaner_trigger < 0 || signal_motor_status < 0) {
+        return false;
+    }
+
+    // 등록 오류(형식 불일치, 중복 생산 노드)는 bus_produce가 출력, 버스 없이 실행하지 않음
+    if (!bus_produce(bus, cn2, signal_cleaner_trigger, BUS_BOOL) ||
+        !bus_produce(bus, cn1, signal_motor_status, BUS_BOOL)) {
+        return false;
+    }
+    bus_consume(bus, cn1, signal_cleaner_trigger, BUS_NEXT_TICK);
+    bus_consume(bus, cn2, signal_motor_status, BUS_NEXT_TICK);
+    return bus_finalize(bus);
+}
+
+// 제어 로직 (SA PDF p.8 "CN 간 상호작용")
+// 등록된 노드를 실행 순서대로 1 tick 실행하고 이번 tick에 쓴 신호를 게시
+void control_logic(RVCSystem *sys) {
+    bus_run_tick(&control_bus, sys);
+}
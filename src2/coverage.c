@@ -0,0 +1,104 @@
+/* ========== 청소 범위 비트맵 (청소한 칸 / 재청소 / 90% 도달 시간) ========== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "types.h"
+
+// 함수 선언
+size_t grid_word(const GridMap *map, int x, int y);
+unsigned long long grid_tile(const GridMap *map, size_t word);
+unsigned long long grid_tile_cols(int tx, int x0, int x1);
+unsigned long long grid_tile_rows(int ty, int y0, int y1);
+
+bool coverage_init(CoverageMap *cov, const GridMap *map) {
+    cov->cleaned = calloc((size_t)map->words, sizeof(unsigned long long));
+    cov->cleaned_cells = 0;
+    cov->swept_cells = 0;
+    cov->recleaned_cells = 0;
+    cov->ticks = 0;
+    cov->tick_90 = -1;
+    cov->time_90_us = 0;
+    cov->time_us = 0;
+    cov->prev_x = 0;
+    cov->prev_y = 0;
+    cov->prev_valid = false;
+    return cov->cleaned != NULL;
+}
+
+void coverage_free(CoverageMap *cov) {
+    free(cov->cleaned);
+    cov->cleaned = NULL;
+}
+
+// 흡입구 footprint 하나 반영: 걸친 타일마다 워드 마스크를 OR하고 바뀐 비트만 popcount
+// footprint 크기에만 비례 (지도 크기와 무관, 지도를 다시 세지 않음)
+// prev_valid면 직전 tick footprint (px, py)와 겹치는 칸은 같은 통과로 보고 재청소에서 제외, 장애물 칸은 세지 않음
+void coverage_sweep(CoverageMap *cov, const GridMap *map, int x, int y,
+                    int px, int py, bool prev_valid) {
+    if (prev_valid && x == px && y == py) {
+        return;     // 제자리 (회전/막힘): footprint가 직전과 같아 새로 지나간 칸 없음
+    }
+    int r = ENV_NOZZLE_MM / 2 / map->cell_mm;
+    int x0 = x - r < 0 ? 0 : x - r;
+    int x1 = x + r > map->width ? map->width : x + r;
+    int y0 = y - r < 0 ? 0 : y - r;
+    int y1 = y + r > map->height ? map->height : y + r;
+    int px0 = px - r, px1 = px + r;
+    int py0 = prev_valid ? py - r : 0;
+    int py1 = prev_valid ? py + r : 0;
+
+    for (int ty = y0 >> GRID_TILE_BITS; ty <= (y1 - 1) >> GRID_TILE_BITS; ty++) {
+        unsigned long long rows = grid_tile_rows(ty, y0, y1);
+        unsigned long long prev_rows = grid_tile_rows(ty, py0, py1);
+        for (int tx = x0 >> GRID_TILE_BITS; tx <= (x1 - 1) >> GRID_TILE_BITS; tx++) {
+            size_t w = grid_word(map, tx << GRID_TILE_BITS, ty << GRID_TILE_BITS);
+            unsigned long long m = grid_tile_cols(tx, x0, x1) & rows & ~grid_tile(map, w);
+            m &= ~(grid_tile_cols(tx, px0, px1) & prev_rows);
+            unsigned long long old = cov->cleaned[w];
+            int swept = __builtin_popcountll(m);
+            int recleaned = __builtin_popcountll(m & old);
+            cov->swept_cells += swept;
+            cov->recleaned_cells += recleaned;
+            cov->cleaned_cells += swept - recleaned;
+            cov->cleaned[w] = old | m;
+        }
+    }
+}
+
+// tick 마감: tick 수와 시각을 갱신하고 빈 칸의 90%를 처음 넘었는지 확인
+void coverage_tick(CoverageMap *cov, const GridMap *map, long long time_us) {
+    cov->ticks++;
+    cov->time_us = time_us;
+    if (cov->tick_90 < 0 && cov->cleaned_cells * 10 >= map->free_cells * 9) {
+        cov->tick_90 = cov->ticks;
+        cov->time_90_us = time_us;
+    }
+}
+
+// 로봇 1대의 1 tick 갱신 (직전 footprint는 cov에 보관)
+void coverage_update(CoverageMap *cov, const GridMap *map, int x, int y,
+                     bool cleaning, long long time_us) {
+    if (cleaning) {
+        coverage_sweep(cov, map, x, y, cov->prev_x, cov->prev_y, cov->prev_valid);
+        cov->prev_x = x;
+        cov->prev_y = y;
+    }
+    cov->prev_valid = cleaning;
+    coverage_tick(cov, map, time_us);
+}
+
+// 청소 범위 / 재청소 비율 / 90% 도달 시간 / 분당 청소 면적 출력
+void coverage_report(const CoverageMap *cov, const GridMap *map) {
+    double cell_m2 = (double)map->cell_mm * map->cell_mm / 1e6;
+    double minutes = cov->time_us / 60e6;
+    printf("Coverage: %.1f%% of free floor (%.2f m^2), re-clean ratio %.1f%%, ",
+           map->free_cells ? 100.0 * cov->cleaned_cells / map->free_cells : 0.0,
+           cov->cleaned_cells * cell_m2,
+           cov->swept_cells ? 100.0 * cov->recleaned_cells / cov->swept_cells : 0.0);
+    if (cov->tick_90 >= 0) {
+        printf("90%% at tick %lld (%.1f s), ", cov->tick_90, cov->time_90_us / 1e6);
+    } else {
+        printf("90%% not reached in %lld ticks, ", cov->ticks);
+    }
+    printf("%.2f m^2/min\n", minutes > 0 ? cov->cleaned_cells * cell_m2 / minutes : 0.0);
+}
@@ -0,0 +1,150 @@
+/* ========== 바닥 먼지 밀도 (타일 단위 희소 저장) ========== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "types.h"
+
+#define DUST_PATCHES 30             // 방에 뿌리는 먼지 덩어리 수
+#define DUST_PATCH_MIN_MM 100       // 덩어리 반지름
+#define DUST_PATCH_MAX_MM 400
+#define DUST_PATCH_MIN_PEAK 64      // 덩어리 중심 밀도
+#define DUST_STREAM 0xD57           // 먼지 배치 난수 스트림 (지도/센서 스트림과 겹치지 않게)
+
+// 함수 선언
+unsigned long long rng_next(RngState *rng);
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+int grid_occupied(const GridMap *map, int x, int y);
+
+bool dust_init(DustField *dust, const GridMap *map) {
+    dust->tiles_x = (map->width + DUST_TILE - 1) >> DUST_TILE_BITS;
+    dust->tiles_y = (map->height + DUST_TILE - 1) >> DUST_TILE_BITS;
+    dust->tiles = calloc((size_t)dust->tiles_x * dust->tiles_y, sizeof(unsigned char *));
+    dust->tile_dust = calloc((size_t)dust->tiles_x * dust->tiles_y, sizeof(unsigned int));
+    dust->live_tiles = 0;
+    dust->peak_tiles = 0;
+    dust->deposited = 0;
+    dust->removed = 0;
+    dust->detections = 0;
+    return dust->tiles != NULL && dust->tile_dust != NULL;
+}
+
+void dust_free(DustField *dust) {
+    if (dust->tiles) {
+        for (int t = 0; t < dust->tiles_x * dust->tiles_y; t++) {
+            free(dust->tiles[t]);
+        }
+    }
+    free(dust->tiles);
+    free(dust->tile_dust);
+    dust->tiles = NULL;
+    dust->tile_dust = NULL;
+}
+
+// 칸 조회: 타일이 없거나 지도 밖이면 0
+int dust_at(const DustField *dust, int x, int y) {
+    int tx = x >> DUST_TILE_BITS, ty = y >> DUST_TILE_BITS;
+    if ((unsigned)tx >= (unsigned)dust->tiles_x || (unsigned)ty >= (unsigned)dust->tiles_y) {
+        return 0;
+    }
+    const unsigned char *tile = dust->tiles[ty * dust->tiles_x + tx];
+    return tile ? tile[((y & (DUST_TILE - 1)) << DUST_TILE_BITS) | (x & (DUST_TILE - 1))] : 0;
+}
+
+// 칸에 먼지 추가 (255에서 포화), 타일이 없으면 할당
+bool dust_add(DustField *dust, int x, int y, int amount) {
+    int t = (y >> DUST_TILE_BITS) * dust->tiles_x + (x >> DUST_TILE_BITS);
+    if (!dust->tiles[t]) {
+        dust->tiles[t] = calloc(DUST_TILE * DUST_TILE, 1);
+        if (!dust->tiles[t]) {
+            return false;
+        }
+        if (++dust->live_tiles > dust->peak_tiles) {
+            dust->peak_tiles = dust->live_tiles;
+        }
+    }
+    unsigned char *cell = &dust->tiles[t][((y & (DUST_TILE - 1)) << DUST_TILE_BITS) | (x & (DUST_TILE - 1))];
+    int add = *cell + amount > 255 ? 255 - *cell : amount;
+    *cell += add;
+    dust->tile_dust[t] += add;
+    dust->deposited += add;
+    return true;
+}
+
+// 시드로 먼지 덩어리 배치: 중심에서 멀어질수록 옅어지는 원 (장애물 칸 제외)
+// 덩어리가 닿는 타일만 할당되므로 나머지 바닥은 메모리를 쓰지 않음
+bool dust_scatter(DustField *dust, const GridMap *map, unsigned long long seed) {
+    RngState rng;
+    rng_seed(&rng, seed, DUST_STREAM);
+    int span = (DUST_PATCH_MAX_MM - DUST_PATCH_MIN_MM) / map->cell_mm;
+    for (int p = 0; p < DUST_PATCHES; p++) {
+        unsigned long long r = rng_next(&rng);
+        int radius = DUST_PATCH_MIN_MM / map->cell_mm + (int)(r % (span + 1));
+        int peak = DUST_PATCH_MIN_PEAK + (int)((r >> 16) % (256 - DUST_PATCH_MIN_PEAK));
+        int cx = (int)((r >> 32) % (unsigned)map->width);
+        int cy = (int)((r >> 48) % (unsigned)map->height);
+        long long r2 = (long long)radius * radius;
+        for (int y = cy - radius; y <= cy + radius; y++) {
+            for (int x = cx - radius; x <= cx + radius; x++) {
+                long long d2 = (long long)(x - cx) * (x - cx) + (long long)(y - cy) * (y - cy);
+                if (d2 >= r2 || grid_occupied(map, x, y)) {
+                    continue;   // 덩어리 밖, 지도 밖, 장애물
+                }
+                int amount = (int)(peak * (r2 - d2) / r2);
+                if (amount > 0 && !dust_add(dust, x, y, amount)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// 흡입구 footprint의 먼지를 칸마다 pickup만큼 제거
+// 타일 단위로 잘라 순회하고 먼지 없는 타일은 건너뜀, 다 치운 타일은 해제
+void dust_clean(DustField *dust, const GridMap *map, int x, int y, int pickup) {
+    int r = ENV_NOZZLE_MM / 2 / map->cell_mm;
+    int x0 = x - r < 0 ? 0 : x - r;
+    int x1 = x + r > map->width ? map->width : x + r;
+    int y0 = y - r < 0 ? 0 : y - r;
+    int y1 = y + r > map->height ? map->height : y + r;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    for (int ty = y0 >> DUST_TILE_BITS; ty <= (y1 - 1) >> DUST_TILE_BITS; ty++) {
+        for (int tx = x0 >> DUST_TILE_BITS; tx <= (x1 - 1) >> DUST_TILE_BITS; tx++) {
+            int t = ty * dust->tiles_x + tx;
+            unsigned char *tile = dust->tiles[t];
+            if (!tile) {
+                continue;
+            }
+            int cx0 = x0 > tx * DUST_TILE ? x0 : tx * DUST_TILE;
+            int cx1 = x1 < (tx + 1) * DUST_TILE ? x1 : (tx + 1) * DUST_TILE;
+            int cy0 = y0 > ty * DUST_TILE ? y0 : ty * DUST_TILE;
+            int cy1 = y1 < (ty + 1) * DUST_TILE ? y1 : (ty + 1) * DUST_TILE;
+            unsigned int taken = 0;
+            for (int cy = cy0; cy < cy1; cy++) {
+                unsigned char *row = &tile[(cy & (DUST_TILE - 1)) << DUST_TILE_BITS];
+                for (int cx = cx0; cx < cx1; cx++) {
+                    unsigned char *cell = &row[cx & (DUST_TILE - 1)];
+                    int take = *cell < pickup ? *cell : pickup;
+                    *cell -= take;
+                    taken += take;
+                }
+            }
+            dust->tile_dust[t] -= taken;
+            dust->removed += taken;
+            if (dust->tile_dust[t] == 0) {
+                free(tile);
+                dust->tiles[t] = NULL;
+                dust->live_tiles--;
+            }
+        }
+    }
+}
+
+void dust_report(const DustField *dust) {
+    printf("Dust: %.1f%% of %lld units removed, sensor on %lld ticks, tiles %d live / %d peak of %d (%d KB peak)\n",
+           dust->deposited ? 100.0 * dust->removed / dust->deposited : 0.0, dust->deposited,
+           dust->detections, dust->live_tiles, dust->peak_tiles, dust->tiles_x * dust->tiles_y,
+           dust->peak_tiles * DUST_TILE * DUST_TILE / 1024);
+}
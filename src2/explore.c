@@ -0,0 +1,625 @@
+/* ========== 상태 공간 탐색 (Deadlock / Livelock 검사) ========== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "types.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#define EXPLORE_ATOMIC _Atomic
+#else
+#define EXPLORE_ATOMIC          // _WIN32: 단일 스레드 탐색
+#endif
+
+#define EXPLORE_WORDS 16                        // 센서 워드 (Front/Left/Right/Dust)
+#define EXPLORE_MAX_NODES (1 << 20)             // 방문 집합에 담을 수 있는 구성 수
+#define EXPLORE_SLOTS (EXPLORE_MAX_NODES * 2)   // 해시 칸 수 (적재율 1/2 이하)
+#define EXPLORE_CHUNK 64                        // 스레드가 frontier에서 한 번에 가져가는 구성 수
+#define EXPLORE_MAX_THREADS 256
+
+// 함수 선언
+void control_logic(RVCSystem *sys);
+void evlog_mute(bool muted);
+int pool_cpu_count(void);
+long long monotonic_us(void);
+const char *motor_command_name(int cmd);
+const char *cleaner_command_name(int cmd);
+
+// 탐색 상태
+// 구성(configuration) = control_logic이 읽고 쓰는 RVCSystem 필드(CN1 + CN2 + 버스 신호) 전체를
+// 64비트 키로 압축한 것
+// 구성 번호는 발견 순서이므로 BFS 깊이 d의 frontier는 항상 번호가 연속인 구간
+typedef struct {
+    EXPLORE_ATOMIC unsigned long long *keys;    // 해시 칸: 0 = 빈 칸, 그 외 = 키 + 1
+    EXPLORE_ATOMIC int *ids;                    // 칸별 구성 번호 (-1: 삽입한 스레드가 기록 전)
+    unsigned long long *nodes;  // 구성 번호 → 키
+    int *succ;                  // [구성 × 센서 워드] → 다음 구성 번호
+    int *parent;                // 처음 발견한 이전 구성 (최단 경로 복원용)
+    unsigned char *parent_word;
+    EXPLORE_ATOMIC int count;   // 발견한 구성 수
+    EXPLORE_ATOMIC int next;    // 현재 frontier에서 다음에 가져갈 구성
+    EXPLORE_ATOMIC bool overflow;   // 구성 수 한계 또는 키 인코딩 범위 초과
+    int level_begin;            // 현재 frontier [level_begin, level_end)
+    int level_end;
+    int depth;
+    bool done;
+    int threads;
+#ifndef _WIN32
+    pthread_barrier_t barrier;
+#endif
+} StateExplorer;
+
+int explore_fetch_add(EXPLORE_ATOMIC int *p, int n) {
+#ifndef _WIN32
+    return atomic_fetch_add(p, n);
+#else
+    int old = *p;
+    *p += n;
+    return old;
+#endif
+}
+
+bool explore_claim(EXPLORE_ATOMIC unsigned long long *slot, unsigned long long *expected,
+                   unsigned long long key) {
+#ifndef _WIN32
+    return atomic_compare_exchange_strong(slot, expected, key);
+#else
+    if (*slot != *expected) {
+        *expected = *slot;
+        return false;
+    }
+    *slot = key;
+    return true;
+#endif
+}
+
+// 제어 버스 신호 하나가 키에서 차지하는 비트 수 (형식별, 불리언은 1비트)
+int explore_signal_bits(const BusSignal *sig) {
+    return sig->type == BUS_BOOL ? 1 : BUS_INT_BITS;
+}
+
+// 구성 → 키 (범위를 벗어나면 false)
+// 제어 버스에 게시된 신호 값(다음 tick에 읽힘)은 신호 번호 순서로 비트 46부터 형식별 너비로
+// (키는 63비트까지: 방문 집합이 키 + 1을 저장하고 0을 빈 칸으로 씀)
+// CN1/CN2 state_duration은 상태의 타이머 한계에서 포화: 두 FSM 모두 "한계 이상" 여부만 보므로
+// 한계를 넘은 값들은 같은 구성 (타이머 없는 상태는 항상 0)
+bool explore_encode(const RVCSystem *sys, unsigned long long *key) {
+    int limit = fsm_cn1_timer_limit[sys->cn1.state];
+    int duration = sys->cn1.state_duration < limit ? sys->cn1.state_duration : limit;
+    int limit2 = fsm_cn2_timer_limit[sys->cn2.state];
+    int duration2 = sys->cn2.state_duration < limit2 ? sys->cn2.state_duration : limit2;
+    if (sys->cn1.backward_timer < -128 || sys->cn1.backward_timer > 127 ||
+        sys->cn2.powerup_timer < -128 || sys->cn2.powerup_timer > 127) {
+        return false;
+    }
+    unsigned long long published = 0;
+    int shift = 0;
+    for (int s = 0; s < control_bus.signal_count; s++) {
+        int bits = explore_signal_bits(&control_bus.signals[s]);
+        int value = sys->bus.value[sys->bus.front][s];
+        if (value < 0 || value >= 1 << bits || 46 + shift + bits > 63) {
+            return false;
+        }
+        published |= (unsigned long long)value << shift;
+        shift += bits;
+    }
+    *key = (unsigned long long)sys->cn1.state
+        | (unsigned long long)sys->cn1.command << 3
+        | (unsigned long long)duration << 6
+        | (unsigned long long)(sys->cn1.backward_timer + 128) << 14
+        | (unsigned long long)sys->cn1.cleaner_trigger_received << 22
+        | (unsigned long long)sys->cn2.state << 23
+        | (unsigned long long)sys->cn2.command << 25
+        | (unsigned long long)(sys->cn2.powerup_timer + 128) << 27
+        | (unsigned long long)sys->cn2.motor_is_moving << 35
+        | (unsigned long long)sys->cleaner_trigger << 36
+        | (unsigned long long)sys->motor_status_moving << 37
+        | (unsigned long long)duration2 << 38
+        | published << 46;
+    return true;
+}
+
+void explore_decode(unsigned long long key, RVCSystem *sys) {
+    sys->cn1.state = (MotorState)(key & 7);
+    sys->cn1.command = (MotorCommand)((key >> 3) & 7);
+    sys->cn1.state_duration = (int)((key >> 6) & 0xFF);
+    sys->cn1.backward_timer = (int)((key >> 14) & 0xFF) - 128;
+    sys->cn1.cleaner_trigger_received = (key >> 22) & 1;
+    sys->cn2.state = (CleanerState)((key >> 23) & 3);
+    sys->cn2.command = (CleanerCommand)((key >> 25) & 3);
+    sys->cn2.powerup_timer = (int)((key >> 27) & 0xFF) - 128;
+    sys->cn2.motor_is_moving = (key >> 35) & 1;
+    sys->cleaner_trigger = (key >> 36) & 1;
+    sys->motor_status_moving = (key >> 37) & 1;
+    sys->cn2.state_duration = (int)((key >> 38) & 0xFF);
+    sys->bus.front = 0;
+    int shift = 46;
+    for (int s = 0; s < control_bus.signal_count; s++) {
+        int bits = explore_signal_bits(&control_bus.signals[s]);
+        sys->bus.value[0][s] = (int)((key >> shift) & ((1u << bits) - 1));
+        shift += bits;
+    }
+}
+
+// CN1이 전진(Moving) 중인 구성 = 진행(progress)
+bool explore_progress(unsigned long long key) {
+    return (key & 7) == MOTOR_MOVING;
+}
+
+void explore_print_node(const StateExplorer *ex, int id) {
+    const char *motor_states[] = {
+        "IDLE", "MOVING", "TURNING", "BACKWARDING", "PAUSED"
+    };
+    const char *cleaner_states[] = {
+        "OFF", "NORMAL", "POWERUP"
+    };
+    RVCSystem sys;
+    explore_decode(ex->nodes[id], &sys);
+    printf("CN1 %s duration=%d back_timer=%d motor=%s | CN2 %s duration=%d powerup_timer=%d cleaner=%s",
+           motor_states[sys.cn1.state], sys.cn1.state_duration, sys.cn1.backward_timer,
+           motor_command_name(sys.cn1.command), cleaner_states[sys.cn2.state],
+           sys.cn2.state_duration, sys.cn2.powerup_timer, cleaner_command_name(sys.cn2.command));
+}
+
+// 시작 구성에서 id까지의 최단 센서 입력열
+void explore_print_path(const StateExplorer *ex, int id) {
+    unsigned char words[256];
+    int n = 0;
+    for (int v = id; ex->parent[v] >= 0 && n < 256; v = ex->parent[v]) {
+        words[n++] = ex->parent_word[v];
+    }
+    printf("    reached in %d ticks, sensor words:", n);
+    while (n > 0) {
+        printf(" 0x%X", words[--n]);
+    }
+    printf("\n");
+}
+
+// 방문 집합에 키를 넣고 구성 번호를 반환 (이미 있으면 기존 번호)
+// 선형 탐사 + CAS: 칸을 먼저 차지한 스레드만 번호를 발급하고 나머지는 번호 기록을 기다림
+int explore_insert(StateExplorer *ex, unsigned long long key, int from, int word) {
+    unsigned long long slot = (key + 1) * 0x9E3779B97F4A7C15ULL;
+    unsigned long long h = (slot >> 32) & (EXPLORE_SLOTS - 1);
+
+    for (;;) {
+        unsigned long long seen = 0;
+        if (explore_claim(&ex->keys[h], &seen, key + 1)) {
+            int id = explore_fetch_add(&ex->count, 1);
+            if (id >= EXPLORE_MAX_NODES) {
+                ex->overflow = true;
+                id = EXPLORE_MAX_NODES;     // 번호 없음 (탐색은 실패로 끝남)
+            } else {
+                ex->nodes[id] = key;
+                ex->parent[id] = from;
+                ex->parent_word[id] = (unsigned char)word;
+            }
+            ex->ids[h] = id;
+            return id;
+        }
+        if (seen == key + 1) {
+            int id;
+            while ((id = ex->ids[h]) < 0) {
+                // 다른 스레드가 방금 차지한 칸: 번호 기록까지 짧게 대기
+            }
+            return id;
+        }
+        h = (h + 1) & (EXPLORE_SLOTS - 1);
+    }
+}
+
+// 구성 하나를 모든 센서 워드로 1 tick 실행 (실제 control_logic 사용: CN1 → CN2 순서와 상호 신호 포함)
+void explore_expand(StateExplorer *ex, int id) {
+    RVCSystem sys = {0};
+    explore_decode(ex->nodes[id], &sys);
+    for (int w = 0; w < EXPLORE_WORDS; w++) {
+        RVCSystem next = sys;
+        unsigned long long key;
+        next.sensors = (SensorData)w;
+        control_logic(&next);
+        if (!explore_encode(&next, &key)) {
+            ex->overflow = true;
+            ex->succ[id * EXPLORE_WORDS + w] = id;
+            continue;
+        }
+        ex->succ[id * EXPLORE_WORDS + w] = explore_insert(ex, key, id, w);
+    }
+}
+
+// 현재 frontier를 chunk 단위로 가져가며 확장
+void explore_level(StateExplorer *ex) {
+    int begin;
+    while ((begin = explore_fetch_add(&ex->next, EXPLORE_CHUNK)) < ex->level_end) {
+        int end = begin + EXPLORE_CHUNK < ex->level_end ? begin + EXPLORE_CHUNK : ex->level_end;
+        for (int id = begin; id < end; id++) {
+            explore_expand(ex, id);
+        }
+    }
+}
+
+// 깊이 하나가 끝난 뒤 다음 frontier 설정 (한 스레드만 호출)
+void explore_next_level(StateExplorer *ex) {
+    int count = ex->count < EXPLORE_MAX_NODES ? ex->count : EXPLORE_MAX_NODES;
+    ex->level_begin = ex->level_end;
+    ex->level_end = count;
+    ex->next = ex->level_begin;
+    ex->done = ex->level_begin == ex->level_end || ex->overflow;
+    ex->depth += !ex->done;
+}
+
+#ifndef _WIN32
+
+// 깊이 단위 동기 BFS: barrier로 깊이를 맞추고 스레드 0이 다음 frontier를 설정
+void explore_worker_loop(StateExplorer *ex, int id) {
+    for (;;) {
+        pthread_barrier_wait(&ex->barrier);     // 깊이 시작
+        if (ex->done) {
+            break;
+        }
+        explore_level(ex);
+        pthread_barrier_wait(&ex->barrier);     // 깊이 끝: frontier 전체 확장 완료
+        if (id == 0) {
+            explore_next_level(ex);
+        }
+    }
+}
+
+typedef struct {
+    StateExplorer *ex;
+    int id;
+} ExploreThreadArg;
+
+void *explore_thread_main(void *arg) {
+    ExploreThreadArg *a = arg;
+    explore_worker_loop(a->ex, a->id);
+    return NULL;
+}
+
+#endif
+
+// 시작 구성(initialize_system과 같은 값)에서 도달 가능한 모든 구성을 BFS로 탐색
+void explore_bfs(StateExplorer *ex) {
+    RVCSystem init = {0};
+    unsigned long long key;
+    init.cn1.state = MOTOR_IDLE;
+    init.cn1.command = CMD_STOP;
+    init.cn2.state = CLEANER_OFF;
+    init.cn2.command = CMD_OFF;
+    explore_encode(&init, &key);
+    explore_insert(ex, key, -1, 0);
+
+    ex->level_begin = 0;
+    ex->level_end = 1;
+    ex->next = 0;
+    ex->depth = 0;
+    ex->done = false;
+
+#ifndef _WIN32
+    if (ex->threads > 1) {
+        pthread_t tids[EXPLORE_MAX_THREADS];
+        ExploreThreadArg args[EXPLORE_MAX_THREADS];
+        pthread_barrier_init(&ex->barrier, NULL, ex->threads);
+        for (int t = 1; t < ex->threads; t++) {
+            args[t].ex = ex;
+            args[t].id = t;
+            pthread_create(&tids[t], NULL, explore_thread_main, &args[t]);
+        }
+        explore_worker_loop(ex, 0);
+        for (int t = 1; t < ex->threads; t++) {
+            pthread_join(tids[t], NULL);
+        }
+        pthread_barrier_destroy(&ex->barrier);
+        return;
+    }
+#endif
+    ex->threads = 1;
+    while (!ex->done) {
+        explore_level(ex);
+        explore_next_level(ex);
+    }
+}
+
+// 진행(CN1 Moving) 구성을 뺀 부분 그래프의 강연결요소(SCC) 분해 (Tarjan, 재귀 대신 명시적 스택)
+// 이 그래프의 순환 = CN1 Moving을 한 번도 거치지 않고 계속 돌 수 있는 구성열
+// comp[v]: v가 속한 SCC 번호 (진행 구성은 -1), 반환값은 SCC 수 (실패 시 -1)
+int explore_scc(const StateExplorer *ex, int n, int *comp) {
+    int *index = malloc(sizeof(int) * n);
+    int *low = malloc(sizeof(int) * n);
+    int *stack = malloc(sizeof(int) * n);
+    int *call_node = malloc(sizeof(int) * n);
+    int *call_edge = malloc(sizeof(int) * n);
+    bool *on_stack = calloc(n, sizeof(bool));
+    int comps = -1;
+
+    if (index && low && stack && call_node && call_edge && on_stack) {
+        int counter = 0, sp = 0;
+        comps = 0;
+        for (int v = 0; v < n; v++) {
+            index[v] = -1;
+            comp[v] = -1;
+        }
+        for (int root = 0; root < n; root++) {
+            if (index[root] >= 0 || explore_progress(ex->nodes[root])) {
+                continue;
+            }
+            int cp = 0;
+            index[root] = low[root] = counter++;
+            stack[sp++] = root;
+            on_stack[root] = true;
+            call_node[cp] = root;
+            call_edge[cp++] = 0;
+
+            while (cp > 0) {
+                int v = call_node[cp - 1];
+                if (call_edge[cp - 1] < EXPLORE_WORDS) {
+                    int w = ex->succ[v * EXPLORE_WORDS + call_edge[cp - 1]++];
+                    if (explore_progress(ex->nodes[w])) {
+                        continue;
+                    }
+                    if (index[w] < 0) {
+                        index[w] = low[w] = counter++;
+                        stack[sp++] = w;
+                        on_stack[w] = true;
+                        call_node[cp] = w;
+                        call_edge[cp++] = 0;
+                    } else if (on_stack[w] && index[w] < low[v]) {
+                        low[v] = index[w];
+                    }
+                    continue;
+                }
+                cp--;
+                if (cp > 0 && low[v] < low[call_node[cp - 1]]) {
+                    low[call_node[cp - 1]] = low[v];
+                }
+                if (low[v] == index[v]) {
+                    int w;
+                    do {
+                        w = stack[--sp];
+                        on_stack[w] = false;
+                        comp[w] = comps;
+                    } while (w != v);
+                    comps++;
+                }
+            }
+        }
+    }
+
+    free(index);
+    free(low);
+    free(stack);
+    free(call_node);
+    free(call_edge);
+    free(on_stack);
+    return comps;
+}
+
+// 장애물/먼지가 없는 입력(워드 0)만 계속 들어올 때 진행 구성까지의 tick 수
+// -1: 진행 없이 순환 (길이 트인 상황에서의 livelock)
+void explore_clear_path(const StateExplorer *ex, int n, int *dist) {
+    int *path = malloc(sizeof(int) * n);
+    for (int v = 0; v < n; v++) {
+        dist[v] = explore_progress(ex->nodes[v]) ? 0 : -2;     // -2: 미확인
+    }
+    for (int v = 0; v < n && path; v++) {
+        int len = 0, u = v;
+        while (dist[u] == -2) {
+            dist[u] = -3;       // 현재 경로 위
+            path[len++] = u;
+            u = ex->succ[u * EXPLORE_WORDS];
+        }
+        int d = dist[u] == -3 ? -1 : dist[u];
+        while (len > 0) {
+            u = path[--len];
+            dist[u] = d < 0 ? -1 : ++d;
+        }
+    }
+    free(path);
+}
+
+// 탐색 결과 분석과 보고
+// - 도달 불가 상태: 어떤 센서 입력열로도 들어가지 않는 CN1 / CN2 상태와 (CN1, CN2) 조합
+// - Deadlock / Livelock: CN1 Moving 없는 순환 중 빠져나가는 전이가 없는(닫힌) 것
+//   → 센서 입력이 무엇이든 다시는 전진하지 못함 (SRS PDF p.5 "Pause: Stop과 달리 Deadlock 회피")
+// - 센서 의존 순환: CN1 Moving 없이 돌 수 있지만 입력에 따라 빠져나갈 수 있는 순환 (장애물이 계속될 때)
+// - 길 트임 복귀: 장애물/먼지가 없으면 모든 구성이 유한 tick 안에 CN1 Moving으로 돌아오는지
+int explore_report(const StateExplorer *ex, long long elapsed_us) {
+    const char *motor_states[] = {
+        "IDLE", "MOVING", "TURNING", "BACKWARDING", "PAUSED"
+    };
+    const char *cleaner_states[] = {
+        "OFF", "NORMAL", "POWERUP"
+    };
+    int n = ex->count;
+    int *comp = malloc(sizeof(int) * n);
+    int *dist = malloc(sizeof(int) * n);
+    int comps = comp && dist ? explore_scc(ex, n, comp) : -1;
+    if (comps < 0) {
+        fprintf(stderr, "Explorer: analysis allocation failed (%d configurations)\n", n);
+        free(comp);
+        free(dist);
+        return 1;
+    }
+    // comps가 0이어도 할당 크기가 0이 되지 않도록 + 1
+    int *size = calloc(comps + 1, sizeof(int));
+    int *example = malloc(sizeof(int) * (comps + 1));
+    bool *closed = malloc(sizeof(bool) * (comps + 1));
+    bool *cyclic = calloc(comps + 1, sizeof(bool));
+    bool reached[5][3] = {{false}};    // [CN1 상태][CN2 상태]
+    int failures = 0;
+
+    for (int c = 0; c < comps; c++) {
+        closed[c] = true;
+        example[c] = -1;
+    }
+    for (int v = 0; v < n; v++) {
+        int c = comp[v];
+        reached[ex->nodes[v] & 7][(ex->nodes[v] >> 23) & 3] = true;
+        if (c < 0) {
+            continue;
+        }
+        size[c]++;
+        if (example[c] < 0) {
+            example[c] = v;     // BFS 순서 → 시작 구성에서 가장 가까운 구성
+        }
+        for (int w = 0; w < EXPLORE_WORDS; w++) {
+            int u = ex->succ[v * EXPLORE_WORDS + w];
+            closed[c] &= comp[u] == c;
+            cyclic[c] |= comp[u] == c;
+        }
+    }
+    explore_clear_path(ex, n, dist);
+
+    printf("=== State Space Exploration: V2 control_logic (CN1 x CN2) ===\n");
+    printf("Threads: %d, BFS depth: %d, time: %.1f ms\n",
+           ex->threads, ex->depth, elapsed_us / 1000.0);
+    printf("Reachable configurations: %d (x %d sensor words = %lld transitions)\n",
+           n, EXPLORE_WORDS, (long long)n * EXPLORE_WORDS);
+
+    printf("Unreachable states:");
+    int unreachable = 0;
+    for (int s1 = 0; s1 < 5; s1++) {
+        bool any = false;
+        for (int s2 = 0; s2 < 3; s2++) {
+            any |= reached[s1][s2];
+        }
+        if (!any) {
+            printf(" CN1 %s", motor_states[s1]);
+            unreachable++;
+        }
+    }
+    for (int s2 = 0; s2 < 3; s2++) {
+        bool any = false;
+        for (int s1 = 0; s1 < 5; s1++) {
+            any |= reached[s1][s2];
+        }
+        if (!any) {
+            printf(" CN2 %s", cleaner_states[s2]);
+            unreachable++;
+        }
+    }
+    printf("%s\n", unreachable ? "" : " none");
+
+    printf("Unreachable CN1 x CN2 pairs:");
+    unreachable = 0;
+    for (int s1 = 0; s1 < 5; s1++) {
+        for (int s2 = 0; s2 < 3; s2++) {
+            if (!reached[s1][s2]) {
+                printf(" %s/%s", motor_states[s1], cleaner_states[s2]);
+                unreachable++;
+            }
+        }
+    }
+    printf("%s\n", unreachable ? "" : " none");
+
+    int deadlocks = 0, livelocks = 0, env_cycles = 0, env_nodes = 0;
+    for (int c = 0; c < comps; c++) {
+        if (!cyclic[c]) {
+            continue;
+        }
+        if (!closed[c]) {
+            env_cycles++;
+            env_nodes += size[c];
+            continue;
+        }
+        // 닫힌 SCC: 어떤 입력으로도 빠져나갈 수 없음
+        if (size[c] == 1) {
+            deadlocks++;
+            printf("DEADLOCK: ");
+        } else {
+            livelocks++;
+            printf("LIVELOCK (%d configurations): ", size[c]);
+        }
+        explore_print_node(ex, example[c]);
+        printf("\n");
+        explore_print_path(ex, example[c]);
+    }
+    printf("Deadlocks (stuck for every sensor input): %d\n", deadlocks);
+    printf("Livelocks (closed cycles never reaching CN1 MOVING): %d\n", livelocks);
+    printf("Sensor-dependent cycles without CN1 MOVING: %d SCCs, %d configurations "
+           "(persist only while obstacles persist)\n", env_cycles, env_nodes);
+
+    int stuck = 0, worst = 0, worst_node = 0;
+    for (int v = 0; v < n; v++) {
+        if (dist[v] < 0) {
+            if (stuck++ == 0) {
+                printf("NO RECOVERY on clear path: ");
+                explore_print_node(ex, v);
+                printf("\n");
+                explore_print_path(ex, v);
+            }
+        } else if (dist[v] > worst) {
+            worst = dist[v];
+            worst_node = v;
+        }
+    }
+    if (stuck > 0) {
+        printf("Clear-path recovery: %d configurations never return to CN1 MOVING\n", stuck);
+    } else {
+        printf("Clear-path recovery: every configuration returns to CN1 MOVING within %d ticks "
+               "(worst: ", worst);
+        explore_print_node(ex, worst_node);
+        printf(")\n");
+    }
+
+    failures = deadlocks + livelocks + (stuck > 0);
+    printf("Result: %s\n", failures ? "FAIL" : "PASS");
+
+    free(comp);
+    free(dist);
+    free(size);
+    free(example);
+    free(closed);
+    free(cyclic);
+    return failures ? 1 : 0;
+}
+
+// 상태 공간 탐색 모드 진입점 (--explore)
+// threads <= 0이면 모든 코어 사용, 반환값은 프로세스 종료 코드 (0: 문제 없음)
+int explore_run(int threads) {
+    StateExplorer ex;
+    int n = threads > 0 ? threads : pool_cpu_count();
+    if (n > EXPLORE_MAX_THREADS) {
+        n = EXPLORE_MAX_THREADS;
+    }
+
+    ex.keys = malloc(sizeof(*ex.keys) * EXPLORE_SLOTS);
+    ex.ids = malloc(sizeof(*ex.ids) * EXPLORE_SLOTS);
+    ex.nodes = malloc(sizeof(*ex.nodes) * EXPLORE_MAX_NODES);
+    ex.succ = malloc(sizeof(*ex.succ) * EXPLORE_MAX_NODES * EXPLORE_WORDS);
+    ex.parent = malloc(sizeof(*ex.parent) * EXPLORE_MAX_NODES);
+    ex.parent_word = malloc(EXPLORE_MAX_NODES);
+    ex.count = 0;
+    ex.overflow = false;
+    ex.threads = n;
+
+    int result = 1;
+    if (!ex.keys || !ex.ids || !ex.nodes || !ex.succ || !ex.parent || !ex.parent_word) {
+        fprintf(stderr, "Explorer allocation failed\n");
+    } else {
+        for (int h = 0; h < EXPLORE_SLOTS; h++) {
+            ex.keys[h] = 0;
+            ex.ids[h] = -1;
+        }
+        evlog_mute(true);   // 탐색 중 CN1/CN2의 전이 메시지는 출력하지 않음
+        long long t0 = monotonic_us();
+        explore_bfs(&ex);
+        long long elapsed_us = monotonic_us() - t0;
+        evlog_mute(false);
+
+        if (ex.overflow) {
+            fprintf(stderr, "Explorer: state space exceeds %d configurations or key range\n",
+                    EXPLORE_MAX_NODES);
+        } else {
+            result = explore_report(&ex, elapsed_us);
+        }
+    }
+
+    free(ex.keys);
+    free(ex.ids);
+    free(ex.nodes);
+    free(ex.succ);
+    free(ex.parent);
+    free(ex.parent_word);
+    return result;
+}
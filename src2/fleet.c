@@ -0,0 +1,195 @@
+/* ========== Fleet: 다수 로봇 일괄 실행 (SoA) ========== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "types.h"
+#include "fsm_lane.h"
+
+// 함수 선언
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
+unsigned long long rng_next(RngState *rng);
+void kin_init(KinModel *kin, int step_mm, int unit_mm);
+
+// Fleet 할당 및 초기화 (initialize_system과 같은 초기 상태)
+// 로봇 i의 센서 난수열은 (seed, i)로 결정됨
+bool fleet_init(RVCFleet *fleet, int count, unsigned long long seed) {
+    fleet->count = count;
+    fleet->cn1_state = calloc(count, sizeof(unsigned char));
+    fleet->cn1_command = calloc(count, sizeof(unsigned char));
+    fleet->cn1_state_since = calloc(count, sizeof(int));
+    fleet->cn2_state = calloc(count, sizeof(unsigned char));
+    fleet->cn2_command = calloc(count, sizeof(unsigned char));
+    fleet->cn2_state_since = calloc(count, sizeof(int));
+    fleet->sensors = calloc(count, sizeof(unsigned char));
+    fleet->rng = calloc(count, sizeof(RngState));
+    fleet->pose_x = calloc(count, sizeof(unsigned int));
+    fleet->pose_y = calloc(count, sizeof(unsigned int));
+    fleet->heading = calloc(count, sizeof(unsigned char));
+    fleet->ticks = 0;
+    kin_init(&fleet->kin, ENV_STEP_MM, 1);  // 자세 단위 1/256 mm, 모두 원점에서 +x 방향
+
+    if (!fleet->cn1_state || !fleet->cn1_command ||
+        !fleet->cn1_state_since || !fleet->cn2_state || !fleet->cn2_command ||
+        !fleet->cn2_state_since || !fleet->sensors || !fleet->rng ||
+        !fleet->pose_x || !fleet->pose_y || !fleet->heading) {
+        return false;
+    }
+
+    // SA PDF p.20 "INITIALIZE CN1_State := Idle, CN2_State := Off"
+    for (int i = 0; i < count; i++) {
+        fleet->cn1_state[i] = MOTOR_IDLE;
+        fleet->cn1_command[i] = CMD_STOP;
+        fleet->cn2_state[i] = CLEANER_OFF;
+        fleet->cn2_command[i] = CMD_OFF;
+        fleet->cn1_state_since[i] = -1;     // 첫 tick(0)에 state_duration 1
+        fleet->cn2_state_since[i] = -1;
+        rng_seed(&fleet->rng[i], seed, (unsigned long long)i);  // 로봇 번호 = 스트림
+    }
+    return true;
+}
+
+void fleet_free(RVCFleet *fleet) {
+    free(fleet->cn1_state);
+    free(fleet->cn1_command);
+    free(fleet->cn1_state_since);
+    free(fleet->cn2_state);
+    free(fleet->cn2_command);
+    free(fleet->cn2_state_since);
+    free(fleet->sensors);
+    free(fleet->rng);
+    free(fleet->pose_x);
+    free(fleet->pose_y);
+    free(fleet->heading);
+}
+
+// 센서 입력 (sensor_interface와 같은 확률 모델과 비트 분할)
+// 로봇별 카운터 기반 난수라 어느 스레드가 처리해도 로봇별 센서 열이 같음
+void fleet_sense(RVCFleet *fleet, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+        unsigned long long frame = rng_next(&fleet->rng[i]);
+        fleet->sensors[i] = (unsigned char)(
+            ((frame & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_FRONT
+            | (((frame >> 16) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_LEFT
+            | (((frame >> 32) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_RIGHT
+            | (((frame >> 48) & 0xFFFF) < SENSOR_DUST_THRESHOLD) * SENSOR_DUST);
+    }
+}
+
+// [begin, end) 구간 로봇들의 control_logic 1 tick 실행 (CN1 + CN2)
+// 전이는 fsm/fsm_spec.h에서 생성한 fsm_cn1_lane / fsm_cn2_lane (분기 없는 식)으로 계산
+// → 루프 본문에 분기가 없어 컴파일러 자동 벡터화 대상
+// 타이머는 매 tick 세지 않고 CN1/CN2가 상태에 들어간 tick만 기록 (진입 시 1회 예약, 상태가 바뀌면 덮어써 취소)
+// 만료는 "현재 tick - 진입 tick ≥ 한계" 비교 1회, 로봇당 int 배열 4개 읽기/쓰기 → 2개
+void fleet_step(RVCFleet *fleet, int begin, int end) {
+    unsigned char *cn1_state = fleet->cn1_state;
+    unsigned char *cn1_command = fleet->cn1_command;
+    int *cn1_state_since = fleet->cn1_state_since;
+    unsigned char *cn2_state = fleet->cn2_state;
+    unsigned char *cn2_command = fleet->cn2_command;
+    int *cn2_state_since = fleet->cn2_state_since;
+    const unsigned char *sensors = fleet->sensors;
+    int now = fleet->ticks;
+
+    // 배열끼리 겹치지 않으므로 별칭 검사 없이 벡터화하도록 지시
+    #pragma GCC ivdep
+    for (int i = begin; i < end; i++) {
+        int s1 = cn1_state[i];
+        int s2 = cn2_state[i];
+        int w = sensors[i];
+
+        // control_logic: 이번 tick 시작 시점의 상태로 신호 결정
+        int trigger = s2 == CLEANER_POWERUP;      // SA PDF p.8 "Cleaner_Trigger"
+        int motor_moving = s1 == MOTOR_MOVING;    // SRS PDF p.4 DD "Motor_Status"
+
+        // ---- CN1 (cn1_motor_fsm과 같은 입력 워드와 타이머) ----
+        int since1 = cn1_state_since[i];
+        FsmLane e1 = fsm_cn1_lane(s1, w | trigger << 4, now - since1, cn1_command[i], 0);
+
+        // ---- CN2 (cn2_cleaner_fsm과 같은 입력 워드와 타이머) ----
+        int since2 = cn2_state_since[i];
+        FsmLane e2 = fsm_cn2_lane(s2, (w & SENSOR_DUST) | motor_moving << 4, now - since2,
+                                  0, cn2_command[i]);
+
+        // 값이 모두 0/1이므로 선택은 "조건 × 변화량"의 합으로 계산 (삼항 연산자는 분기로 남음)
+        cn1_state[i] = (unsigned char)e1.next;
+        cn1_command[i] = (unsigned char)e1.motor;
+        cn1_state_since[i] = since1 + (e1.next != s1) * (now - since1);
+        cn2_state[i] = (unsigned char)e2.next;
+        cn2_command[i] = (unsigned char)e2.cleaner;
+        cn2_state_since[i] = since2 + (e2.next != s2) * (now - since2);
+    }
+}
+
+// cn1_motor_fsm / cn2_cleaner_fsm의 타이머 값을 진입 tick에서 복원 (마지막으로 실행한 tick 기준)
+// 명세의 카운트다운 타이머는 진입할 때 그 상태의 한계로 장전되고 그 상태에서만 줄며
+// 한계에서 만료되면 반드시 나가므로 상태 밖에서는 0
+void fleet_timers(const RVCFleet *fleet, int i, int *duration1, int *back_timer, int *powerup_timer) {
+    int s1 = fleet->cn1_state[i], s2 = fleet->cn2_state[i];
+    *duration1 = fleet->ticks - 1 - fleet->cn1_state_since[i];
+    *back_timer = (s1 == MOTOR_BACKWARDING) * (fsm_cn1_timer_limit[s1] - *duration1);
+    *powerup_timer = (s2 == CLEANER_POWERUP) *
+                     (fsm_cn2_timer_limit[s2] - (fleet->ticks - 1 - fleet->cn2_state_since[i]));
+}
+
+// 전체 로봇 상태의 FNV-1a 해시 (같은 시드로 실행한 결과가 비트 단위로 같은지 비교용)
+unsigned long long fleet_checksum(RVCFleet *fleet) {
+    unsigned long long h = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < fleet->count; i++) {
+        int duration1, back_timer, powerup_timer;
+        fleet_timers(fleet, i, &duration1, &back_timer, &powerup_timer);
+        unsigned long long fields[9] = {
+            fleet->cn1_state[i], fleet->cn1_command[i],
+            (unsigned long long)duration1,
+            (unsigned long long)back_timer,
+            fleet->cn2_state[i],
+            (unsigned long long)powerup_timer,
+            fleet->pose_x[i], fleet->pose_y[i], fleet->heading[i]
+        };
+        for (int k = 0; k < 9; k++) {
+            h = (h ^ fields[k]) * 0x100000001B3ULL;
+        }
+    }
+    return h;
+}
+
+// 시작점에서 이동한 거리 (|dx| + |dy|, 자세는 Q8, 단위 길이는 kin.unit_mm)
+void fleet_pose_report(RVCFleet *fleet) {
+    double total = 0.0, farthest = 0.0;
+    for (int i = 0; i < fleet->count; i++) {
+        long long dx = (int)fleet->pose_x[i], dy = (int)fleet->pose_y[i];
+        double m = (double)(llabs(dx) + llabs(dy)) * fleet->kin.unit_mm / (1000 << KIN_FRAC_BITS);
+        total += m;
+        farthest = m > farthest ? m : farthest;
+    }
+    printf("Fleet poses: mean %.2f m from start (|dx| + |dy|), farthest %.2f m\n",
+           fleet->count > 0 ? total / fleet->count : 0.0, farthest);
+}
+
+// 상태별 로봇 수 출력
+void fleet_report(RVCFleet *fleet) {
+    const char *motor_states[] = {
+        "IDLE", "MOVING", "TURNING", "BACKWARDING", "PAUSED"
+    };
+    const char *cleaner_states[] = {
+        "OFF", "NORMAL", "POWERUP"
+    };
+    int motor_histogram[5] = {0};
+    int cleaner_histogram[3] = {0};
+
+    for (int i = 0; i < fleet->count; i++) {
+        motor_histogram[fleet->cn1_state[i]]++;
+        cleaner_histogram[fleet->cn2_state[i]]++;
+    }
+    printf("Fleet CN1 states (%d robots):", fleet->count);
+    for (int s = 0; s < 5; s++) {
+        printf(" %s=%d", motor_states[s], motor_histogram[s]);
+    }
+    printf("\nFleet CN2 states (%d robots):", fleet->count);
+    for (int s = 0; s < 3; s++) {
+        printf(" %s=%d", cleaner_states[s], cleaner_histogram[s]);
+    }
+    printf("\n");
+    fleet_pose_report(fleet);
+    printf("Fleet checksum: %016llx\n", fleet_checksum(fleet));
+}
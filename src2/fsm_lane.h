@@ -0,0 +1,115 @@
+/* ========== FSM 전이 함수 (fleet SoA 커널용) ========== */
+
+// 주의: 이 파일은 fsm/fsm_spec.h에서 fsm_gen으로 자동 생성한 것입니다.
+//       전이 규칙은 fsm/fsm_spec.h에서 수정하세요.
+// fsm_table.c와 같은 규칙을 분기 없는 식으로 펼친 것 (fleet.c에서 include)
+
+// fsm_cn1_table과 같은 전이를 로봇 1대분 식으로 계산 (fleet_step 루프 본문에 인라인)
+// duration: 이번 tick을 포함한 상태 지속 tick 수, motor/cleaner: 이전 명령
+static inline FsmLane fsm_cn1_lane(int state, int word, int duration, int motor, int cleaner) {
+    int one = 1 << state;
+    FsmLane r;
+    r.motor =
+        (-(one >> MOTOR_IDLE & 1) & CMD_STOP) +
+        (-(one >> MOTOR_MOVING & 1) & CMD_FORWARD) +
+        (-(one >> MOTOR_TURNING & 1) & motor) +
+        (-(one >> MOTOR_BACKWARDING & 1) & CMD_BACKWARD) +
+        (-(one >> MOTOR_PAUSED & 1) & CMD_STOP);
+    r.cleaner = cleaner;
+    int limit = 0
+        + (-(one >> MOTOR_IDLE & 1) & 2)
+        + (-(one >> MOTOR_TURNING & 1) & 2)
+        + (-(one >> MOTOR_BACKWARDING & 1) & 3)
+        + (-(one >> MOTOR_PAUSED & 1) & 5);
+    int in = word | (duration >= limit) << 5;    // IN_T: 상태 타이머 만료
+    int open, hit;
+    r.next = state;
+    r.reload = 0;
+    open = one >> MOTOR_IDLE & 1;
+    // -> MOTOR_MOVING
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (MOTOR_MOVING - MOTOR_IDLE);
+    open = one >> MOTOR_MOVING & 1;
+    // -> MOTOR_PAUSED
+    hit = -(open & ((in & 0x10) == 0x10));
+    open &= ~hit;
+    r.next += hit & (MOTOR_PAUSED - MOTOR_MOVING);
+    // -> MOTOR_TURNING
+    hit = -(open & ((in & 0x01) == 0x01));
+    r.next += hit & (MOTOR_TURNING - MOTOR_MOVING);
+    open = one >> MOTOR_TURNING & 1;
+    // -> MOTOR_BACKWARDING
+    hit = -(open & ((in & 0x07) == 0x07));
+    open &= ~hit;
+    r.next += hit & (MOTOR_BACKWARDING - MOTOR_TURNING);
+    r.reload += hit & 3;
+    // -> MOTOR_MOVING
+    hit = -(open & ((in & 0x22) == 0x20));
+    open &= ~hit;
+    r.next += hit & (MOTOR_MOVING - MOTOR_TURNING);
+    r.motor += hit & (CMD_TURN_LEFT - motor);
+    // -> MOTOR_TURNING
+    hit = -(open & ((in & 0x02) == 0x00));
+    open &= ~hit;
+    r.motor += hit & (CMD_TURN_LEFT - motor);
+    // -> MOTOR_MOVING
+    hit = -(open & ((in & 0x24) == 0x20));
+    open &= ~hit;
+    r.next += hit & (MOTOR_MOVING - MOTOR_TURNING);
+    r.motor += hit & (CMD_TURN_RIGHT - motor);
+    // -> MOTOR_TURNING
+    hit = -(open & ((in & 0x04) == 0x00));
+    open &= ~hit;
+    r.motor += hit & (CMD_TURN_RIGHT - motor);
+    // -> MOTOR_PAUSED
+    hit = -open;
+    r.next += hit & (MOTOR_PAUSED - MOTOR_TURNING);
+    open = one >> MOTOR_BACKWARDING & 1;
+    // -> MOTOR_TURNING
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (MOTOR_TURNING - MOTOR_BACKWARDING);
+    open = one >> MOTOR_PAUSED & 1;
+    // -> MOTOR_MOVING
+    hit = -(open & ((in & 0x10) == 0x00));
+    open &= ~hit;
+    r.next += hit & (MOTOR_MOVING - MOTOR_PAUSED);
+    // -> MOTOR_BACKWARDING
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (MOTOR_BACKWARDING - MOTOR_PAUSED);
+    r.reload += hit & 3;
+    return r;
+}
+
+// fsm_cn2_table과 같은 전이를 로봇 1대분 식으로 계산 (fleet_step 루프 본문에 인라인)
+// duration: 이번 tick을 포함한 상태 지속 tick 수, motor/cleaner: 이전 명령
+static inline FsmLane fsm_cn2_lane(int state, int word, int duration, int motor, int cleaner) {
+    int one = 1 << state;
+    FsmLane r;
+    r.motor = motor;
+    r.cleaner =
+        (-(one >> CLEANER_OFF & 1) & CMD_OFF) +
+        (-(one >> CLEANER_NORMAL & 1) & CMD_NORMAL) +
+        (-(one >> CLEANER_POWERUP & 1) & CMD_TURBO);
+    (void)cleaner;
+    int limit = 0
+        + (-(one >> CLEANER_POWERUP & 1) & 5);
+    int in = word | (duration >= limit) << 5;    // IN_T: 상태 타이머 만료
+    int open, hit;
+    r.next = state;
+    r.reload = 0;
+    open = one >> CLEANER_OFF & 1;
+    // -> CLEANER_NORMAL
+    hit = -open;
+    r.next += hit & (CLEANER_NORMAL - CLEANER_OFF);
+    open = one >> CLEANER_NORMAL & 1;
+    // -> CLEANER_POWERUP
+    hit = -(open & ((in & 0x18) == 0x18));
+    r.next += hit & (CLEANER_POWERUP - CLEANER_NORMAL);
+    r.reload += hit & 5;
+    open = one >> CLEANER_POWERUP & 1;
+    // -> CLEANER_NORMAL
+    hit = -(open & ((in & 0x20) == 0x20));
+    r.next += hit & (CLEANER_NORMAL - CLEANER_POWERUP);
+    return r;
+}
+
@@ -0,0 +1,331 @@
+/* ========== FSM 전이 테이블 ========== */
+
+// 주의: 이 파일은 fsm/fsm_spec.h에서 fsm_gen으로 자동 생성한 것입니다.
+//       전이 규칙은 fsm/fsm_spec.h에서 수정하세요.
+// 입력 워드 비트: 0=Front, 1=Left, 2=Right, 3=Dust, 4=CN1 Cleaner_Trigger / CN2 Motor_Status
+
+#include <stdio.h>
+#include "types.h"
+
+// fsm_cn1: 상태별 타이머 한계 (해당 상태 N tick째에 만료, 0: 없음)
+const unsigned char fsm_cn1_timer_limit[5] = {
+    2,  // MOTOR_IDLE
+    0,  // MOTOR_MOVING
+    2,  // MOTOR_TURNING
+    3,  // MOTOR_BACKWARDING
+    5,  // MOTOR_PAUSED
+};
+
+#if RVC_LOG_LEVEL >= RVC_LOG_TRANSITION
+const char *const fsm_cn1_messages[12] = {
+    NULL,
+    "[CN1] IDLE -> MOVING (start)",
+    "[CN1] MOVING -> PAUSED (cleaner trigger)",
+    "[CN1] MOVING -> TURNING (front obstacle)",
+    "[CN1] TURNING -> BACKWARDING (all blocked)",
+    "[CN1] Executing TURN_LEFT",
+    "[CN1] TURNING -> MOVING (turn complete)",
+    "[CN1] Executing TURN_RIGHT",
+    "[CN1] TURNING -> PAUSED (no path)",
+    "[CN1] BACKWARDING -> TURNING (escape)",
+    "[CN1] PAUSED -> MOVING (resume)",
+    "[CN1] PAUSED -> BACKWARDING (deadlock escape)",
+};
+#endif
+
+// [상태][입력 워드][타이머 만료] → {다음 상태, 모터, 청소기, 타이머, 메시지}
+const FsmEntry fsm_cn1_table[5][32][2] = {
+    {   // MOTOR_IDLE
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x00
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x01
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x02
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x03
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x04
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x05
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x06
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x07
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x08
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x09
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x0a
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x0b
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x0c
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x0d
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x0e
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x0f
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x10
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x11
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x12
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x13
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x14
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x15
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x16
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x17
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x18
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x19
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x1a
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x1b
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x1c
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x1d
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x1e
+        {{MOTOR_IDLE, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {1, 0}}},  // 0x1f
+    },
+    {   // MOTOR_MOVING
+        {{MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}},  // 0x00
+        {{MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}, {MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}},  // 0x01
+        {{MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}},  // 0x02
+        {{MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}, {MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}},  // 0x03
+        {{MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}},  // 0x04
+        {{MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}, {MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}},  // 0x05
+        {{MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}},  // 0x06
+        {{MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}, {MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}},  // 0x07
+        {{MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}},  // 0x08
+        {{MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}, {MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}},  // 0x09
+        {{MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}},  // 0x0a
+        {{MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}, {MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}},  // 0x0b
+        {{MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}},  // 0x0c
+        {{MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}, {MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}},  // 0x0d
+        {{MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_MOVING, CMD_FORWARD, FSM_KEEP, 0, {0, 0}}},  // 0x0e
+        {{MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}, {MOTOR_TURNING, CMD_FORWARD, FSM_KEEP, 0, {3, 0}}},  // 0x0f
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x10
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x11
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x12
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x13
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x14
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x15
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x16
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x17
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x18
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x19
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x1a
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x1b
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x1c
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x1d
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x1e
+        {{MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}, {MOTOR_PAUSED, CMD_FORWARD, FSM_KEEP, 0, {2, 0}}},  // 0x1f
+    },
+    {   // MOTOR_TURNING
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x00
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x01
+        {{MOTOR_TURNING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 0}}, {MOTOR_MOVING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 6}}},  // 0x02
+        {{MOTOR_TURNING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 0}}, {MOTOR_MOVING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 6}}},  // 0x03
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x04
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x05
+        {{MOTOR_PAUSED, FSM_KEEP, FSM_KEEP, 0, {8, 0}}, {MOTOR_PAUSED, FSM_KEEP, FSM_KEEP, 0, {8, 0}}},  // 0x06
+        {{MOTOR_BACKWARDING, FSM_KEEP, FSM_KEEP, 3, {4, 0}}, {MOTOR_BACKWARDING, FSM_KEEP, FSM_KEEP, 3, {4, 0}}},  // 0x07
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x08
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x09
+        {{MOTOR_TURNING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 0}}, {MOTOR_MOVING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 6}}},  // 0x0a
+        {{MOTOR_TURNING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 0}}, {MOTOR_MOVING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 6}}},  // 0x0b
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x0c
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x0d
+        {{MOTOR_PAUSED, FSM_KEEP, FSM_KEEP, 0, {8, 0}}, {MOTOR_PAUSED, FSM_KEEP, FSM_KEEP, 0, {8, 0}}},  // 0x0e
+        {{MOTOR_BACKWARDING, FSM_KEEP, FSM_KEEP, 3, {4, 0}}, {MOTOR_BACKWARDING, FSM_KEEP, FSM_KEEP, 3, {4, 0}}},  // 0x0f
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x10
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x11
+        {{MOTOR_TURNING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 0}}, {MOTOR_MOVING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 6}}},  // 0x12
+        {{MOTOR_TURNING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 0}}, {MOTOR_MOVING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 6}}},  // 0x13
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x14
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x15
+        {{MOTOR_PAUSED, FSM_KEEP, FSM_KEEP, 0, {8, 0}}, {MOTOR_PAUSED, FSM_KEEP, FSM_KEEP, 0, {8, 0}}},  // 0x16
+        {{MOTOR_BACKWARDING, FSM_KEEP, FSM_KEEP, 3, {4, 0}}, {MOTOR_BACKWARDING, FSM_KEEP, FSM_KEEP, 3, {4, 0}}},  // 0x17
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x18
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x19
+        {{MOTOR_TURNING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 0}}, {MOTOR_MOVING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 6}}},  // 0x1a
+        {{MOTOR_TURNING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 0}}, {MOTOR_MOVING, CMD_TURN_RIGHT, FSM_KEEP, 0, {7, 6}}},  // 0x1b
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x1c
+        {{MOTOR_TURNING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 0}}, {MOTOR_MOVING, CMD_TURN_LEFT, FSM_KEEP, 0, {5, 6}}},  // 0x1d
+        {{MOTOR_PAUSED, FSM_KEEP, FSM_KEEP, 0, {8, 0}}, {MOTOR_PAUSED, FSM_KEEP, FSM_KEEP, 0, {8, 0}}},  // 0x1e
+        {{MOTOR_BACKWARDING, FSM_KEEP, FSM_KEEP, 3, {4, 0}}, {MOTOR_BACKWARDING, FSM_KEEP, FSM_KEEP, 3, {4, 0}}},  // 0x1f
+    },
+    {   // MOTOR_BACKWARDING
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x00
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x01
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x02
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x03
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x04
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x05
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x06
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x07
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x08
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x09
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x0a
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x0b
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x0c
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x0d
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x0e
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x0f
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x10
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x11
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x12
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x13
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x14
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x15
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x16
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x17
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x18
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x19
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x1a
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x1b
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x1c
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x1d
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x1e
+        {{MOTOR_BACKWARDING, CMD_BACKWARD, FSM_KEEP, 0, {0, 0}}, {MOTOR_TURNING, CMD_BACKWARD, FSM_KEEP, 0, {9, 0}}},  // 0x1f
+    },
+    {   // MOTOR_PAUSED
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x00
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x01
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x02
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x03
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x04
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x05
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x06
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x07
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x08
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x09
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x0a
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x0b
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x0c
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x0d
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x0e
+        {{MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}, {MOTOR_MOVING, CMD_STOP, FSM_KEEP, 0, {10, 0}}},  // 0x0f
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x10
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x11
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x12
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x13
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x14
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x15
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x16
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x17
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x18
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x19
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x1a
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x1b
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x1c
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x1d
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x1e
+        {{MOTOR_PAUSED, CMD_STOP, FSM_KEEP, 0, {0, 0}}, {MOTOR_BACKWARDING, CMD_STOP, FSM_KEEP, 3, {11, 0}}},  // 0x1f
+    },
+};
+
+// fsm_cn2: 상태별 타이머 한계 (해당 상태 N tick째에 만료, 0: 없음)
+const unsigned char fsm_cn2_timer_limit[3] = {
+    0,  // CLEANER_OFF
+    0,  // CLEANER_NORMAL
+    5,  // CLEANER_POWERUP
+};
+
+#if RVC_LOG_LEVEL >= RVC_LOG_TRANSITION
+const char *const fsm_cn2_messages[4] = {
+    NULL,
+    "[CN2] OFF -> NORMAL (start)",
+    "[CN2] NORMAL -> POWERUP (dust detected)",
+    "[CN2] POWERUP -> NORMAL (clean complete)",
+};
+#endif
+
+// [상태][입력 워드][타이머 만료] → {다음 상태, 모터, 청소기, 타이머, 메시지}
+const FsmEntry fsm_cn2_table[3][32][2] = {
+    {   // CLEANER_OFF
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x00
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x01
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x02
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x03
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x04
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x05
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x06
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x07
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x08
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x09
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x0a
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x0b
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x0c
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x0d
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x0e
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x0f
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x10
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x11
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x12
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x13
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x14
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x15
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x16
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x17
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x18
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x19
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x1a
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x1b
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x1c
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x1d
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x1e
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_OFF, 0, {1, 0}}},  // 0x1f
+    },
+    {   // CLEANER_NORMAL
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x00
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x01
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x02
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x03
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x04
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x05
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x06
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x07
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x08
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x09
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x0a
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x0b
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x0c
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x0d
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x0e
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x0f
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x10
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x11
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x12
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x13
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x14
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x15
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x16
+        {{CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_NORMAL, 0, {0, 0}}},  // 0x17
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}, {CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}},  // 0x18
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}, {CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}},  // 0x19
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}, {CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}},  // 0x1a
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}, {CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}},  // 0x1b
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}, {CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}},  // 0x1c
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}, {CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}},  // 0x1d
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}, {CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}},  // 0x1e
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}, {CLEANER_POWERUP, FSM_KEEP, CMD_NORMAL, 5, {2, 0}}},  // 0x1f
+    },
+    {   // CLEANER_POWERUP
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x00
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x01
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x02
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x03
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x04
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x05
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x06
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x07
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x08
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x09
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x0a
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x0b
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x0c
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x0d
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x0e
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x0f
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x10
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x11
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x12
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x13
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x14
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x15
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x16
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x17
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x18
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x19
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x1a
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x1b
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x1c
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x1d
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x1e
+        {{CLEANER_POWERUP, FSM_KEEP, CMD_TURBO, 0, {0, 0}}, {CLEANER_NORMAL, FSM_KEEP, CMD_TURBO, 0, {3, 0}}},  // 0x1f
+    },
+};
+
@@ -0,0 +1,149 @@
+/* ========== 반응 지연 히스토그램 (센서 → 액추에이터) ========== */
+
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include "types.h"
+
+// SIGUSR1 수신 표시 (핸들러는 표시만 하고, 출력은 제어 루프가 tick 사이에 수행)
+volatile sig_atomic_t latency_dump_requested;
+
+// 통계 초기화
+void latency_init(LatencyStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+// 값 → 구간 번호
+// 2^(SUB_BITS+1) 미만은 1 ns 단위 그대로, 그 이상은 최상위 비트 아래 SUB_BITS 비트로 하위 구간 결정
+int latency_bucket(long long ns) {
+    unsigned long long v = ns < 0 ? 0 : (unsigned long long)ns;
+    if (v >= (1ULL << LATENCY_MAX_BITS)) {
+        v = (1ULL << LATENCY_MAX_BITS) - 1;
+    }
+    if (v < (2ULL << LATENCY_SUB_BITS)) {
+        return (int)v;
+    }
+    int shift = 63 - __builtin_clzll(v) - LATENCY_SUB_BITS;
+    return (shift << LATENCY_SUB_BITS) + (int)(v >> shift);
+}
+
+// 구간 번호 → 구간에 속하는 가장 큰 값 (HDR "highest equivalent value")
+long long latency_bucket_value(int bucket) {
+    if (bucket < (2 << LATENCY_SUB_BITS)) {
+        return bucket;
+    }
+    int shift = (bucket >> LATENCY_SUB_BITS) - 1;
+    long long sub = (bucket & ((1 << LATENCY_SUB_BITS) - 1)) + (1 << LATENCY_SUB_BITS);
+    return ((sub + 1) << shift) - 1;
+}
+
+void latency_add(LatencyHistogram *hist, long long ns) {
+    hist->counts[latency_bucket(ns)]++;
+    hist->samples++;
+    if (ns > hist->max_ns) {
+        hist->max_ns = ns;
+    }
+}
+
+// tick 1개의 단계별 시각 기록
+// t0: tick 시작, t1: sensor_interface 후, t2: control_logic 후, t3: actuator_interface 후
+void latency_record(LatencyStats *stats, int cn1_state, int cn2_state,
+                    long long t0, long long t1, long long t2, long long t3) {
+    latency_add(&stats->stage[LATENCY_SENSE], t1 - t0);
+    latency_add(&stats->stage[LATENCY_CONTROL], t2 - t1);
+    latency_add(&stats->stage[LATENCY_ACTUATE], t3 - t2);
+    latency_add(&stats->stage[LATENCY_REACTION], t3 - t0);
+    latency_add(&stats->by_cn1[cn1_state], t3 - t0);
+    latency_add(&stats->by_cn2[cn2_state], t3 - t0);
+}
+
+// tick 시작 지연 기록 (실시간 모드만, FAST 모드는 대기가 없어 항상 0)
+void latency_jitter(LatencyStats *stats, const VirtualClock *clk) {
+    if (clk->mode == CLOCK_MODE_REALTIME) {
+        latency_add(&stats->jitter, clk->jitter_us * 1000);
+    }
+}
+
+// 백분위 값 (q: 0-1), 최댓값을 넘지 않음
+long long latency_percentile(const LatencyHistogram *hist, double q) {
+    unsigned long long rank = (unsigned long long)(q * hist->samples + 0.999999);
+    unsigned long long seen = 0;
+    if (rank == 0) {
+        rank = 1;
+    }
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+        seen += hist->counts[b];
+        if (seen >= rank) {
+            long long value = latency_bucket_value(b);
+            return value < hist->max_ns ? value : hist->max_ns;
+        }
+    }
+    return hist->max_ns;
+}
+
+void latency_print_row(FILE *out, const char *name, const LatencyHistogram *hist) {
+    fprintf(out, "[LATENCY] %-16s %10llu %9lld %9lld %9lld %9lld\n",
+            name, hist->samples,
+            latency_percentile(hist, 0.50), latency_percentile(hist, 0.99),
+            latency_percentile(hist, 0.999), hist->max_ns);
+}
+
+// 단계별 / 상태별 지연 보고 (SRS PDF p.3-4 "P-2 반응시간 ≤ 150 ms")
+void latency_report(const LatencyStats *stats, FILE *out) {
+    const char *stage_names[LATENCY_STAGES] = {
+        "sense", "control", "actuate", "reaction"
+    };
+    const char *motor_states[] = {
+        "IDLE", "MOVING", "TURNING", "BACKWARDING", "PAUSED"
+    };
+    const char *cleaner_states[] = {
+        "OFF", "NORMAL", "POWERUP"
+    };
+
+    if (stats->stage[LATENCY_REACTION].samples == 0) {
+        return;
+    }
+    fprintf(out, "[LATENCY] %-16s %10s %9s %9s %9s %9s (ns)\n",
+            "stage", "samples", "p50", "p99", "p99.9", "max");
+    for (int s = 0; s < LATENCY_STAGES; s++) {
+        latency_print_row(out, stage_names[s], &stats->stage[s]);
+    }
+    if (stats->jitter.samples > 0) {
+        latency_print_row(out, "jitter", &stats->jitter);
+    }
+    for (int s = 0; s < 5; s++) {
+        if (stats->by_cn1[s].samples > 0) {
+            char name[32];
+            snprintf(name, sizeof(name), "@CN1 %s", motor_states[s]);
+            latency_print_row(out, name, &stats->by_cn1[s]);
+        }
+    }
+    for (int s = 0; s < 3; s++) {
+        if (stats->by_cn2[s].samples > 0) {
+            char name[32];
+            snprintf(name, sizeof(name), "@CN2 %s", cleaner_states[s]);
+            latency_print_row(out, name, &stats->by_cn2[s]);
+        }
+    }
+}
+
+void latency_signal(int sig) {
+    (void)sig;
+    latency_dump_requested = 1;
+}
+
+// SIGUSR1로 실행 중 히스토그램 출력 (kill -USR1 <pid>)
+void latency_install_signal(void) {
+#ifdef SIGUSR1
+    signal(SIGUSR1, latency_signal);
+#endif
+}
+
+// 제어 루프에서 tick마다 호출: 요청이 있으면 지금까지의 분포를 stderr로 출력
+// (stdout의 tick별 trace와 섞이지 않도록)
+void latency_poll(const LatencyStats *stats) {
+    if (latency_dump_requested) {
+        latency_dump_requested = 0;
+        latency_report(stats, stderr);
+    }
+}
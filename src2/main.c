@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <time.h>
 #include "types.h"
 
@@ -10,13 +11,52 @@
 RVCSystem rvc;
 
 // 함수 선언
-void sensor_interface(SensorData *sensors);
+void sensor_interface(SensorData *sensors, RngState *rng);
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream);
 void control_logic(RVCSystem *sys);
+bool control_init(void);
+void bus_report(const ControlBus *bus, FILE *out);
+void clock_init(VirtualClock *clk, ClockMode mode, long long period_us);
+long long clock_advance(VirtualClock *clk, int tick);
+void clock_tick_done(VirtualClock *clk);
+void clock_report(VirtualClock *clk);
+void clock_trace(const VirtualClock *clk);
+bool fleet_init(RVCFleet *fleet, int count, unsigned long long seed);
+void fleet_free(RVCFleet *fleet);
+void fleet_report(RVCFleet *fleet);
+bool swarm_init(SwarmWorld *world, RVCFleet *fleet, unsigned long long seed);
+void swarm_free(SwarmWorld *world);
+void swarm_report(const RVCFleet *fleet, int ticks);
+long long pool_run_fleet(RVCFleet *fleet, VirtualClock *clk, int ticks,
+                         int *threads, int *stolen);
+int explore_run(int threads);
+bool pipeline_start(RVCSystem *sys);
+void pipeline_step(RVCSystem *sys);
+void pipeline_stop(void);
+bool evlog_start(const char *path);
+void evlog_set_tick(int tick);
+void evlog_emit(int node, int from, int to, int reason, int value, int value2);
+void evlog_stop(void);
+int evlog_decode(const char *path);
+long long monotonic_ns(void);
+void latency_init(LatencyStats *stats);
+void latency_record(LatencyStats *stats, int cn1_state, int cn2_state,
+                    long long t0, long long t1, long long t2, long long t3);
+void latency_jitter(LatencyStats *stats, const VirtualClock *clk);
+void latency_report(const LatencyStats *stats, FILE *out);
+void latency_install_signal(void);
+void latency_poll(const LatencyStats *stats);
+void tickless_init(TicklessEngine *eng, bool summary);
+int tickless_skip(TicklessEngine *eng, RVCSystem *sys, VirtualClock *clk,
+                  int tick, int end_tick);
+void tickless_report(const TicklessEngine *eng);
+bool io_select(const char *name);
+void actuator_report(const ActuatorOutput *out);
 void actuator_interface(RVCSystem *sys);
 
 // 시스템 초기화 (SA PDF p.20 "INITIALIZE CN1_State := Idle, CN2_State := Off")
-void initialize_system() {
-    srand(time(NULL));
+void initialize_system(unsigned long long seed) {
+    rng_seed(&rvc.rng, seed, 0);
     
     // CN1 초기화 (SA PDF p.15 CN1 초기 상태)
     rvc.cn1.state = MOTOR_IDLE;
@@ -28,20 +68,36 @@ void initialize_system() {
     // CN2 초기화 (SA PDF p.16 CN2 초기 상태)
     rvc.cn2.state = CLEANER_OFF;
     rvc.cn2.command = CMD_OFF;
+    rvc.cn2.state_duration = 0;
     rvc.cn2.powerup_timer = 0;
     rvc.cn2.motor_is_moving = false;
     
     // 시스템
     rvc.tick_count = 0;  // SRS PDF p.2 "Tick: 제어 주기"
+    rvc.tick_time_us = 0;
     rvc.cleaner_trigger = false;
     rvc.motor_status_moving = false;
     
-    printf("=== RVC Control System V2 (Dual FSM: CN1+CN2) Started ===\n\n");
+    printf("=== RVC Control System V2 (Dual FSM: CN1+CN2) Started ===\n");
+    printf("Seed: %llu\n\n", seed);  // --seed로 같은 실행 재현
 }
 
 // 상태 출력 (SA PDF p.36 "제어 흐름 (Control Flows)")
 // SA PDF p.8 "Cleaner_Trigger ↔ Motor_Status (상호작용)"
+// tick별 상태를 이벤트 로그 레코드 1개로 기록
 void print_status(RVCSystem *sys) {
+#if RVC_LOG_LEVEL >= RVC_LOG_STATUS
+    int signals = sys->sensors | (sys->cleaner_trigger << 4) | (sys->motor_status_moving << 5);
+    evlog_emit(LOG_NODE_STATUS, sys->cn1.state, sys->cn2.state, signals,
+               sys->cn1.state_duration, 0);
+#else
+    (void)sys;
+#endif
+}
+
+// 상태 표시 레코드의 텍스트 변환 (eventlog.c의 drain 스레드/디코더가 호출)
+// tickless 구간 요약(LOG_NODE_SKIP, --tickless-summary)은 구간의 첫/마지막 tick과 유지된 상태만 출력
+void render_status(const LogRecord *rec, FILE *out) {
     const char *motor_states[] = {
         "IDLE", "MOVING", "TURNING", "BACKWARDING", "PAUSED"
     };
@@ -49,44 +105,277 @@ void print_status(RVCSystem *sys) {
         "OFF", "NORMAL", "POWERUP"
     };
     
-    printf("\n--- Tick %d ---\n", sys->tick_count);
-    printf("CN1 State: %s (duration: %d)\n", 
-           motor_states[sys->cn1.state], sys->cn1.state_duration);
-    printf("CN2 State: %s\n", cleaner_states[sys->cn2.state]);
-    printf("Sensors: F=%d L=%d R=%d D=%d\n",
-           sys->sensors.front, sys->sensors.left, 
-           sys->sensors.right, sys->sensors.dust);
-    printf("Trigger: Cleaner->Motor=%d, Motor->Cleaner=%d\n",
-           sys->cleaner_trigger, sys->motor_status_moving);
+    if (rec->node == LOG_NODE_SKIP) {
+        if (rec->value == 1) {
+            fprintf(out, "\n--- Tick %d: no events, skipped ---\n", rec->tick);
+        } else {
+            fprintf(out, "\n--- Ticks %d-%d: no events, skipped ---\n",
+                    rec->tick, rec->tick + rec->value - 1);
+        }
+        fprintf(out, "CN1 State: %s\n", motor_states[rec->from]);
+        fprintf(out, "CN2 State: %s\n", cleaner_states[rec->to]);
+        return;
+    }
+    fprintf(out, "\n--- Tick %d ---\n", rec->tick);
+    fprintf(out, "CN1 State: %s (duration: %d)\n", 
+            motor_states[rec->from], rec->value);
+    fprintf(out, "CN2 State: %s\n", cleaner_states[rec->to]);
+    fprintf(out, "Sensors: F=%d L=%d R=%d D=%d\n",
+            (rec->reason & SENSOR_FRONT) != 0, (rec->reason & SENSOR_LEFT) != 0,
+            (rec->reason & SENSOR_RIGHT) != 0, (rec->reason & SENSOR_DUST) != 0);
+    fprintf(out, "Trigger: Cleaner->Motor=%d, Motor->Cleaner=%d\n",
+            (rec->reason >> 4) & 1, (rec->reason >> 5) & 1);
+}
+
+// 명령행 옵션 해석
+//   --fast      가상 시간 모드: 대기 없이 최대 속도로 실행
+//   --ticks N   시뮬레이션 tick 수 (기본 50)
+//   --period-ms N  제어 주기 (기본 100 ms, SRS PDF p.3-4 "P-1 제어주기: 50–100 ms")
+//   --robots N  N대 로봇을 SoA 배치로 일괄 실행 (fleet 모드, tick별 출력 없음)
+//   --threads N fleet 모드 워커 스레드 수 (기본 1, 0: 모든 코어)
+//   --seed N    센서 난수 시드 (기본: 현재 시각). 같은 시드면 같은 실행 결과
+//   --log FILE  tick별 출력을 텍스트 대신 바이너리 이벤트 로그로 저장
+//   --decode FILE  저장된 이벤트 로그를 텍스트로 출력하고 종료
+//   --sched-trace  실시간 모드: tick별 [SCHED] jitter / 처리 시간을 상태 표시 뒤에 출력
+//   --explore   도달 가능한 모든 구성을 병렬 BFS로 탐색하여 deadlock/livelock 검사 후 종료
+//               (--threads로 스레드 수 지정)
+//   --pipeline  CN1/CN2 노드를 각자의 스레드에서 실행, 센서와 버스 신호는 SPSC 채널로 주고받음
+//               (순차 실행과 같은 결과, --tickless와 함께 쓸 수 없음)
+//   --bus-latency  제어 버스 신호별 전달 지연(쓰기 → 읽기)을 측정하여 종료 시 출력
+//   --tickless  (--fast 전용) 상태가 바뀔 수 없는 tick을 건너뛰고 다음 이벤트로 바로 진행
+//   --tickless-summary  --tickless와 같되 건너뛴 구간의 tick별 상태 표시를 요약 1줄로 줄임
+//   --io NAME   센서/액추에이터 I/O 백엔드 (기본 local: 프로세스 안의 센서 모델,
+//               shm: 공유 메모리 링으로 하드웨어 시뮬레이터 프로세스와 연결,
+//               grid: 격자 지도에서 장애물 센서를 유도하고 모터 명령으로 로봇 이동,
+//               --robots와 함께 쓰면 N대가 한 지도를 공유하며 서로를 장애물로 감지)
+//   --map FILE  grid: 지도 파일을 mmap으로 열어 사용 (로봇이 닿는 타일만 메모리에 올라옴)
+//   --save-map FILE  grid: 시드로 생성한 방을 지도 파일로 저장
+//   --room-m N  grid: 생성할 방 한 변 (기본 10 m, 창고 규모 지도 파일을 만들 때 사용)
+void parse_args(int argc, char *argv[], RunConfig *cfg) {
+    cfg->clock_mode = CLOCK_MODE_REALTIME;
+    cfg->ticks = 50;
+    cfg->robots = 0;
+    cfg->threads = 1;
+    cfg->seed = (unsigned long long)time(NULL);
+    cfg->period_us = 100000;  // 100ms - SRS PDF p.3-4 "P-1 제어주기: 50–100 ms"
+    cfg->log_path = NULL;
+    cfg->decode_path = NULL;
+    cfg->io = "local";
+    cfg->map_path = NULL;
+    cfg->map_save_path = NULL;
+    cfg->room_m = 10;
+    cfg->tickless = false;
+    cfg->tickless_summary = false;
+    cfg->explore = false;
+    cfg->sched_trace = false;
+    cfg->pipeline = false;
+    cfg->bus_latency = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--fast") == 0) {
+            cfg->clock_mode = CLOCK_MODE_FAST;
+        } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            cfg->ticks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--period-ms") == 0 && i + 1 < argc) {
+            cfg->period_us = atoll(argv[++i]) * 1000;
+        } else if (strcmp(argv[i], "--robots") == 0 && i + 1 < argc) {
+            cfg->robots = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            cfg->threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            cfg->seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--log") == 0 && i + 1 < argc) {
+            cfg->log_path = argv[++i];
+        } else if (strcmp(argv[i], "--decode") == 0 && i + 1 < argc) {
+            cfg->decode_path = argv[++i];
+        } else if (strcmp(argv[i], "--io") == 0 && i + 1 < argc) {
+            cfg->io = argv[++i];
+        } else if (strcmp(argv[i], "--map") == 0 && i + 1 < argc) {
+            cfg->map_path = argv[++i];
+        } else if (strcmp(argv[i], "--save-map") == 0 && i + 1 < argc) {
+            cfg->map_save_path = argv[++i];
+        } else if (strcmp(argv[i], "--room-m") == 0 && i + 1 < argc) {
+            cfg->room_m = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--tickless") == 0) {
+            cfg->tickless = true;
+        } else if (strcmp(argv[i], "--tickless-summary") == 0) {
+            cfg->tickless = true;
+            cfg->tickless_summary = true;
+        } else if (strcmp(argv[i], "--explore") == 0) {
+            cfg->explore = true;
+        } else if (strcmp(argv[i], "--sched-trace") == 0) {
+            cfg->sched_trace = true;
+        } else if (strcmp(argv[i], "--pipeline") == 0) {
+            cfg->pipeline = true;
+        } else if (strcmp(argv[i], "--bus-latency") == 0) {
+            cfg->bus_latency = true;
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        }
+    }
+    if (cfg->tickless && cfg->clock_mode != CLOCK_MODE_FAST) {
+        // 실시간 모드는 어차피 tick마다 주기를 기다리므로 건너뛸 수 없음
+        fprintf(stderr, "--tickless requires --fast; running tick by tick\n");
+        cfg->tickless = false;
+    }
+    if (cfg->tickless && cfg->pipeline) {
+        // 건너뛴 구간은 메인 스레드가 직접 진행하므로 노드 스레드의 컨텍스트와 어긋남
+        fprintf(stderr, "--tickless cannot be combined with --pipeline; running tick by tick\n");
+        cfg->tickless = false;
+    }
+    if (cfg->tickless && strcmp(cfg->io, "local") != 0) {
+        // 건너뛴 tick의 센서 난수를 제어기가 직접 넘기므로 외부 센서 프레임과 어긋남
+        fprintf(stderr, "--tickless requires --io local; running tick by tick\n");
+        cfg->tickless = false;
+    }
+}
+
+// Fleet 모드: N대 로봇을 SoA 배치로 일괄 실행
+// 센서 → FSM 전이 규칙은 단일 로봇 모드와 같고, tick별 출력 대신 통계만 보고
+// 로봇을 chunk로 나눠 work-stealing 스레드 풀이 처리하며 tick 사이는 barrier로 구분
+int run_fleet(RunConfig *cfg) {
+    RVCFleet fleet;
+    VirtualClock clk;
+    int threads = cfg->threads;
+    int stolen = 0;
+    long long step_us;
+
+    if (!fleet_init(&fleet, cfg->robots, cfg->seed)) {
+        fprintf(stderr, "Fleet allocation failed (%d robots)\n", cfg->robots);
+        fleet_free(&fleet);
+        return 1;
+    }
+    // --io grid: 로봇 전체가 한 격자 지도를 공유 (공간 해시로 이웃 로봇 감지)
+    if (io_backend == &io_grid && !swarm_init(&swarm_world, &fleet, cfg->seed)) {
+        fleet_free(&fleet);
+        return 1;
+    }
+    clock_init(&clk, cfg->clock_mode, cfg->period_us);
+
+    step_us = pool_run_fleet(&fleet, &clk, cfg->ticks, &threads, &stolen);
+    evlog_stop();
+
+    printf("\n=== Fleet Simulation Complete ===\n");
+    fleet_report(&fleet);
+    if (swarm_world.enabled) {
+        swarm_report(&fleet, cfg->ticks);
+        swarm_free(&swarm_world);
+    }
+    clock_report(&clk);
+
+    printf("Threads: %d, chunks stolen: %d\n", threads, stolen);
+
+    double robot_ticks = (double)fleet.count * cfg->ticks;
+    if (step_us > 0) {
+        printf("Sense + FSM step: %.2f ns/robot-tick (%.1f M robot-ticks/s)\n",
+               step_us * 1000.0 / robot_ticks, robot_ticks / step_us);
+    }
+    fleet_free(&fleet);
+    return 0;
 }
 
 // 메인 함수 (SA PDF p.6 DFD Level 0 "RVC Control (0)")
-int main(void) {
-    initialize_system();
+int main(int argc, char *argv[]) {
+    RunConfig cfg;
+    VirtualClock clk;
+    LatencyStats lat;
+    TicklessEngine eng;
+    bool io_lost = false;   // 하드웨어(I/O 백엔드) 연결이 끊겨 루프를 일찍 끝냄
+
+    parse_args(argc, argv, &cfg);
+    if (!control_init()) {
+        return 1;
+    }
+    if (cfg.decode_path) {
+        return evlog_decode(cfg.decode_path);
+    }
+    if (cfg.explore) {
+        return explore_run(cfg.threads);
+    }
+    if (!io_select(cfg.io)) {
+        return 1;
+    }
+    env_options.map_path = cfg.map_path;
+    env_options.save_path = cfg.map_save_path;
+    env_options.room_mm = cfg.room_m * 1000;
+    initialize_system(cfg.seed);
+    // 시뮬레이터 프로세스는 스레드(이벤트 로그 drain 등)를 만들기 전에 fork
+    if (cfg.robots == 0 && !io_backend->open(cfg.seed)) {
+        return 1;
+    }
+    if (!evlog_start(cfg.log_path)) {
+        io_backend->close();
+        return 1;
+    }
+    if (cfg.robots > 0) {
+        return run_fleet(&cfg);
+    }
+    clock_init(&clk, cfg.clock_mode, cfg.period_us);
+    latency_init(&lat);
+    latency_install_signal();
+    tickless_init(&eng, cfg.tickless_summary);
+    control_bus.measure = cfg.bus_latency;    // 신호별 전달 지연 측정 (단일 로봇 실행만)
+    if (cfg.pipeline && !pipeline_start(&rvc)) {
+        fprintf(stderr, "Pipeline unavailable; running CN1/CN2 sequentially\n");
+    }
     
-    // 시뮬레이션 루프: 50 ticks
-    for (int i = 0; i < 50; i++) {
+    // 시뮬레이션 루프: 기본 50 ticks
+    for (int i = 0; i < cfg.ticks; i++) {
+        if (cfg.tickless) {
+            // 다음 이벤트 직전까지 건너뜀 (건너뛴 구간은 엔진이 한 번에 진행하고 요약 레코드 1개)
+            i += tickless_skip(&eng, &rvc, &clk, i, cfg.ticks);
+            if (i >= cfg.ticks) {
+                break;
+            }
+        }
         rvc.tick_count = i;
+        evlog_set_tick(i);
+        rvc.tick_time_us = clock_advance(&clk, i);
+        // 반응 지연은 tick 시작 시 상태로 분류, 단계 경계마다 단조 시계 기록
+        int cn1_state = rvc.cn1.state, cn2_state = rvc.cn2.state;
+        long long t0 = monotonic_ns();
         
         // 1. 센서 인터페이스 (SA PDF p.7 "1.0 Sensor Interface & Preprocessing")
-        sensor_interface(&rvc.sensors);
+        if (!io_backend->read_sensors(&rvc.sensors, &rvc.rng)) {
+            io_lost = true;
+            break;
+        }
+        long long t1 = monotonic_ns();
         
         // 2. 제어 로직 (CN1 + CN2) (SA PDF p.8 "2.0 Control Logic (2개 CN)")
-        control_logic(&rvc);
+        if (cfg.pipeline) {
+            pipeline_step(&rvc);    // 노드 스레드에 센서 전달 → 결과 수신
+        } else {
+            control_logic(&rvc);
+        }
+        long long t2 = monotonic_ns();
         
         // 3. 액추에이터 인터페이스 (SA PDF p.7 "3.0 Actuator Interface")
         actuator_interface(&rvc);
+        long long t3 = monotonic_ns();
+        clock_tick_done(&clk);
+        latency_record(&lat, cn1_state, cn2_state, t0, t1, t2, t3);
+        latency_jitter(&lat, &clk);
         
         // 4. 상태 표시
         print_status(&rvc);
-        
-        // Tick 지연 시뮬레이션
-        #ifndef _WIN32
-        usleep(200000);  // 200ms
-        #endif
+        if (cfg.sched_trace) {
+            clock_trace(&clk);  // tick별 jitter / 처리 시간 (상태 표시 뒤)
+        }
+        latency_poll(&lat);  // SIGUSR1: 실행 중 분포 출력
     }
     
+    pipeline_stop();
+    evlog_stop();
     printf("\n=== Simulation Complete ===\n");
+    clock_report(&clk);
+    actuator_report(&rvc.output);
+    io_backend->close();
+    latency_report(&lat, stdout);
+    bus_report(&control_bus, stdout);
+    if (cfg.tickless) {
+        tickless_report(&eng);
+    }
     // SA PDF p.38 "문제점 해결 검증"
     printf("\nVersion 2 Benefits:\n");
     // SA PDF p.14 "설계 개선 목표: 일관성 및 유지보수성 향상"
@@ -96,6 +385,6 @@ int main(void) {
     // SA PDF p.38 "Interface 불일치 → 일관성 확보"
     printf("- No interface inconsistency\n");
     
-    return 0;
+    return io_lost ? 1 : 0;
 }
 
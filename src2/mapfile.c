@@ -0,0 +1,234 @@
+/* ========== 지도 파일 (블록 오프셋 표 + 8 KB 타일 블록, mmap 로더) ========== */
+/*
+ * 파일 구성 (리틀 엔디언, 호스트 구조체 그대로):
+ *   GridFileHeader
+ *   블록 오프셋 표: 블록마다 uint64 (파일 처음부터의 바이트 오프셋, 블록 번호 = 행 우선)
+ *   4 KB 정렬 후 블록 데이터: 공유 빈 블록 1개 + 장애물이 있는 블록만 (블록마다 1024 워드)
+ * 장애물이 없는 블록은 모두 공유 빈 블록을 가리키므로 파일은 벽/선반이 있는 면적에 비례하고,
+ * 칸 조회는 오프셋 표 1회 + 워드 1회로 O(1), 여는 데는 헤더/표 검사만 하고 블록은 읽지 않음
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "types.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define GRID_FILE_MAGIC "RVCGRID1"
+#define GRID_FILE_ALIGN 4096
+#define GRID_BLOCK_BYTES (GRID_BLOCK_WORDS * sizeof(unsigned long long))
+
+// 함수 선언
+void grid_unmap_file(GridMap *map);
+
+typedef struct {
+    char magic[8];
+    int width;
+    int height;
+    int cell_mm;
+    int blocks_x;
+    int blocks_y;
+    int reserved;
+    long long free_cells;
+    unsigned long long index_offset;    // 블록 오프셋 표 위치
+    unsigned long long data_offset;     // 공유 빈 블록 위치 (첫 블록, 4 KB 정렬)
+    unsigned long long file_size;
+} GridFileHeader;
+
+// 블록 b가 모두 빈 칸인지
+bool grid_block_empty(const GridMap *map, long long b) {
+    const unsigned long long *block = (const unsigned long long *)(map->tile_base + map->block_offset[b]);
+    for (int i = 0; i < GRID_BLOCK_WORDS; i++) {
+        if (block[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 지도 저장: 빈 블록은 공유 빈 블록으로 합침
+bool grid_save(const GridMap *map, const char *path) {
+    long long blocks = (long long)map->blocks_x * map->blocks_y;
+    unsigned long long *index = malloc((size_t)blocks * sizeof(unsigned long long));
+    FILE *f = fopen(path, "wb");
+    if (!index || !f) {
+        perror(path);
+        free(index);
+        if (f) {
+            fclose(f);
+        }
+        return false;
+    }
+
+    GridFileHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, GRID_FILE_MAGIC, sizeof(h.magic));
+    h.width = map->width;
+    h.height = map->height;
+    h.cell_mm = map->cell_mm;
+    h.blocks_x = map->blocks_x;
+    h.blocks_y = map->blocks_y;
+    h.free_cells = map->free_cells;
+    h.index_offset = sizeof(h);
+    h.data_offset = (h.index_offset + blocks * sizeof(unsigned long long) + GRID_FILE_ALIGN - 1)
+                    / GRID_FILE_ALIGN * GRID_FILE_ALIGN;
+    unsigned long long next = h.data_offset + GRID_BLOCK_BYTES;
+    for (long long b = 0; b < blocks; b++) {
+        if (grid_block_empty(map, b)) {
+            index[b] = h.data_offset;
+        } else {
+            index[b] = next;
+            next += GRID_BLOCK_BYTES;
+        }
+    }
+    h.file_size = next;
+
+    static const unsigned long long zero[GRID_BLOCK_WORDS];
+    bool ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+              fwrite(index, sizeof(unsigned long long), (size_t)blocks, f) == (size_t)blocks &&
+              fwrite(zero, 1, (size_t)(h.data_offset - h.index_offset - blocks * sizeof(unsigned long long)), f)
+                  == (size_t)(h.data_offset - h.index_offset - blocks * sizeof(unsigned long long)) &&
+              fwrite(zero, GRID_BLOCK_BYTES, 1, f) == 1;
+    for (long long b = 0; ok && b < blocks; b++) {
+        if (index[b] != h.data_offset) {
+            ok = fwrite(map->tile_base + map->block_offset[b], GRID_BLOCK_BYTES, 1, f) == 1;
+        }
+    }
+    if (fclose(f) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        fprintf(stderr, "%s: write failed\n", path);
+    }
+    free(index);
+    return ok;
+}
+
+// 헤더와 블록 오프셋 표 검사 (블록 데이터는 읽지 않음)
+bool grid_file_valid(const unsigned char *data, long long size) {
+    const GridFileHeader *h = (const GridFileHeader *)data;
+    int block_cells = 1 << (GRID_BLOCK_BITS + GRID_TILE_BITS);
+    if (size < (long long)sizeof(*h) || memcmp(h->magic, GRID_FILE_MAGIC, sizeof(h->magic)) != 0 ||
+        h->width <= 0 || h->height <= 0 || h->cell_mm <= 0 ||
+        h->blocks_x != ((long long)h->width + block_cells - 1) / block_cells ||
+        h->blocks_y != ((long long)h->height + block_cells - 1) / block_cells ||
+        h->file_size != (unsigned long long)size || h->index_offset % 8 != 0 ||
+        h->file_size < GRID_BLOCK_BYTES) {
+        return false;
+    }
+    // 외부 파일이므로 오프셋 + 길이를 더하지 않고 남은 크기와 비교 (unsigned 덧셈 wrap 방지)
+    unsigned long long blocks = (unsigned long long)h->blocks_x * h->blocks_y;
+    unsigned long long last = h->file_size - GRID_BLOCK_BYTES;    // 블록이 시작할 수 있는 마지막 위치
+    if (h->index_offset < sizeof(*h) || h->index_offset > h->file_size ||
+        blocks > (h->file_size - h->index_offset) / sizeof(unsigned long long) ||
+        h->data_offset < h->index_offset + blocks * sizeof(unsigned long long) ||
+        h->data_offset > last) {
+        return false;
+    }
+    const unsigned long long *index = (const unsigned long long *)(data + h->index_offset);
+    for (unsigned long long b = 0; b < blocks; b++) {
+        if (index[b] < h->data_offset || index[b] % 8 != 0 || index[b] > last) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 지도 파일 열기: 파일 전체를 읽기 전용으로 mmap (블록은 처음 조회할 때 페이지 인)
+// 로봇 주변만 읽으므로 미리 읽기(readahead)는 끔, Windows는 파일 전체를 읽음
+bool grid_map_file(GridMap *map, const char *path) {
+    unsigned char *data;
+    long long size;
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        perror(path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    size = st.st_size;
+    data = size > 0 ? mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "%s: cannot map file\n", path);
+        return false;
+    }
+    madvise(data, (size_t)size, MADV_RANDOM);
+#else
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = size > 0 ? malloc((size_t)size) : NULL;
+    if (!data || fread(data, 1, (size_t)size, f) != (size_t)size) {
+        fprintf(stderr, "%s: read failed\n", path);
+        free(data);
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+#endif
+
+    map->mapping = data;
+    map->mapping_size = size;
+    if (!grid_file_valid(data, size)) {
+        fprintf(stderr, "%s: not a grid map file\n", path);
+        grid_unmap_file(map);
+        return false;
+    }
+    const GridFileHeader *h = (const GridFileHeader *)data;
+    map->width = h->width;
+    map->height = h->height;
+    map->cell_mm = h->cell_mm;
+    map->blocks_x = h->blocks_x;
+    map->blocks_y = h->blocks_y;
+    map->words = (long long)h->blocks_x * h->blocks_y * GRID_BLOCK_WORDS;
+    map->free_cells = h->free_cells;
+    map->occupied = NULL;
+    map->tile_base = data;
+    map->block_offset = (const unsigned long long *)(data + h->index_offset);
+    return true;
+}
+
+void grid_unmap_file(GridMap *map) {
+#ifndef _WIN32
+    munmap(map->mapping, (size_t)map->mapping_size);
+#else
+    free(map->mapping);
+#endif
+    map->mapping = NULL;
+    map->mapping_size = 0;
+}
+
+// 매핑 중 페이지 캐시에 올라와 있는 바이트 (Windows는 파일 전체)
+// 캐시에서 내린 파일을 열었다면 이 프로세스가 조회한 블록만큼
+long long grid_resident_bytes(const GridMap *map) {
+#ifndef _WIN32
+    long long page = sysconf(_SC_PAGESIZE);
+    size_t pages = (size_t)((map->mapping_size + page - 1) / page);
+    unsigned char *vec = malloc(pages ? pages : 1);
+    long long resident = 0;
+    if (vec && mincore(map->mapping, (size_t)map->mapping_size, vec) == 0) {
+        for (size_t i = 0; i < pages; i++) {
+            resident += vec[i] & 1;
+        }
+    }
+    free(vec);
+    return resident * page;
+#else
+    return map->mapping_size;
+#endif
+}
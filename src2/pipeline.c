@@ -0,0 +1,265 @@
+/* ========== CN1 / CN2 파이프라인 실행 (노드별 스레드 + SPSC 채널) ========== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "types.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#endif
+
+#define PIPE_SLOTS 16           // 채널 크기 (2의 거듭제곱, 노드는 메인보다 최대 1 tick 앞섬)
+#define PIPE_SPINS 64           // 잠들기 전에 위치를 다시 확인하는 횟수
+
+// 함수 선언
+void cn1_node(RVCSystem *sys);
+void cn2_node(RVCSystem *sys);
+void control_logic(RVCSystem *sys);
+void evlog_set_tick(int tick);
+void evlog_capture_to(LogCapture *cap);
+void evlog_publish(const LogCapture *cap);
+
+// 채널 메시지 (모든 채널이 같은 형식)
+// 메인 → 노드: tick, 센서 워드, 지난 tick에 게시된 버스 신호
+// 노드 → 메인: 이번 tick에 쓴 버스 신호, 실행 후 컨텍스트와 trace
+typedef struct {
+    int tick;
+    bool stop;              // 메인 → 노드: 종료
+    SensorData sensors;
+    int bus[BUS_MAX_SIGNALS];
+    CN1_Context cn1;
+    CN2_Context cn2;
+    bool cleaner_trigger;   // 노드가 이번 tick에 받은 상호 신호 (상태 표시용)
+    bool motor_status_moving;
+    LogCapture log;         // 노드가 이번 tick에 기록한 전이 메시지
+} PipeMessage;
+
+#ifndef _WIN32
+
+// 단일 생산자/단일 소비자 채널 (lock-free 링)
+// head/tail을 캐시 라인으로 분리, 생산자만 tail을 쓰고 소비자만 head를 씀
+// 비었거나 가득 차면 조건 변수에서 잠들고, 상대가 위치를 옮긴 뒤 waiting을 보고 깨움
+typedef struct {
+    _Alignas(64) atomic_uint head;  // 소비자가 읽은 위치
+    _Alignas(64) atomic_uint tail;  // 생산자가 쓴 위치
+    _Alignas(64) atomic_int waiting;    // 잠든 쪽이 있는지 (SPSC라 비었을 때/가득 찼을 때 중 한쪽뿐)
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    PipeMessage slots[PIPE_SLOTS];
+} PipeChannel;
+
+// 노드 스레드: 제어 버스에 등록된 노드 step(cn1_node / cn2_node)을 자기 RVCSystem 사본에서 실행
+// SA PDF p.8 "CN 간 상호작용": 노드 사이 신호는 메인을 거쳐 채널로만 주고받음 (공유 필드 없음)
+typedef struct {
+    PipeChannel in;         // 메인 → 노드
+    PipeChannel out;        // 노드 → 메인
+    BusNodeStep step;
+    RVCSystem local;        // 노드 스레드가 소유하는 사본 (시작 시 메인 컨텍스트 복사)
+    pthread_t thread;
+} PipeNode;
+
+typedef struct {
+    PipeNode nodes[BUS_MAX_NODES];  // 제어 버스 노드 번호 순
+    int count;
+} ControlPipeline;
+
+ControlPipeline *ctl_pipe;     // NULL: 순차 실행 (control_logic)
+
+void pipe_init(PipeChannel *ch) {
+    atomic_init(&ch->head, 0);
+    atomic_init(&ch->tail, 0);
+    atomic_init(&ch->waiting, 0);
+    pthread_mutex_init(&ch->lock, NULL);
+    pthread_cond_init(&ch->wake, NULL);
+}
+
+void pipe_destroy(PipeChannel *ch) {
+    pthread_mutex_destroy(&ch->lock);
+    pthread_cond_destroy(&ch->wake);
+}
+
+// pos가 stale에서 바뀔 때까지 대기: 잠깐 확인해 보고 그래도 그대로면 잠듦 (코어를 점유하지 않음)
+// waiting 쓰기 → pos 읽기와 상대의 pos 쓰기 → waiting 읽기가 모두 seq_cst라
+// 둘 중 하나는 반드시 상대의 쓰기를 봄 → 깨우기를 놓치지 않음
+void pipe_wait(PipeChannel *ch, atomic_uint *pos, unsigned int stale) {
+    for (int i = 0; i < PIPE_SPINS; i++) {
+        if (atomic_load_explicit(pos, memory_order_acquire) != stale) {
+            return;
+        }
+    }
+    pthread_mutex_lock(&ch->lock);
+    atomic_store(&ch->waiting, 1);
+    while (atomic_load(pos) == stale) {
+        pthread_cond_wait(&ch->wake, &ch->lock);
+    }
+    atomic_store(&ch->waiting, 0);
+    pthread_mutex_unlock(&ch->lock);
+}
+
+// 위치를 옮긴 뒤 잠든 상대가 있으면 깨움 (없으면 원자 읽기 1회)
+void pipe_notify(PipeChannel *ch) {
+    if (atomic_load(&ch->waiting)) {
+        pthread_mutex_lock(&ch->lock);
+        pthread_cond_signal(&ch->wake);
+        pthread_mutex_unlock(&ch->lock);
+    }
+}
+
+void pipe_send(PipeChannel *ch, const PipeMessage *msg) {
+    unsigned int tail = atomic_load_explicit(&ch->tail, memory_order_relaxed);
+    if (tail - atomic_load_explicit(&ch->head, memory_order_acquire) >= PIPE_SLOTS) {
+        pipe_wait(ch, &ch->head, tail - PIPE_SLOTS);    // 가득 참: 소비자가 읽을 때까지
+    }
+    ch->slots[tail & (PIPE_SLOTS - 1)] = *msg;
+    atomic_store(&ch->tail, tail + 1);
+    pipe_notify(ch);
+}
+
+void pipe_recv(PipeChannel *ch, PipeMessage *msg) {
+    unsigned int head = atomic_load_explicit(&ch->head, memory_order_relaxed);
+    pipe_wait(ch, &ch->tail, head);     // 비어 있음: 생산자가 쓸 때까지
+    *msg = ch->slots[head & (PIPE_SLOTS - 1)];
+    atomic_store(&ch->head, head + 1);
+    pipe_notify(ch);
+}
+
+// 노드 스레드 (SA PDF p.24-27 Process 2.1 / 2.2)
+// tick t: 센서(t)와 지난 tick에 게시된 신호를 받아 노드 step 1회 → 이번 tick에 쓴 신호를 돌려줌
+// 사본의 버스는 front를 0으로 고정: 받은 신호를 0쪽에 넣고 노드가 1쪽에 쓴 값을 보냄
+void *pipeline_node_main(void *arg) {
+    PipeNode *pn = arg;
+    RVCSystem *local = &pn->local;
+    PipeMessage in, out = {0};
+
+    local->bus.front = 0;
+    for (;;) {
+        pipe_recv(&pn->in, &in);
+        if (in.stop) {
+            break;
+        }
+        local->tick_count = in.tick;
+        local->sensors = in.sensors;
+        memcpy(local->bus.value[0], in.bus, sizeof(in.bus));
+        evlog_set_tick(in.tick);
+        evlog_capture_to(&out.log);
+        pn->step(local);
+        evlog_capture_to(NULL);
+
+        out.tick = in.tick;
+        memcpy(out.bus, local->bus.value[1], sizeof(out.bus));
+        out.cn1 = local->cn1;
+        out.cn2 = local->cn2;
+        out.cleaner_trigger = local->cleaner_trigger;
+        out.motor_status_moving = local->motor_status_moving;
+        pipe_send(&pn->out, &out);
+    }
+    return NULL;
+}
+
+// 시작한 노드 스레드 종료 후 해제
+void pipeline_free(ControlPipeline *p, int started) {
+    PipeMessage stop = {0};
+    stop.stop = true;
+    for (int k = 0; k < started; k++) {
+        pipe_send(&p->nodes[k].in, &stop);
+        pthread_join(p->nodes[k].thread, NULL);
+    }
+    for (int k = 0; k < p->count; k++) {
+        pipe_destroy(&p->nodes[k].in);
+        pipe_destroy(&p->nodes[k].out);
+    }
+    free(p);
+}
+
+#endif
+
+// 파이프라인 시작: 제어 버스의 노드마다 스레드 1개, 현재 컨텍스트의 사본으로 시작
+// 노드가 CN1/CN2뿐이고 모든 신호가 다음 tick 전달일 때만 가능 (같은 tick 신호는 실행 순서가 필요하고,
+// 다른 노드의 상태는 메인 컨텍스트로 되돌릴 필드가 없음). 실패 시 false (순차 실행 유지)
+bool pipeline_start(RVCSystem *sys) {
+#ifndef _WIN32
+    const ControlBus *bus = &control_bus;
+    for (int k = 0; k < bus->node_count; k++) {
+        if (bus->nodes[k].reads_now ||
+            (bus->nodes[k].step != cn1_node && bus->nodes[k].step != cn2_node)) {
+            return false;
+        }
+    }
+    size_t size = (sizeof(ControlPipeline) + 63) / 64 * 64;  // aligned_alloc 크기는 정렬의 배수
+    ControlPipeline *p = aligned_alloc(64, size);
+    if (!p) {
+        return false;
+    }
+    p->count = bus->node_count;
+    for (int k = 0; k < p->count; k++) {
+        pipe_init(&p->nodes[k].in);
+        pipe_init(&p->nodes[k].out);
+        p->nodes[k].step = bus->nodes[k].step;
+        p->nodes[k].local = *sys;
+    }
+    for (int k = 0; k < p->count; k++) {
+        if (pthread_create(&p->nodes[k].thread, NULL, pipeline_node_main, &p->nodes[k]) != 0) {
+            pipeline_free(p, k);
+            return false;
+        }
+    }
+    ctl_pipe = p;
+    return true;
+#else
+    (void)sys;
+    return false;
+#endif
+}
+
+// 제어 로직 1 tick (파이프라인이 없으면 control_logic)
+// 센서 워드와 게시된 신호를 모든 노드에 보내고 결과를 모아 sys에 반영:
+// 신호는 생산 노드가 쓴 값을 게시 전 버퍼에 넣고 front를 바꿈 (bus_run_tick과 같은 게시)
+// 보류된 trace는 버스 실행 순서(CN1 → CN2)로 게시
+void pipeline_step(RVCSystem *sys) {
+#ifndef _WIN32
+    if (ctl_pipe) {
+        const ControlBus *bus = &control_bus;
+        PipeMessage msg = {0}, out[BUS_MAX_NODES];
+        msg.tick = sys->tick_count;
+        msg.sensors = sys->sensors;
+        memcpy(msg.bus, sys->bus.value[sys->bus.front], sizeof(msg.bus));
+        for (int k = 0; k < ctl_pipe->count; k++) {
+            pipe_send(&ctl_pipe->nodes[k].in, &msg);
+        }
+        for (int k = 0; k < ctl_pipe->count; k++) {
+            pipe_recv(&ctl_pipe->nodes[k].out, &out[k]);
+            if (ctl_pipe->nodes[k].step == cn1_node) {
+                sys->cn1 = out[k].cn1;
+                sys->cleaner_trigger = out[k].cleaner_trigger;
+            } else {
+                sys->cn2 = out[k].cn2;
+                sys->motor_status_moving = out[k].motor_status_moving;
+            }
+        }
+
+        int back = sys->bus.front ^ 1;
+        for (int s = 0; s < bus->signal_count; s++) {
+            sys->bus.value[back][s] = out[bus->signals[s].producer].bus[s];
+        }
+        sys->bus.front = back;
+        for (int k = 0; k < bus->node_count; k++) {
+            evlog_publish(&out[bus->order[k]].log);
+        }
+        return;
+    }
+#endif
+    control_logic(sys);
+}
+
+// 노드 스레드 종료
+void pipeline_stop(void) {
+#ifndef _WIN32
+    if (ctl_pipe) {
+        pipeline_free(ctl_pipe, ctl_pipe->count);
+        ctl_pipe = NULL;
+    }
+#endif
+}
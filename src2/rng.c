@@ -0,0 +1,29 @@
+/* ========== 카운터 기반 난수 생성기 ========== */
+
+#include "types.h"
+
+// 64비트 혼합 함수 (SplitMix64 finalizer, 전단사)
+unsigned long long rng_mix64(unsigned long long z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// 시드와 스트림 번호(로봇 번호)로 초기화
+// 같은 (seed, stream)이면 항상 같은 난수열 → 스레드 배치와 무관하게 재현 가능
+void rng_seed(RngState *rng, unsigned long long seed, unsigned long long stream) {
+    rng->key = rng_mix64(seed ^ (stream * 0xD1B54A32D192ED03ULL));
+    rng->counter = 0;
+}
+
+// 다음 64비트 난수: 출력 = mix(key + counter × γ)
+// 이전 출력에 의존하지 않는 카운터 기반 생성기라 잠금도 공유 상태도 없음
+unsigned long long rng_next(RngState *rng) {
+    rng->counter++;
+    return rng_mix64(rng->key + rng->counter * 0x9E3779B97F4A7C15ULL);
+}
+
+// n개를 뽑은 것과 같은 상태로 건너뜀 (카운터 기반이라 O(1))
+void rng_skip(RngState *rng, unsigned long long n) {
+    rng->counter += n;
+}
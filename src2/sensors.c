@@ -5,27 +5,30 @@
 #include <stdbool.h>
 #include "types.h"
 
-void read_front_sensor(bool *value) {
-    *value = (rand() % 10) < 2;  // 20% 장애물 확률
+// 함수 선언
+unsigned long long rng_next(RngState *rng);
+
+// 센서 프레임(64비트 난수 1개)을 16비트씩 잘라 각 센서가 자기 구간을 사용
+SensorData read_front_sensor(unsigned long long frame) {
+    return ((frame & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_FRONT;  // 20% 장애물 확률
 }
 
-void read_left_sensor(bool *value) {
-    *value = (rand() % 10) < 2;
+SensorData read_left_sensor(unsigned long long frame) {
+    return (((frame >> 16) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_LEFT;
 }
 
-void read_right_sensor(bool *value) {
-    *value = (rand() % 10) < 2;
+SensorData read_right_sensor(unsigned long long frame) {
+    return (((frame >> 32) & 0xFFFF) < SENSOR_OBSTACLE_THRESHOLD) * SENSOR_RIGHT;
 }
 
-void read_dust_sensor(bool *value) {
-    *value = (rand() % 10) < 1;  // 10% 먼지 확률
+SensorData read_dust_sensor(unsigned long long frame) {
+    return (((frame >> 48) & 0xFFFF) < SENSOR_DUST_THRESHOLD) * SENSOR_DUST;  // 10% 먼지 확률
 }
 
 // 센서 인터페이스 (SA PDF p.7 "1.0 Sensor Interface & Preprocessing")
-void sensor_interface(SensorData *sensors) {
-    read_front_sensor(&sensors->front);
-    read_left_sensor(&sensors->left);
-    read_right_sensor(&sensors->right);
-    read_dust_sensor(&sensors->dust);
+void sensor_interface(SensorData *sensors, RngState *rng) {
+    unsigned long long frame = rng_next(rng);  // tick당 난수 1회
+    // 센서별 비트를 OR 하여 4비트 워드로 묶음
+    *sensors = read_front_sensor(frame) | read_left_sensor(frame)
+             | read_right_sensor(frame) | read_dust_sensor(frame);
 }
-
@@ -1,5 +1,7 @@
 /* ========== 타입 정의 ========== */
 
+#include <stdbool.h>   // CN1/CN2 컨텍스트의 bool 필드
+
 // CN1: 모터 FSM 상태 (SA PDF p.15 CN1)
 // SRS PDF p.3 FR-2.1 "CN1(이동)과 CN2(청소) 별도 FSM"
 typedef enum {
@@ -41,13 +43,42 @@ typedef enum {
     TURN_NONE
 } TurnDirection;
 
-// 센서 데이터
+// 카운터 기반 난수 상태 (로봇마다 하나)
+typedef struct {
+    unsigned long long key;      // 시드 + 로봇 번호에서 유도
+    unsigned long long counter;  // 뽑은 횟수
+} RngState;
+
+// 센서 시뮬레이션 확률: 난수 한 번(64비트)을 16비트씩 잘라 센서 4개에 사용
+#define SENSOR_OBSTACLE_THRESHOLD 13107  // 65536 × 20% 장애물 확률
+#define SENSOR_DUST_THRESHOLD 6554       // 65536 × 10% 먼지 확률
+
+// 센서 데이터: 4비트 센서 워드 (FSM 전이 테이블 인덱스로 그대로 사용)
+#define SENSOR_FRONT 0x01
+#define SENSOR_LEFT  0x02
+#define SENSOR_RIGHT 0x04
+#define SENSOR_DUST  0x08
+typedef unsigned char SensorData;
+
+// 테이블 기반 FSM 전이 항목 (fsm/fsm_spec.h에서 생성한 fsm_table.c)
+// (상태, 센서 입력 워드, 타이머 만료) 조합마다 하나씩 미리 계산되어 있음
+#define FSM_KEEP 0xFF           // 명령을 이전 값으로 유지
 typedef struct {
-    bool front;
-    bool left;
-    bool right;
-    bool dust;
-} SensorData;
+    unsigned char next;         // 다음 상태
+    unsigned char motor;        // 모터 명령 (FSM_KEEP: 유지)
+    unsigned char cleaner;      // 청소기 명령 (FSM_KEEP: 유지)
+    unsigned char reload;       // 다음 상태 진입 시 카운트다운 타이머 값 (0: 없음)
+    unsigned char msg[2];       // trace 메시지 번호 (0: 없음)
+} FsmEntry;
+
+// fleet용 전이 함수(fsm_lane.h)의 결과: FsmEntry와 같은 내용을 로봇 1대분 값으로
+// (명령은 KEEP을 이미 이전 값으로 풀어 둠, 메시지는 fleet에서 쓰지 않음)
+typedef struct {
+    int next;
+    int motor;
+    int cleaner;
+    int reload;
+} FsmLane;
 
 // CN1 컨텍스트 (SA PDF p.8 "2.1 Motor State Management (CN1)")
 typedef struct {
@@ -62,20 +93,437 @@ typedef struct {
 typedef struct {
     CleanerState state;
     CleanerCommand command;
+    int state_duration;
     int powerup_timer;
     bool motor_is_moving;  // SRS PDF p.4 DD "Motor_Status"
 } CN2_Context;
 
+// 제어 버스 신호 값 (노드 간 메시지, bus.c)
+// 이중 버퍼: 노드는 front(지난 tick에 게시된 값)를 읽고 반대쪽에 씀
+// tick이 끝나면 front만 바꿔 이번 tick에 쓴 값을 게시 (복사 없음)
+#define BUS_MAX_NODES 8
+#define BUS_MAX_SIGNALS 16
+typedef struct {
+    int value[2][BUS_MAX_SIGNALS];
+    int front;
+} BusTable;
+
+// 액추에이터 출력 단계 (actuators.c)
+// 마지막으로 내보낸 명령을 기억하고, 바뀐 명령만 모아 tick당 한 번의 일괄 쓰기로 내보냄
+#define ACTUATOR_MOTOR 0
+#define ACTUATOR_CLEANER 1
+#define ACTUATOR_COUNT 2
+typedef struct {
+    bool committed;                         // false: 아직 내보낸 명령 없음 (첫 tick은 모두 내보냄)
+    int last[ACTUATOR_COUNT];               // 마지막으로 내보낸 명령
+    long long emitted[ACTUATOR_COUNT];      // 바뀌어서 내보낸 명령 수
+    long long suppressed[ACTUATOR_COUNT];   // 같아서 생략한 명령 수
+    long long writes;                       // 일괄 쓰기 횟수 (바뀐 명령이 있던 tick 수)
+} ActuatorOutput;
+
 // 시스템 컨텍스트 (SRS PDF p.2 FR-2 "제어노드 구조(CN1/CN2)")
 typedef struct {
     CN1_Context cn1;
     CN2_Context cn2;
+    BusTable bus;           // 노드 간 신호 (Cleaner_Trigger, Motor_Status, ...)
     SensorData sensors;
+    ActuatorOutput output;  // 액추에이터 출력 단계 (마지막 명령, 쓰기 카운터)
+    RngState rng;           // 센서 시뮬레이션 난수
     int tick_count;         // SRS PDF p.2 "Tick: 제어 주기"
-    bool cleaner_trigger;    // SA PDF p.8 "CN2 → CN1: Cleaner_Trigger"
-    bool motor_status_moving; // SA PDF p.8 "CN1 → CN2: Motor_Status"
+    long long tick_time_us; // 현재 tick의 (가상) 시각
+    bool cleaner_trigger;    // SA PDF p.8 "CN2 → CN1: Cleaner_Trigger" (이번 tick에 CN1이 받은 값)
+    bool motor_status_moving; // SA PDF p.8 "CN1 → CN2: Motor_Status" (이번 tick에 CN2가 받은 값)
 } RVCSystem;
 
+// 로봇 자세: 중심 좌표 (Q8 고정소수점, 1/256칸)와 45° 단위 방향 (0: +x, 1씩 시계 방향, y는 아래로 증가)
+// 칸 번호는 x >> KIN_FRAC_BITS
+#define ENV_HEADINGS 8
+#define KIN_FRAC_BITS 8
+typedef struct {
+    int x;
+    int y;
+    int heading;
+} RobotPose;
+
+#define ENV_STEP_MM 30          // tick당 전진/후진 거리 (300 mm/s × 100 ms)
+#define ENV_ROBOT_RADIUS_MM 170 // 로봇 반지름 (지름 34 cm)
+#define ENV_SENSOR_RANGE_MM 40  // 범퍼 앞 장애물 감지 거리
+
+// 운동학 모델 (kinematics.c): 방향별 1 tick 전진량 (Q8), Q15 sin/cos 표로 한 번만 계산
+// 자세 갱신은 정수 덧셈뿐이라 플랫폼과 무관하게 비트 단위로 같은 결과
+typedef struct {
+    int step[ENV_HEADINGS][2];
+    int unit_mm;            // 자세 1 단위 (Q8 이전) 길이
+} KinModel;
+
+// 다수 로봇 일괄 실행용 SoA(Structure of Arrays) 배치
+// 필드별로 연속 배치하여 만료 비교와 전이 검사를 컴파일러가 벡터화할 수 있게 함
+// 전이 규칙은 cn1_motor_fsm / cn2_cleaner_fsm / control_logic과 동일
+typedef struct {
+    int count;
+    unsigned char *cn1_state;      // MotorState
+    unsigned char *cn1_command;    // MotorCommand
+    int *cn1_state_since;          // CN1 현재 상태에 들어간 tick (state_duration / 타이머는 여기서 계산)
+    unsigned char *cn2_state;      // CleanerState
+    unsigned char *cn2_command;    // CleanerCommand
+    int *cn2_state_since;
+    int ticks;                     // 실행한 tick 수 (tick 안에서는 현재 tick 번호, 읽기 전용)
+    unsigned char *sensors;      // 센서 워드 (SENSOR_FRONT | ...), 로봇당 1바이트
+    RngState *rng;                 // 로봇별 난수 상태 (공유 rand() 잠금 회피)
+    unsigned int *pose_x;          // 자세 (Q8, 기본 단위 mm, 시작점 기준, 2^32 모듈러로 감김)
+    unsigned int *pose_y;
+    unsigned char *heading;
+    KinModel kin;
+} RVCFleet;
+
+// 가상 시계 모드 (SRS PDF p.2 "Tick: 제어 주기")
+typedef enum {
+    CLOCK_MODE_REALTIME,    // 실제 제어 주기에 맞춰 대기
+    CLOCK_MODE_FAST         // 대기 없이 최대 속도로 진행 (tick 시각 합성)
+} ClockMode;
+
+// 가상 시계 + 절대 데드라인 스케줄러
+// SRS PDF p.3-4 "P-1 제어주기: 50–100 ms", "P-2 반응시간 ≤ 150 ms"
+typedef struct {
+    ClockMode mode;
+    long long period_us;    // 제어 주기 (us)
+    long long start_us;     // 데드라인 격자 기준 (첫 tick 시작 전에는 clock_init 시점, 단조 시계)
+    bool anchored;          // 첫 tick이 start_us를 다시 잡았는지
+    long long now_us;       // 현재 tick의 시각 (시작 기준, us)
+    long long deadline_us;  // 현재 tick의 절대 데드라인 (단조 시계)
+    long long tick_start_us;    // 현재 tick의 실제 시작 시각 (단조 시계)
+    long long jitter_us;        // 현재 tick의 시작 지연 (실제 시작 - 데드라인)
+    long long jitter_sum_us;
+    long long jitter_max_us;
+    long long work_us;          // 현재 tick의 센서→액추에이터 처리 시간
+    long long work_max_us;      // 센서→액추에이터 최악 처리 시간
+    int missed_deadlines;       // 데드라인을 넘겨 시작한 tick 수
+    int ticks_done;
+} VirtualClock;
+
+// 반응 지연 히스토그램 (HDR 방식, 단위 ns)
+// 2의 거듭제곱 구간마다 2^LATENCY_SUB_BITS개의 하위 구간 → 상대 오차 1/32 이하, 크기 고정
+// SRS PDF p.3-4 "P-2 반응시간 ≤ 150 ms" 측정용
+#define LATENCY_SUB_BITS 5
+#define LATENCY_MAX_BITS 40     // 2^40 ns (약 18분) 이상은 마지막 구간에 포함
+#define LATENCY_BUCKETS ((LATENCY_MAX_BITS - LATENCY_SUB_BITS + 1) << LATENCY_SUB_BITS)
+typedef struct {
+    unsigned int counts[LATENCY_BUCKETS];
+    unsigned long long samples;
+    long long max_ns;
+} LatencyHistogram;
+
+// tick 단계: 센서 → 제어 → 액추에이터, 그리고 전체(반응 지연)
+typedef enum {
+    LATENCY_SENSE,      // tick 시작 → sensor_interface 완료
+    LATENCY_CONTROL,    // sensor_interface 완료 → control_logic 완료
+    LATENCY_ACTUATE,    // control_logic 완료 → actuator_interface 완료
+    LATENCY_REACTION,   // tick 시작 → actuator_interface 완료
+    LATENCY_STAGES
+} LatencyStage;
+
+// 단계별 + 상태별 반응 지연 (상태: tick 시작 시 CN1/CN2 상태)
+typedef struct {
+    LatencyHistogram stage[LATENCY_STAGES];
+    LatencyHistogram jitter;            // tick 시작 지연 (실시간 모드, 실제 시작 - 데드라인)
+    LatencyHistogram by_cn1[5];         // MotorState
+    LatencyHistogram by_cn2[3];         // CleanerState
+} LatencyStats;
+
+// 제어 버스 (노드 등록, 실행 순서, 신호별 지연)
+// 노드는 신호를 등록하고 생산/소비를 선언하며, 같은 tick에 읽는 신호(BUS_SAME_TICK)가
+// 있으면 생산 노드 뒤에 실행되도록 순서를 정함. 다음 tick 전달(BUS_NEXT_TICK)은 순서와 무관
+// 신호는 형식을 갖고 등록되며 생산 노드는 같은 형식으로 생산을 선언 (bus_produce에서 검사)
+typedef enum {
+    BUS_BOOL,               // 0/1 (SRS PDF p.3 FR-2.2 Cleaner_Trigger / Motor_Status), 탐색 키 1비트
+    BUS_INT                 // 정수 (배터리 잔량, 도킹 거리 등), 탐색 키 BUS_INT_BITS비트 (0 이상만)
+} BusSignalType;
+
+#define BUS_INT_BITS 8          // 상태 공간 탐색에서 BUS_INT 신호 값의 범위 (0..255, 넘으면 탐색 범위 초과)
+
+typedef enum {
+    BUS_NEXT_TICK,          // 지난 tick에 게시된 값을 읽음 (SA PDF p.8 CN 간 신호)
+    BUS_SAME_TICK           // 이번 tick에 생산 노드가 쓴 값을 읽음 (생산 노드가 먼저 실행)
+} BusDelivery;
+
+typedef struct ControlBus ControlBus;
+typedef void (*BusNodeStep)(RVCSystem *sys);
+
+typedef struct {
+    const char *name;
+    BusSignalType type;
+    int producer;           // 생산 노드 (-1: 없음), 생산 노드는 매 tick 값을 씀
+    long long written_ns[2];    // 쓰기 시각 (지연 측정 중): [0] 게시된 값, [1] 이번 tick 값
+    LatencyHistogram latency;   // 쓰기 → 소비 노드의 읽기 (ns)
+} BusSignal;
+
+typedef struct {
+    const char *name;
+    BusNodeStep step;
+    unsigned int writes;    // 생산하는 신호 비트마스크
+    unsigned int reads;     // 소비하는 신호 비트마스크 (지연 측정용)
+    unsigned int reads_now; // 같은 tick에 읽는 신호 비트마스크
+} BusNode;
+
+struct ControlBus {
+    BusNode nodes[BUS_MAX_NODES];
+    int node_count;
+    BusSignal signals[BUS_MAX_SIGNALS];
+    int signal_count;
+    int order[BUS_MAX_NODES];   // 실행 순서 (bus_finalize)
+    bool measure;           // 신호별 지연 측정 (--bus-latency, 단일 로봇 실행에서만)
+};
+
+// 신호 읽기/쓰기는 노드 step마다 호출되는 제어 경로라 헤더에 인라인으로 둠 (호출 비용 없음)
+// 신호 표는 RVCSystem 안에 있으므로 버스 정의는 필요 없음 (형식 검사는 등록 시 bus_produce에서)
+
+// 읽기: 지난 tick에 게시된 값 (BUS_NEXT_TICK)
+static inline int bus_read(const RVCSystem *sys, int signal) {
+    return sys->bus.value[sys->bus.front][signal];
+}
+
+// 읽기: 이번 tick에 생산 노드가 쓴 값 (BUS_SAME_TICK, 생산 노드가 먼저 실행됨)
+static inline int bus_read_now(const RVCSystem *sys, int signal) {
+    return sys->bus.value[sys->bus.front ^ 1][signal];
+}
+
+// 쓰기: 게시 전 버퍼에 그대로 기록 (tick이 끝날 때 게시)
+static inline void bus_write(RVCSystem *sys, int signal, int value) {
+    sys->bus.value[sys->bus.front ^ 1][signal] = value;
+}
+
+// 컴파일 시 로그 수준 (gcc -DRVC_LOG_LEVEL=N)
+// 꺼진 수준의 기록 코드는 전처리 단계에서 제거되어 분기도 포맷 문자열도 남지 않음
+#define RVC_LOG_NONE 0          // 로그 없음 (제품 펌웨어 / 벤치마크 빌드)
+#define RVC_LOG_TRANSITION 1    // FSM 전이와 회전 결정
+#define RVC_LOG_ACTUATOR 2      // + [MOTOR] / [CLEANER] 명령
+#define RVC_LOG_STATUS 3        // + tick별 상태 표시와 --sched-trace의 [SCHED] (디버그 빌드, 전체 trace)
+#ifndef RVC_LOG_LEVEL
+#define RVC_LOG_LEVEL RVC_LOG_STATUS
+#endif
+
+// 이벤트 로그 기록 종류
+typedef enum {
+    LOG_NODE_CN1,       // [CN1] 모터 FSM 전이
+    LOG_NODE_CN2,       // [CN2] 청소기 FSM 전이
+    LOG_NODE_MOTOR,     // [MOTOR] 모터 명령 (이전 로그 파일 변환용)
+    LOG_NODE_CLEANER,   // [CLEANER] 청소기 명령 (이전 로그 파일 변환용)
+    LOG_NODE_STATUS,    // tick별 상태 표시 (print_status)
+    LOG_NODE_SCHED,     // [SCHED] tick별 jitter / 처리 시간 (--sched-trace)
+    LOG_NODE_OUTPUT,    // [MOTOR] / [CLEANER] 일괄 쓰기 (바뀐 명령만)
+    LOG_NODE_SKIP       // tickless로 건너뛴 구간 요약 (--tickless-summary, tick별 상태 표시 대신 1개)
+} LogNode;
+
+// 이벤트 로그 레코드 (고정 크기 바이너리, printf 대신 링 버퍼에 기록)
+// 문자열 포맷은 drain 스레드 또는 오프라인 디코더(--decode)가 수행
+typedef struct {
+    unsigned long long seq; // 전역 순번 (스레드별 링을 합칠 때 순서 복원, 64비트라 감기지 않음)
+    int tick;
+    int value;              // STATUS: CN1 상태 지속 tick 수, SCHED: jitter (us), SKIP: 건너뛴 tick 수
+    int value2;             // SCHED: 처리 시간 (us)
+    unsigned char node;     // LogNode
+    unsigned char from;     // 이전 상태 (STATUS: CN1 상태, OUTPUT: 바뀐 액추에이터 비트)
+    unsigned char to;       // 다음 상태 (MOTOR/CLEANER: 명령, STATUS: CN2 상태, OUTPUT: 모터 명령)
+    unsigned char reason;   // 전이 메시지 번호 (STATUS: 센서 워드 | Trigger << 4 | Motor_Status << 5, OUTPUT: 청소기 명령)
+} LogRecord;
+
+// 보류한 로그 레코드 (파이프라인 노드 스레드가 tick 하나 동안 기록한 것)
+// CN1/CN2는 tick당 전이 메시지를 최대 2개씩 기록
+#define LOG_CAPTURE_RECORDS 4
+typedef struct {
+    LogRecord records[LOG_CAPTURE_RECORDS];
+    int count;
+} LogCapture;
+
+// Tickless 실행: FSM별 다음 이벤트 (이벤트 큐 항목)
+// 이벤트 = 센서 입력이나 타이머 만료로 상태가 바뀔 수 있는 가장 이른 tick
+typedef struct {
+    long long tick;
+    int node;               // 이벤트를 낸 FSM (V2: CN1, CN2)
+} TicklessEvent;
+
+#define TICKLESS_MAX_EVENTS 8
+typedef struct {
+    TicklessEvent heap[TICKLESS_MAX_EVENTS];    // 절대 tick 기준 최소 힙 (실행 내내 유지)
+    int count;
+    int pos[TICKLESS_MAX_EVENTS];   // 노드별 힙 위치 (-1: 예약 없음)
+    int key[TICKLESS_MAX_EVENTS];   // 노드별 예약 당시 상태 키 (바뀌면 다시 예약)
+    bool quiet_cn1[5][2];   // [CN1 상태][Cleaner_Trigger]: 타이머 만료 전 센서 입력과 무관
+    bool quiet_cn2[3][2];   // [CN2 상태][Motor_Status]: 타이머 만료 전 먼지 입력과 무관
+    long long stepped;      // FSM을 실제로 실행한 tick 수
+    long long skipped;      // 이벤트가 없어 건너뛴 tick 수
+    bool summary;           // 건너뛴 구간의 tick별 상태 표시 대신 요약 1개 (--tickless-summary)
+} TicklessEngine;
+
+// I/O 백엔드 (io.c): 센서 입력과 액추에이터 출력의 하드웨어 경계
+// local: 프로세스 안의 센서 모델 (기본), shm: 공유 메모리 링으로 하드웨어 시뮬레이터 프로세스와 연결
+typedef struct {
+    const char *name;
+    bool (*open)(unsigned long long seed);     // 시드: 센서 스트림 (local과 같은 프레임)
+    bool (*read_sensors)(SensorData *sensors, RngState *rng);  // false: 하드웨어 연결 끊김 (제어 루프 중단)
+    void (*write_actuators)(unsigned int changed, const int cmd[ACTUATOR_COUNT]);
+    void (*close)(void);
+} IoBackend;
+
+// 격자 환경 (env.c): 바닥 평면의 장애물 점유 격자
+// 8×8칸 타일 하나가 64비트 워드 1개 (비트 = 타일 안 행 × 8 + 열, 1 = 장애물)
+// 타일은 32×32 타일(256×256칸, 8 KB) 블록 안에서 Z-order(Morton) 순서, 블록은 행 우선
+// → 로봇 주변 수십 칸과 회전 후 탐지 지점이 지도 크기와 무관하게 캐시 라인 몇 개 안에 모임
+// 블록은 블록 오프셋 표로 찾음: 메모리에서 만든 지도는 연속 배열, 지도 파일(mapfile.c)은 mmap한 파일 안
+#define GRID_TILE_BITS 3        // 타일 한 변 8칸
+#define GRID_BLOCK_BITS 5       // 블록 한 변 32 타일
+#define GRID_BLOCK_WORDS (1 << (2 * GRID_BLOCK_BITS))
+typedef struct {
+    int width;              // 칸 수 (x)
+    int height;             // 칸 수 (y)
+    int cell_mm;            // 칸 한 변 (mm)
+    int blocks_x;           // 가로 블록 수
+    int blocks_y;
+    long long words;        // 64비트 워드 수 (블록 단위로 올림, 지도 밖 비트는 항상 0)
+    unsigned long long *occupied;   // 메모리에서 만든 지도의 블록 배열 (지도 파일이면 NULL, 읽기 전용)
+    const unsigned char *tile_base;             // 블록 오프셋의 기준 주소
+    const unsigned long long *block_offset;     // 블록 번호 → tile_base에서의 바이트 오프셋
+    void *mapping;          // 지도 파일 매핑 (munmap용, 메모리 지도면 NULL)
+    long long mapping_size;
+    long long free_cells;   // 장애물이 아닌 칸 수 (popcount로 계산)
+} GridMap;
+
+#define ENV_NOZZLE_MM 200       // 흡입구 폭 (로봇 중심의 정사각형 footprint 한 변, 청소 범위/먼지 제거)
+#define ENV_DUST_SENSE 48           // 먼지 센서: 로봇 중심 칸 밀도가 이 값 이상이면 감지
+#define ENV_DUST_PICKUP_NORMAL 6    // tick당 칸마다 제거하는 먼지 (일반 청소)
+#define ENV_DUST_PICKUP_TURBO 24    // (Power-Up 청소, SA PDF p.16)
+
+// 청소 범위 비트맵 (coverage.c): 지도와 같은 격자, 1 = 한 번 이상 청소한 칸
+// 매 tick 흡입구 footprint가 걸친 8×8칸 타일마다 워드 마스크로 갱신하고 새로 켜진 비트만 popcount로 누적
+typedef struct {
+    unsigned long long *cleaned;
+    long long cleaned_cells;    // 청소한 칸 수 (지도 전체를 다시 세지 않음)
+    long long swept_cells;      // 새로 지나간 칸 수 (직전 tick footprint와 겹치는 부분 제외)
+    long long recleaned_cells;  // 그중 이미 청소되어 있던 칸 수
+    long long ticks;
+    long long tick_90;          // 빈 칸의 90%를 처음 넘은 tick (-1: 아직)
+    long long time_90_us;       // 그때의 시각
+    long long time_us;          // 마지막 갱신 시각
+    int prev_x;                 // 직전 tick footprint 중심 (청소하지 않았으면 prev_valid = false)
+    int prev_y;
+    bool prev_valid;
+} CoverageMap;
+
+// 바닥 먼지 밀도 (dust.c): 칸마다 0~255, 64×64칸 타일 단위로 먼지가 있는 곳만 할당
+// 타일 하나 4 KB, 100 m² (1 cm)를 모두 채워도 1 MB, 다 치운 타일은 해제
+#define DUST_TILE_BITS 6
+#define DUST_TILE (1 << DUST_TILE_BITS)
+typedef struct {
+    int tiles_x;
+    int tiles_y;
+    unsigned char **tiles;      // 타일 디렉터리 (행 우선), NULL = 먼지 없음
+    unsigned int *tile_dust;    // 타일별 먼지 합 (0이 되면 타일 해제)
+    int live_tiles;             // 현재 할당된 타일 수
+    int peak_tiles;
+    long long deposited;        // 뿌린 먼지 총량
+    long long removed;          // 청소로 제거한 양
+    long long detections;       // 먼지 센서가 켜진 tick 수
+} DustField;
+
+// 격자 세계 지도 선택 (main에서 설정, io_grid_open에서 사용)
+typedef struct {
+    const char *map_path;   // 불러올 지도 파일 (NULL: 시드로 방 생성)
+    const char *save_path;  // 생성한 방을 저장할 지도 파일 (NULL: 저장 안 함)
+    int room_mm;            // 생성할 방 한 변
+} EnvOptions;
+
+// 격자 세계 (grid I/O 백엔드): 지도 + 로봇 1대
+// 모터 명령은 레지스터에 래치되어 다음 명령이 올 때까지 매 tick 적용 (실제 모터 드라이버와 같음)
+typedef struct {
+    GridMap map;
+    RobotPose pose;
+    int motor;              // 래치된 명령 (액추에이터 출력 단계가 바뀔 때만 씀)
+    int cleaner;
+    int probe[ENV_HEADINGS][2];     // 방향별 센서 탐지 지점 (로봇 중심 기준 칸 오프셋)
+    KinModel kin;                   // 1 tick 이동량 (Q8)
+    int body[ENV_HEADINGS][2];      // 방향별 몸체 앞 끝 (이동 충돌 검사)
+    long long moves;        // 이동한 tick 수
+    long long bumps;        // 장애물에 막혀 이동하지 못한 tick 수
+    CoverageMap coverage;
+    DustField dust;
+} GridWorld;
+
+// 공간 해시 (swarm.c): 지도를 버킷(정사각형)으로 나누고 버킷 좌표를 해시하여 2^bits칸 표에 담음
+// 표 칸마다 로봇 이중 연결 리스트 (노드 0..robots-1은 로봇, 그 뒤는 칸별 머리 노드)
+// 링크와 좌표를 노드 하나(16 B)에 두어 이웃을 따라갈 때 로봇마다 캐시 라인 하나만 읽음
+// 표 크기는 지도 넓이가 아니라 로봇 수에 비례하고, 버킷을 옮긴 로봇만 O(1)로 다시 연결
+typedef struct {
+    int next;
+    int prev;
+    int x;                  // tick 시작 시점 로봇 중심 칸 (감지/충돌 판정은 이 값만 읽음)
+    int y;
+} SwarmNode;
+
+typedef struct {
+    int robots;
+    int bits;
+    int bucket_cells;       // 버킷 한 변 (칸)
+    SwarmNode *nodes;
+    int *slot;              // 로봇이 든 표 칸
+    long long relinks;      // 버킷을 옮겨 다시 연결한 횟수
+} SpatialHash;
+
+// 공유 격자 세계 (swarm.c): fleet 로봇 전체가 한 지도에서 움직이고 서로를 장애물로 감지
+typedef struct {
+    bool enabled;           // false: fleet은 무작위 센서 모델 (지도 없음)
+    GridMap map;
+    SpatialHash hash;
+    int probe[ENV_HEADINGS][2];
+    int body[ENV_HEADINGS][2];
+    int radius_sq;          // 다른 로봇 몸체 판정 (중심 거리², 칸)
+    unsigned int *home_x;   // 시작 위치 (Q8 칸), fleet 자세는 여기서의 이동량
+    unsigned int *home_y;
+    unsigned int *bumps;    // 로봇별: 벽/가구에 막힌 tick 수
+    unsigned int *contacts; // 로봇별: 다른 로봇에 막힌 tick 수
+    unsigned char *ahead;   // 로봇별: 이번 tick 전진하면 다른 로봇과 겹침 (swarm_sense → swarm_move)
+    CoverageMap coverage;   // 로봇 전체가 함께 채우는 청소 범위
+    DustField dust;         // 로봇 전체가 함께 감지하고 치우는 먼지 (tick 안에서는 읽기만)
+    int *prev_x;            // 로봇별: 직전 tick footprint 중심 (coverage_sweep 재청소 제외)
+    int *prev_y;
+    unsigned char *prev_valid;
+} SwarmWorld;
+
+// 실행 설정 (명령행 옵션)
+typedef struct {
+    ClockMode clock_mode;
+    int ticks;
+    unsigned long long seed;    // 센서 난수 시드 (재현용)
+    int robots;             // 0: 단일 로봇, N: N대 일괄 실행 (fleet 모드)
+    int threads;            // fleet 모드 워커 스레드 수 (0: 모든 코어)
+    long long period_us;
+    const char *log_path;   // 이벤트 로그를 바이너리로 저장할 파일 (NULL: 텍스트로 stdout)
+    const char *decode_path;    // 저장된 이벤트 로그를 텍스트로 변환 (오프라인 디코더)
+    const char *io;         // I/O 백엔드 이름 (local / shm / grid)
+    const char *map_path;   // grid: 불러올 지도 파일
+    const char *map_save_path;  // grid: 생성한 방을 저장할 지도 파일
+    int room_m;             // grid: 생성할 방 한 변 (m)
+    bool tickless;          // 이벤트 사이의 변화 없는 tick을 건너뜀 (--fast 전용)
+    bool tickless_summary;  // tickless: 건너뛴 구간을 tick별 상태 표시 대신 요약 1개로 출력
+    bool explore;           // 도달 가능한 상태 공간을 탐색하여 deadlock/livelock 검사 후 종료
+    bool sched_trace;       // 실시간 모드: tick별 [SCHED] jitter / 처리 시간 출력
+    bool pipeline;          // CN1/CN2를 노드별 스레드에서 실행 (SPSC 채널로 센서와 버스 신호 전달)
+    bool bus_latency;       // 제어 버스 신호별 전달 지연 측정 (노드 실행마다 단조 시계 2회)
+} RunConfig;
+
+// FSM 전이 테이블 (fsm_table.c, 자동 생성)
+// 입력 워드 비트: 0=Front, 1=Left, 2=Right, 3=Dust, 4=CN1 Cleaner_Trigger / CN2 Motor_Status
+extern const unsigned char fsm_cn1_timer_limit[5];
+extern const char *const fsm_cn1_messages[];
+extern const FsmEntry fsm_cn1_table[5][32][2];
+extern const unsigned char fsm_cn2_timer_limit[3];
+extern const char *const fsm_cn2_messages[];
+extern const FsmEntry fsm_cn2_table[3][32][2];
+
 // 전역 변수
 extern RVCSystem rvc;
+extern const IoBackend *io_backend;  // io.c: 현재 I/O 백엔드 (--io)
+extern const IoBackend io_grid;      // env.c: 격자 세계 백엔드
+extern EnvOptions env_options;      // env.c: 격자 세계 지도 (--map / --save-map / --room-m)
+extern SwarmWorld swarm_world;      // swarm.c: fleet 공유 격자 세계 (--robots N --io grid)
+extern ControlBus control_bus;     // control.c: CN1/CN2 노드와 상호 신호 등록
 